@@ -0,0 +1,228 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <glib.h>
+
+#include <crm/crm.h>
+
+#include "cts-bench.h"
+
+gint cts_bench_iterations = 1;
+gboolean cts_bench_json = FALSE;
+
+/*!
+ * \internal
+ * \brief Check whether all integer options in a table are positive
+ *
+ * \param[in] entries  Option table (terminated by an entry with NULL name)
+ *
+ * \return true if every integer option is at least 1, otherwise false
+ */
+static bool
+counts_valid(const GOptionEntry *entries)
+{
+    for (const GOptionEntry *entry = entries; (entry != NULL)
+         && (entry->long_name != NULL); entry++) {
+
+        if ((entry->arg == G_OPTION_ARG_INT)
+            && (*(gint *) entry->arg_data < 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Parse a benchmark's command line and initialize logging
+ *
+ * All benchmarks accept --iterations and --json. Any integer options in
+ * \p extra are treated as counts and must be positive, like the iterations.
+ *
+ * \param[in,out] argc                Command-line argument count
+ * \param[in,out] argv                Command-line arguments
+ * \param[in]     name                Program name (for logging)
+ * \param[in]     summary             What the benchmark measures (for help)
+ * \param[in]     default_iterations  Iterations if not given
+ * \param[in]     iterations_help     What one iteration does (for help)
+ * \param[in]     extra               Program-specific options (or NULL)
+ *
+ * \return Exit status that caller should exit with if not \c CRM_EX_OK
+ */
+int
+cts_bench_init(int *argc, char ***argv, const char *name,
+               const char *summary, gint default_iterations,
+               const char *iterations_help, GOptionEntry *extra)
+{
+    GOptionContext *context = g_option_context_new(NULL);
+    GError *error = NULL;
+    char *help = crm_strdup_printf("%s (default %d)", iterations_help,
+                                   default_iterations);
+    GOptionEntry entries[] = {
+        { "iterations", 'n', 0, G_OPTION_ARG_INT, &cts_bench_iterations,
+          help, "N" },
+        { "json", 'j', 0, G_OPTION_ARG_NONE, &cts_bench_json,
+          "Print results as JSON", NULL },
+        { NULL }
+    };
+    bool valid = false;
+
+    cts_bench_iterations = default_iterations;
+
+    g_option_context_set_summary(context, summary);
+    g_option_context_add_main_entries(context, entries, NULL);
+    if (extra != NULL) {
+        g_option_context_add_main_entries(context, extra, NULL);
+    }
+    valid = g_option_context_parse(context, argc, argv, &error)
+            && counts_valid(entries) && counts_valid(extra);
+    g_option_context_free(context);
+    free(help);
+
+    if (!valid) {
+        fprintf(stderr, "%s\n",
+                (error != NULL)? error->message : "Invalid count");
+        g_clear_error(&error);
+        return CRM_EX_USAGE;
+    }
+
+    crm_log_cli_init(name);
+    return CRM_EX_OK;
+}
+
+/*!
+ * \internal
+ * \brief Get the current monotonic time
+ *
+ * \return Seconds since an arbitrary fixed point
+ */
+double
+cts_bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1e9);
+}
+
+/*!
+ * \internal
+ * \brief Start benchmark output
+ *
+ * In JSON, this opens the top-level object, with the iteration count as its
+ * first member. Nothing is printed for a table.
+ */
+void
+cts_bench_begin(void)
+{
+    if (cts_bench_json) {
+        printf("{\n  \"iterations\": %d", cts_bench_iterations);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Add a member to the top-level JSON object
+ *
+ * \param[in] name    Member name
+ * \param[in] format  printf(3)-style format for member value
+ * \param[in] ...     Arguments for \p format
+ *
+ * \note Nothing is printed for a table, so callers print any such summary
+ *       themselves.
+ */
+void
+cts_bench_add(const char *name, const char *format, ...)
+{
+    va_list ap;
+
+    if (!cts_bench_json) {
+        return;
+    }
+    printf(",\n  \"%s\": ", name);
+    va_start(ap, format);
+    vprintf(format, ap);
+    va_end(ap);
+}
+
+/*!
+ * \internal
+ * \brief Start a list of results
+ *
+ * \param[in] table_header  Column headings to print for a table
+ */
+void
+cts_bench_results_begin(const char *table_header)
+{
+    if (cts_bench_json) {
+        printf(",\n  \"results\": [\n");
+    } else {
+        printf("%s\n", table_header);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Print one result
+ *
+ * \param[in] index         Position of this result in list (starting at 0)
+ * \param[in] json_format   printf(3)-style format for JSON object members
+ * \param[in] table_format  printf(3)-style format for table row
+ * \param[in] ...           Arguments for whichever format is used
+ *
+ * \note Both formats must take the same arguments in the same order.
+ */
+void
+cts_bench_result(size_t index, const char *json_format,
+                 const char *table_format, ...)
+{
+    va_list ap;
+
+    va_start(ap, table_format);
+    if (cts_bench_json) {
+        printf("%s    { ", (index > 0)? ",\n" : "");
+        vprintf(json_format, ap);
+        printf(" }");
+    } else {
+        vprintf(table_format, ap);
+        printf("\n");
+    }
+    va_end(ap);
+}
+
+/*!
+ * \internal
+ * \brief End a list of results
+ */
+void
+cts_bench_results_end(void)
+{
+    if (cts_bench_json) {
+        printf("\n  ]");
+    }
+}
+
+/*!
+ * \internal
+ * \brief End benchmark output
+ */
+void
+cts_bench_end(void)
+{
+    if (cts_bench_json) {
+        printf("\n}\n");
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#ifndef CTS_BENCH__H
+#define CTS_BENCH__H
+
+/* Option handling, timing, and output shared by the C benchmark programs
+ *
+ * Each program accepts --iterations and --json, and prints either a table
+ * meant for people or a single JSON object meant for scripts.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <glib.h>
+
+extern gint cts_bench_iterations;
+extern gboolean cts_bench_json;
+
+int cts_bench_init(int *argc, char ***argv, const char *name,
+                   const char *summary, gint default_iterations,
+                   const char *iterations_help, GOptionEntry *extra);
+double cts_bench_now(void);
+
+void cts_bench_begin(void);
+void cts_bench_add(const char *name, const char *format, ...)
+    G_GNUC_PRINTF(2, 3);
+void cts_bench_results_begin(const char *table_header);
+void cts_bench_result(size_t index, const char *json_format,
+                      const char *table_format, ...);
+void cts_bench_results_end(void);
+void cts_bench_end(void);
+
+#endif // CTS_BENCH__H
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+/* Measure how many typical daemon IPC messages per second can be encoded and
+ * decoded, as XML text and with the compact encoding from pcmk__xml_pack()
+ */
+
+#include <crm_internal.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <glib.h>
+
+#include <crm/crm.h>
+#include <crm/common/xml.h>
+
+#include "cts-bench.h"
+
+// Like an attribute update from attrd_updater or the controller
+static xmlNode *
+attrd_message(void)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "create_attrd_op");
+
+    crm_xml_add(xml, PCMK__XA_T, PCMK__VALUE_ATTRD);
+    crm_xml_add(xml, PCMK__XA_SRC, "pacemaker-controld");
+    crm_xml_add(xml, PCMK_XA_TASK, PCMK__ATTRD_CMD_UPDATE);
+    crm_xml_add(xml, PCMK__XA_ATTR_NAME, "fail-count-database#monitor_10000");
+    crm_xml_add(xml, PCMK__XA_ATTR_SET_TYPE, PCMK_XE_INSTANCE_ATTRIBUTES);
+    crm_xml_add(xml, PCMK__XA_ATTR_VALUE, "value++");
+    crm_xml_add(xml, PCMK__XA_ATTR_HOST, "node-17.example.com");
+    crm_xml_add_int(xml, PCMK__XA_ATTR_IS_REMOTE, 0);
+    crm_xml_add_int(xml, PCMK__XA_ATTR_IS_PRIVATE, 0);
+    return xml;
+}
+
+// Like a resource action request from the controller to the executor
+static xmlNode *
+executor_message(void)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, PCMK__XE_LRMD_COMMAND);
+    xmlNode *calldata = pcmk__xe_create(xml, PCMK__XE_LRMD_CALLDATA);
+    xmlNode *data = pcmk__xe_create(calldata, PCMK__XE_LRMD_RSC);
+    xmlNode *args = pcmk__xe_create(data, PCMK__XE_ATTRIBUTES);
+
+    crm_xml_add(xml, PCMK__XA_T, PCMK__VALUE_LRMD);
+    crm_xml_add(xml, PCMK__XA_LRMD_OP, LRMD_OP_RSC_EXEC);
+    crm_xml_add_int(xml, PCMK__XA_LRMD_TIMEOUT, 20000);
+    crm_xml_add_int(xml, PCMK__XA_LRMD_CALLOPT, 0);
+    crm_xml_add_int(xml, PCMK__XA_LRMD_CALLID, 4711);
+    crm_xml_add(xml, PCMK__XA_LRMD_CLIENTID,
+                "6f1ac1b2-76a3-4e5c-9bd9-6e0a2c3e5f41");
+
+    crm_xml_add(data, PCMK__XA_LRMD_ORIGIN, "lrmd_api_exec");
+    crm_xml_add(data, PCMK__XA_LRMD_RSC_ID, "database");
+    crm_xml_add(data, PCMK__XA_LRMD_RSC_ACTION, PCMK_ACTION_MONITOR);
+    crm_xml_add(data, PCMK__XA_LRMD_RSC_USERDATA_STR,
+                "42:7:0:2f0f6fd6-2b4e-4b69-8a43-0d8b1a4b6d3e");
+    crm_xml_add_ms(data, PCMK__XA_LRMD_RSC_INTERVAL, 10000);
+    crm_xml_add_int(data, PCMK__XA_LRMD_TIMEOUT, 20000);
+    crm_xml_add_int(data, PCMK__XA_LRMD_RSC_START_DELAY, 0);
+
+    for (int i = 0; i < 20; i++) {
+        char *name = crm_strdup_printf("param%d", i);
+
+        crm_xml_add(args, name, "/var/lib/database/instance & <friends>");
+        free(name);
+    }
+    crm_xml_add(args, "CRM_meta_on_node", "node-17.example.com");
+    crm_xml_add(args, "CRM_meta_timeout", "20000");
+    return xml;
+}
+
+struct result {
+    const char *message;
+    const char *encoding;
+    size_t bytes;
+    double encode_per_sec;
+    double decode_per_sec;
+};
+
+static void
+bench(const char *message, xmlNode *xml, bool packed, struct result *result)
+{
+    GString *buffer = g_string_sized_new(4096);
+    double start = 0.0;
+
+    result->message = message;
+    result->encoding = packed? "packed" : "text";
+
+    start = cts_bench_now();
+    for (int i = 0; i < cts_bench_iterations; i++) {
+        g_string_truncate(buffer, 0);
+        if (packed) {
+            pcmk__xml_pack(xml, buffer);
+        } else {
+            pcmk__xml_string(xml, 0, buffer, 0);
+        }
+    }
+    result->encode_per_sec = cts_bench_iterations
+                             / (cts_bench_now() - start);
+    result->bytes = buffer->len;
+
+    start = cts_bench_now();
+    for (int i = 0; i < cts_bench_iterations; i++) {
+        xmlNode *copy = NULL;
+
+        if (packed) {
+            copy = pcmk__xml_unpack(buffer->str, buffer->len);
+        } else {
+            copy = pcmk__xml_parse(buffer->str);
+        }
+        CRM_ASSERT(copy != NULL);
+        free_xml(copy);
+    }
+    result->decode_per_sec = cts_bench_iterations
+                             / (cts_bench_now() - start);
+
+    g_string_free(buffer, TRUE);
+}
+
+int
+main(int argc, char **argv)
+{
+    struct result results[4];
+    xmlNode *attrd = NULL;
+    xmlNode *executor = NULL;
+    int rc = cts_bench_init(&argc, &argv, "cts-codec-bench",
+                            "Measure daemon IPC message encoding and "
+                            "decoding rates",
+                            100000, "Encode and decode each message N times",
+                            NULL);
+
+    if (rc != CRM_EX_OK) {
+        return rc;
+    }
+
+    attrd = attrd_message();
+    executor = executor_message();
+
+    bench("attrd-update", attrd, false, &results[0]);
+    bench("attrd-update", attrd, true, &results[1]);
+    bench("executor-exec", executor, false, &results[2]);
+    bench("executor-exec", executor, true, &results[3]);
+
+    cts_bench_begin();
+    cts_bench_results_begin("message        format    bytes     encode/sec"
+                            "     decode/sec");
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++) {
+        cts_bench_result(i,
+                         "\"message\": \"%s\", \"encoding\": \"%s\", "
+                         "\"bytes\": %zu, \"encode-per-sec\": %.0f, "
+                         "\"decode-per-sec\": %.0f",
+                         "%-14s %-7s %7zu %14.0f %14.0f",
+                         results[i].message, results[i].encoding,
+                         results[i].bytes, results[i].encode_per_sec,
+                         results[i].decode_per_sec);
+    }
+    cts_bench_results_end();
+    cts_bench_end();
+
+    free_xml(attrd);
+    free_xml(executor);
+    return CRM_EX_OK;
+}
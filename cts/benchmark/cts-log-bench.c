@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+/* Measure the cost of log calls that are compiled in but disabled, which is
+ * what nearly all trace and debug calls in the daemons are most of the time
+ */
+
+#include <crm_internal.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <glib.h>
+
+#include <crm/crm.h>
+#include <crm/common/xml.h>
+
+#include "cts-bench.h"
+
+// Counts evaluations of log arguments, which disabled calls should never do
+static long long evaluated = 0;
+
+static const char *
+expensive_argument(void)
+{
+    evaluated++;
+    return "database";
+}
+
+struct result {
+    const char *call;
+    const char *tracing;
+    double ns_per_call;
+};
+
+static void
+bench(const char *call, const char *tracing, xmlNode *xml,
+      struct result *result)
+{
+    double start = cts_bench_now();
+
+    result->call = call;
+    result->tracing = tracing;
+
+    if (strcmp(call, "crm_trace") == 0) {
+        for (int i = 0; i < cts_bench_iterations; i++) {
+            crm_trace("Monitor of %s on %s (call %d) returned %d",
+                      expensive_argument(), "node-17.example.com", i, 0);
+        }
+    } else if (strcmp(call, "crm_debug") == 0) {
+        for (int i = 0; i < cts_bench_iterations; i++) {
+            crm_debug("Monitor of %s on %s (call %d) returned %d",
+                      expensive_argument(), "node-17.example.com", i, 0);
+        }
+    } else {
+        for (int i = 0; i < cts_bench_iterations; i++) {
+            crm_log_xml_trace(xml, "Resource history");
+        }
+    }
+    result->ns_per_call = (cts_bench_now() - start) * 1e9
+                          / cts_bench_iterations;
+}
+
+int
+main(int argc, char **argv)
+{
+    struct result results[6];
+    xmlNode *xml = NULL;
+    int rc = cts_bench_init(&argc, &argv, "cts-log-bench",
+                            "Measure the cost of disabled log calls",
+                            10000000, "Make each log call N times", NULL);
+
+    if (rc != CRM_EX_OK) {
+        return rc;
+    }
+
+    xml = pcmk__xe_create(NULL, PCMK__XE_LRM_RSC_OP);
+    crm_xml_add(xml, PCMK_XA_ID, "database_monitor_10000");
+    crm_xml_add(xml, PCMK_XA_OPERATION, PCMK_ACTION_MONITOR);
+
+    bench("crm_trace", "off", NULL, &results[0]);
+    bench("crm_debug", "off", NULL, &results[1]);
+    bench("crm_log_xml_trace", "off", xml, &results[2]);
+
+    /* Tracing something elsewhere refilters every callsite, as changing trace
+     * options at run time would, but leaves these disabled
+     */
+    pcmk__set_trace_options(NULL, "no_such_function", NULL, NULL);
+    bench("crm_trace", "elsewhere", NULL, &results[3]);
+    bench("crm_debug", "elsewhere", NULL, &results[4]);
+    bench("crm_log_xml_trace", "elsewhere", xml, &results[5]);
+    pcmk__set_trace_options(NULL, NULL, NULL, NULL);
+
+    cts_bench_begin();
+    cts_bench_add("arguments-evaluated", "%lld", evaluated);
+    cts_bench_results_begin("call               tracing         ns/call");
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++) {
+        cts_bench_result(i,
+                         "\"call\": \"%s\", \"tracing\": \"%s\", "
+                         "\"ns-per-call\": %.2f",
+                         "%-18s %-10s %12.2f",
+                         results[i].call, results[i].tracing,
+                         results[i].ns_per_call);
+    }
+    cts_bench_results_end();
+    cts_bench_end();
+    if (!cts_bench_json) {
+        printf("Log arguments evaluated: %lld\n", evaluated);
+    }
+
+    free_xml(xml);
+    return CRM_EX_OK;
+}
@@ -0,0 +1,281 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+/* Measure how long the scheduler takes to unpack a CIB whose status section
+ * has a large number of resource history entries, and how many ISO 8601
+ * date/time specifications can be parsed per second
+ */
+
+#include <crm_internal.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <glib.h>
+
+#include <crm/crm.h>
+#include <crm/common/xml.h>
+#include <crm/pengine/status.h>
+
+#include "cts-bench.h"
+
+static gint n_entries = 100000;
+static gint n_nodes = 16;
+static gint parse_iterations = 100000;
+
+static GOptionEntry entries[] = {
+    { "entries", 'e', 0, G_OPTION_ARG_INT, &n_entries,
+      "Generate about N resource history entries (default 100000)", "N" },
+    { "nodes", 'N', 0, G_OPTION_ARG_INT, &n_nodes,
+      "Spread history across N nodes (default 16)", "N" },
+    { "parse-iterations", 'p', 0, G_OPTION_ARG_INT, &parse_iterations,
+      "Parse each date/time specification N times (default 100000)", "N" },
+    { NULL }
+};
+
+static void
+add_history(xmlNode *lrm_rsc, const char *rsc_id, const char *node_name,
+            const char *task, guint interval_ms, int call_id, int rc,
+            long long last_change)
+{
+    xmlNode *op = pcmk__xe_create(lrm_rsc, PCMK__XE_LRM_RSC_OP);
+    char *key = pcmk__op_key(rsc_id, task, interval_ms);
+    char *id = NULL;
+    char *magic = NULL;
+    char *transition_key = NULL;
+
+    if (interval_ms == 0) {
+        id = crm_strdup_printf("%s_last_0", rsc_id);
+    } else {
+        id = pcmk__str_copy(key);
+    }
+    transition_key = pcmk__transition_key(1, call_id, rc,
+                                          "a7f3d4c2-0c1e-4f0b-9a55-"
+                                          "4f6c1f0e2d11");
+    magic = crm_strdup_printf("0:%d;%s", rc, transition_key);
+
+    crm_xml_add(op, PCMK_XA_ID, id);
+    crm_xml_add(op, PCMK__XA_OPERATION_KEY, key);
+    crm_xml_add(op, PCMK_XA_OPERATION, task);
+    crm_xml_add(op, PCMK_XA_CRM_FEATURE_SET, CRM_FEATURE_SET);
+    crm_xml_add(op, PCMK__XA_TRANSITION_KEY, transition_key);
+    crm_xml_add(op, PCMK__XA_TRANSITION_MAGIC, magic);
+    crm_xml_add(op, PCMK__META_ON_NODE, node_name);
+    crm_xml_add_int(op, PCMK__XA_CALL_ID, call_id);
+    crm_xml_add_int(op, PCMK__XA_RC_CODE, rc);
+    crm_xml_add_int(op, PCMK__XA_OP_STATUS, PCMK_EXEC_DONE);
+    crm_xml_add_ms(op, PCMK_META_INTERVAL, interval_ms);
+    crm_xml_add_ll(op, PCMK_XA_LAST_RC_CHANGE, last_change);
+    crm_xml_add_int(op, PCMK_XA_EXEC_TIME, 23);
+    crm_xml_add_int(op, PCMK_XA_QUEUE_TIME, 0);
+    crm_xml_add(op, PCMK__XA_OP_DIGEST, "f2317cad3d54cec5d7d7aa7d0bf35cf8");
+
+    free(id);
+    free(key);
+    free(magic);
+    free(transition_key);
+}
+
+/*!
+ * \internal
+ * \brief Generate a CIB with many resource history entries
+ *
+ * Each resource is probed on every node and runs (with a recurring monitor) on
+ * one of them, so each resource has one history entry per node plus one.
+ *
+ * \param[out] total  Where to store number of history entries generated
+ *
+ * \return Newly created CIB XML
+ */
+static xmlNode *
+generate_cib(int *total)
+{
+    xmlNode *cib = pcmk__xe_create(NULL, PCMK_XE_CIB);
+    xmlNode *config = pcmk__xe_create(cib, PCMK_XE_CONFIGURATION);
+    xmlNode *nodes = NULL;
+    xmlNode *resources = NULL;
+    xmlNode *status = NULL;
+    xmlNode **lrm_resources = NULL;
+    int n_resources = QB_MAX(n_entries / (n_nodes + 1), 1);
+    long long base = (long long) time(NULL) - 86400;
+
+    *total = 0;
+
+    crm_xml_add(cib, PCMK_XA_CRM_FEATURE_SET, CRM_FEATURE_SET);
+    crm_xml_add(cib, PCMK_XA_VALIDATE_WITH, "pacemaker-3.10");
+    crm_xml_add_int(cib, PCMK_XA_EPOCH, 1);
+    crm_xml_add(cib, PCMK_XA_HAVE_QUORUM, PCMK_VALUE_TRUE);
+    crm_xml_add(cib, PCMK_XA_DC_UUID, "1");
+
+    pcmk__xe_create(config, PCMK_XE_CRM_CONFIG);
+    nodes = pcmk__xe_create(config, PCMK_XE_NODES);
+    resources = pcmk__xe_create(config, PCMK_XE_RESOURCES);
+    pcmk__xe_create(config, PCMK_XE_CONSTRAINTS);
+    status = pcmk__xe_create(cib, PCMK_XE_STATUS);
+
+    lrm_resources = pcmk__assert_alloc(n_nodes, sizeof(xmlNode *));
+    for (int i = 0; i < n_nodes; i++) {
+        xmlNode *node = pcmk__xe_create(nodes, PCMK_XE_NODE);
+        xmlNode *node_state = pcmk__xe_create(status, PCMK__XE_NODE_STATE);
+        xmlNode *lrm = pcmk__xe_create(node_state, PCMK__XE_LRM);
+        char *name = crm_strdup_printf("node%d", i + 1);
+
+        crm_xml_add_int(node, PCMK_XA_ID, i + 1);
+        crm_xml_add(node, PCMK_XA_UNAME, name);
+
+        crm_xml_add_int(node_state, PCMK_XA_ID, i + 1);
+        crm_xml_add(node_state, PCMK_XA_UNAME, name);
+        crm_xml_add(node_state, PCMK__XA_IN_CCM, PCMK_VALUE_TRUE);
+        crm_xml_add(node_state, PCMK_XA_CRMD, PCMK_VALUE_ONLINE);
+        crm_xml_add(node_state, PCMK__XA_JOIN, CRMD_JOINSTATE_MEMBER);
+        crm_xml_add(node_state, PCMK_XA_EXPECTED, CRMD_JOINSTATE_MEMBER);
+
+        crm_xml_add_int(lrm, PCMK_XA_ID, i + 1);
+        lrm_resources[i] = pcmk__xe_create(lrm, PCMK__XE_LRM_RESOURCES);
+        free(name);
+    }
+
+    for (int r = 0; r < n_resources; r++) {
+        xmlNode *primitive = pcmk__xe_create(resources, PCMK_XE_PRIMITIVE);
+        xmlNode *meta = pcmk__xe_create(primitive, PCMK_XE_META_ATTRIBUTES);
+        xmlNode *nvpair = pcmk__xe_create(meta, PCMK_XE_NVPAIR);
+        char *rsc_id = crm_strdup_printf("rsc%d", r + 1);
+        char *id = NULL;
+
+        crm_xml_add(primitive, PCMK_XA_ID, rsc_id);
+        crm_xml_add(primitive, PCMK_XA_CLASS, PCMK_RESOURCE_CLASS_OCF);
+        crm_xml_add(primitive, PCMK_XA_PROVIDER, "pacemaker");
+        crm_xml_add(primitive, PCMK_XA_TYPE, "Dummy");
+
+        // A failure timeout makes unpacking check each entry for expiration
+        id = crm_strdup_printf("%s-meta", rsc_id);
+        crm_xml_add(meta, PCMK_XA_ID, id);
+        free(id);
+        id = crm_strdup_printf("%s-meta-failure-timeout", rsc_id);
+        crm_xml_add(nvpair, PCMK_XA_ID, id);
+        free(id);
+        crm_xml_add(nvpair, PCMK_XA_NAME, PCMK_META_FAILURE_TIMEOUT);
+        crm_xml_add(nvpair, PCMK_XA_VALUE, "10min");
+
+        for (int i = 0; i < n_nodes; i++) {
+            xmlNode *lrm_rsc = pcmk__xe_create(lrm_resources[i],
+                                               PCMK__XE_LRM_RESOURCE);
+            char *node_name = crm_strdup_printf("node%d", i + 1);
+            long long when = base + r;
+
+            crm_xml_add(lrm_rsc, PCMK_XA_ID, rsc_id);
+            crm_xml_add(lrm_rsc, PCMK_XA_CLASS, PCMK_RESOURCE_CLASS_OCF);
+            crm_xml_add(lrm_rsc, PCMK_XA_PROVIDER, "pacemaker");
+            crm_xml_add(lrm_rsc, PCMK_XA_TYPE, "Dummy");
+
+            if ((r % n_nodes) == i) {
+                add_history(lrm_rsc, rsc_id, node_name, PCMK_ACTION_START,
+                            0, 2, PCMK_OCF_OK, when);
+                add_history(lrm_rsc, rsc_id, node_name, PCMK_ACTION_MONITOR,
+                            10000, 3, PCMK_OCF_OK, when);
+                *total += 2;
+            } else {
+                add_history(lrm_rsc, rsc_id, node_name, PCMK_ACTION_MONITOR,
+                            0, 1, PCMK_OCF_NOT_RUNNING, when);
+                (*total)++;
+            }
+            free(node_name);
+        }
+        free(rsc_id);
+    }
+    free(lrm_resources);
+    return cib;
+}
+
+static double
+bench_unpack(const xmlNode *cib)
+{
+    double best = 0.0;
+
+    for (int i = 0; i < cts_bench_iterations; i++) {
+        pcmk_scheduler_t *scheduler = pe_new_working_set();
+        double start = 0.0;
+        double elapsed = 0.0;
+
+        CRM_ASSERT(scheduler != NULL);
+        scheduler->input = pcmk__xml_copy(NULL, (xmlNode *) cib);
+        pcmk__set_scheduler_flags(scheduler, pcmk_sched_no_counts);
+
+        start = cts_bench_now();
+        cluster_status(scheduler);
+        elapsed = cts_bench_now() - start;
+
+        if ((i == 0) || (elapsed < best)) {
+            best = elapsed;
+        }
+        pe_free_working_set(scheduler);
+    }
+    return best;
+}
+
+static double
+bench_parse(const char *date_time)
+{
+    double start = cts_bench_now();
+
+    for (int i = 0; i < parse_iterations; i++) {
+        crm_time_t *dt = crm_time_new(date_time);
+
+        CRM_ASSERT(dt != NULL);
+        crm_time_free(dt);
+    }
+    return parse_iterations / (cts_bench_now() - start);
+}
+
+int
+main(int argc, char **argv)
+{
+    xmlNode *cib = NULL;
+    int total = 0;
+    double unpack_sec = 0.0;
+    double extended_per_sec = 0.0;
+    double basic_per_sec = 0.0;
+    int rc = cts_bench_init(&argc, &argv, "cts-unpack-bench",
+                            "Measure scheduler status unpacking and "
+                            "ISO 8601 parsing rates",
+                            3, "Unpack the CIB N times", entries);
+
+    if (rc != CRM_EX_OK) {
+        return rc;
+    }
+
+    cib = generate_cib(&total);
+    unpack_sec = bench_unpack(cib);
+
+    // Pacemaker's own format (fast path) and ISO 8601 basic format
+    extended_per_sec = bench_parse("2024-02-29 23:59:58Z");
+    basic_per_sec = bench_parse("20240229T235958Z");
+
+    cts_bench_begin();
+    cts_bench_add("history-entries", "%d", total);
+    cts_bench_add("nodes", "%d", n_nodes);
+    cts_bench_add("unpack-seconds", "%.3f", unpack_sec);
+    cts_bench_add("entries-per-sec", "%.0f", total / unpack_sec);
+    cts_bench_add("extended-parses-per-sec", "%.0f", extended_per_sec);
+    cts_bench_add("basic-parses-per-sec", "%.0f", basic_per_sec);
+    cts_bench_end();
+
+    if (!cts_bench_json) {
+        printf("%d history entries on %d nodes unpacked in %.3fs "
+               "(best of %d, %.0f entries/sec)\n",
+               total, n_nodes, unpack_sec, cts_bench_iterations,
+               total / unpack_sec);
+        printf("ISO 8601 parses/sec: %.0f extended, %.0f basic\n",
+               extended_per_sec, basic_per_sec);
+    }
+
+    free_xml(cib);
+    return CRM_EX_OK;
+}
@@ -251,6 +251,7 @@ attrd_register_handlers(void)
         { PCMK__ATTRD_CMD_UPDATE, handle_update_request },
         { PCMK__ATTRD_CMD_UPDATE_DELAY, handle_update_request },
         { PCMK__ATTRD_CMD_UPDATE_BOTH, handle_update_request },
+        { PCMK__OP_SET_TRACE, pcmk__handle_set_trace_request },
         { NULL, handle_unknown_request },
     };
 
@@ -25,6 +25,7 @@
 #include <crm/common/iso8601.h>
 #include <crm/common/ipc.h>
 #include <crm/common/ipc_internal.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/output_internal.h>
 #include <crm/common/xml.h>
 #include <crm/cluster/internal.h>
@@ -188,6 +189,7 @@ main(int argc, char **argv)
     attrd_broadcast_protocol();
 
     attrd_init_ipc();
+    pcmk__metrics_init(crm_system_name);
     crm_notice("Pacemaker node attribute manager successfully started and accepting connections");
     attrd_run_mainloop();
 
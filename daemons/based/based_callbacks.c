@@ -28,6 +28,7 @@
 #include <crm/cluster/internal.h>
 
 #include <crm/common/xml.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/remote_internal.h>
 
 #include <pacemaker-based.h>
@@ -51,6 +52,28 @@ qb_ipcs_service_t *ipcs_ro = NULL;
 qb_ipcs_service_t *ipcs_rw = NULL;
 qb_ipcs_service_t *ipcs_shm = NULL;
 
+/* Requests from read-only IPC clients (as deferred_read_t *) that have not
+ * been processed yet. They are processed one at a time from a low-priority
+ * trigger, so that a burst of (possibly large) queries does not hold up CIB
+ * updates from peers and read-write clients. Read-only clients can only query,
+ * so this never reorders a client's updates relative to its own queries.
+ *
+ * So that a steady stream of updates cannot starve queries, and the queue
+ * cannot grow without bound (the queued copies bypass libqb's flow control),
+ * the oldest query is processed immediately whenever the queue is full or it
+ * has waited too long.
+ */
+#define MAX_DEFERRED_READS      128
+#define MAX_DEFERRED_READ_WAIT  (2 * G_USEC_PER_SEC)
+
+typedef struct {
+    xmlNode *request;   // Copy of request
+    gint64 queued;      // Monotonic time (in microseconds) request was queued
+} deferred_read_t;
+
+static GQueue deferred_reads = G_QUEUE_INIT;
+static crm_trigger_t *deferred_read_trigger = NULL;
+
 static int cib_process_command(xmlNode *request,
                                const cib__operation_t *operation,
                                cib__op_fn_t op_function, xmlNode **reply,
@@ -245,6 +268,129 @@ do_local_notify(const xmlNode *notify_src, const char *client_id,
     }
 }
 
+static void
+free_deferred_read(deferred_read_t *deferred)
+{
+    free_xml(deferred->request);
+    free(deferred);
+}
+
+/*!
+ * \internal
+ * \brief Process the oldest request from a read-only IPC client
+ */
+static void
+process_oldest_deferred_read(void)
+{
+    deferred_read_t *deferred = g_queue_pop_head(&deferred_reads);
+    pcmk__client_t *client = NULL;
+
+    if (deferred == NULL) {
+        return;
+    }
+
+    client = pcmk__find_client_by_id(crm_element_value(deferred->request,
+                                                       PCMK__XA_CIB_CLIENTID));
+    if (client == NULL) {
+        crm_trace("Dropping deferred %s request from disconnected client",
+                  crm_element_value(deferred->request, PCMK__XA_CIB_OP));
+    } else {
+        cib_process_request(deferred->request, FALSE, client);
+    }
+    free_deferred_read(deferred);
+}
+
+/*!
+ * \internal
+ * \brief Process any requests from read-only IPC clients that waited too long
+ */
+static void
+process_overdue_reads(void)
+{
+    gint64 now = g_get_monotonic_time();
+
+    while (!g_queue_is_empty(&deferred_reads)) {
+        const deferred_read_t *oldest = g_queue_peek_head(&deferred_reads);
+
+        if ((now - oldest->queued) < MAX_DEFERRED_READ_WAIT) {
+            break;
+        }
+        crm_trace("Processing overdue %s request from read-only client",
+                  crm_element_value(oldest->request, PCMK__XA_CIB_OP));
+        process_oldest_deferred_read();
+    }
+}
+
+/*!
+ * \internal
+ * \brief Process the oldest request from a read-only IPC client (as trigger)
+ *
+ * \param[in] user_data  Ignored
+ *
+ * \return TRUE (to keep trigger)
+ */
+static int
+process_deferred_read(gpointer user_data)
+{
+    process_oldest_deferred_read();
+
+    if (!g_queue_is_empty(&deferred_reads)) {
+        mainloop_set_trigger(deferred_read_trigger);
+    }
+    return TRUE;
+}
+
+/*!
+ * \internal
+ * \brief Queue a request from a read-only IPC client for later processing
+ *
+ * \param[in] request  Request XML (will be copied)
+ */
+static void
+defer_read(xmlNode *request)
+{
+    deferred_read_t *deferred = NULL;
+
+    if (deferred_read_trigger == NULL) {
+        deferred_read_trigger = mainloop_add_trigger(G_PRIORITY_LOW,
+                                                     process_deferred_read,
+                                                     NULL);
+    }
+
+    process_overdue_reads();
+    if (g_queue_get_length(&deferred_reads) >= MAX_DEFERRED_READS) {
+        crm_trace("Read-only request queue is full, processing oldest now");
+        process_oldest_deferred_read();
+    }
+
+    deferred = pcmk__assert_alloc(1, sizeof(deferred_read_t));
+    deferred->request = pcmk__xml_copy(NULL, request);
+    deferred->queued = g_get_monotonic_time();
+    g_queue_push_tail(&deferred_reads, deferred);
+    mainloop_set_trigger(deferred_read_trigger);
+}
+
+/*!
+ * \internal
+ * \brief Discard any requests from read-only IPC clients not yet processed
+ */
+static void
+discard_deferred_reads(void)
+{
+    if (!g_queue_is_empty(&deferred_reads)) {
+        crm_info("Discarding %u unprocessed request%s from read-only clients",
+                 g_queue_get_length(&deferred_reads),
+                 pcmk__plural_s(g_queue_get_length(&deferred_reads)));
+    }
+    while (!g_queue_is_empty(&deferred_reads)) {
+        free_deferred_read(g_queue_pop_head(&deferred_reads));
+    }
+    if (deferred_read_trigger != NULL) {
+        mainloop_destroy_trigger(deferred_read_trigger);
+        deferred_read_trigger = NULL;
+    }
+}
+
 void
 cib_common_callback_worker(uint32_t id, uint32_t flags, xmlNode * op_request,
                            pcmk__client_t *cib_client, gboolean privileged)
@@ -316,8 +462,33 @@ cib_common_callback_worker(uint32_t id, uint32_t flags, xmlNode * op_request,
 
         pcmk__ipc_send_ack(cib_client, id, flags, PCMK__XE_ACK, NULL, status);
         return;
+
+    } else if (pcmk__str_eq(op, PCMK__OP_SET_TRACE, pcmk__str_none)) {
+        pcmk__request_t request = {
+            .ipc_client     = cib_client,
+            .ipc_id         = id,
+            .ipc_flags      = flags,
+            .peer           = NULL,
+            .xml            = op_request,
+            .call_options   = call_options,
+            .result         = PCMK__UNKNOWN_RESULT,
+        };
+
+        // The handler checks privilege and acknowledges the request
+        request.op = pcmk__str_copy(op);
+        pcmk__handle_set_trace_request(&request);
+        if (!pcmk__result_ok(&request.result)) {
+            crm_warn("%s", request.result.exit_reason);
+        }
+        pcmk__reset_request(&request);
+        return;
     }
 
+    if (!privileged) {
+        defer_read(op_request);
+        return;
+    }
+    process_overdue_reads();
     cib_process_request(op_request, privileged, cib_client);
 }
 
@@ -1030,6 +1201,36 @@ send_peer_reply(xmlNode * msg, xmlNode * result_diff, const char *originator, gb
     return FALSE;
 }
 
+/*!
+ * \internal
+ * \brief Update metrics for a processed CIB request
+ *
+ * \param[in] op        CIB operation name
+ * \param[in] start_ns  Monotonic time (in nanoseconds) processing started
+ * \param[in] rc        Legacy Pacemaker return code of processing
+ */
+static void
+record_request_metrics(const char *op, uint64_t start_ns, int rc)
+{
+    double elapsed = (qb_util_nano_current_get() - start_ns)
+                     / (double) QB_TIME_NS_IN_SEC;
+
+    // The histogram count doubles as the number of requests per operation
+    pcmk__metric_observe(pcmk__metric(pcmk__metric_seconds,
+                                      "pacemaker_cib_request_duration_seconds",
+                                      "Time taken to process CIB requests",
+                                      "op", op),
+                         elapsed);
+
+    if (rc != pcmk_ok) {
+        pcmk__metric_add(pcmk__metric(pcmk__metric_counter,
+                                      "pacemaker_cib_request_failures",
+                                      "CIB requests that failed",
+                                      "op", op),
+                         1);
+    }
+}
+
 /*!
  * \internal
  * \brief Handle an IPC or CPG message containing a request
@@ -1167,9 +1368,11 @@ cib_process_request(xmlNode *request, gboolean privileged,
         const char *admin_epoch_s = NULL;
         const char *epoch_s = NULL;
         const char *num_updates_s = NULL;
+        uint64_t start_ns = qb_util_nano_current_get();
 
         rc = cib_process_command(request, operation, op_function, &op_reply,
                                  &result_diff, privileged);
+        record_request_metrics(op, start_ns, rc);
 
         if (!is_update) {
             level = LOG_TRACE;
@@ -1590,6 +1793,7 @@ cib_peer_callback(xmlNode * msg, void *private_data)
     }
 
     /* crm_log_xml_trace(msg, "Peer[inbound]"); */
+    process_overdue_reads();
     cib_process_request(msg, TRUE, NULL);
     return;
 
@@ -1733,6 +1937,7 @@ terminate_cib(const char *caller, int fast)
         remote_tls_fd = 0;
     }
 
+    discard_deferred_reads();
     uninitializeCib();
 
     if (fast > 0) {
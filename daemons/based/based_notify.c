@@ -108,7 +108,7 @@ cib_notify_send(const xmlNode *xml)
     struct cib_notification_s update;
 
     ssize_t bytes = 0;
-    int rc = pcmk__ipc_prepare_iov(0, xml, 0, &iov, &bytes);
+    int rc = pcmk__ipc_prepare_iov(0, xml, 0, false, &iov, &bytes);
 
     if (rc == pcmk_rc_ok) {
         update.msg = xml;
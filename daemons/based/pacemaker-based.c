@@ -24,6 +24,7 @@
 #include <crm/cluster/internal.h>
 #include <crm/common/cmdline_internal.h>
 #include <crm/common/mainloop.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/output_internal.h>
 #include <crm/common/xml.h>
 
@@ -277,6 +278,7 @@ main(int argc, char **argv)
     cib_init();
 
     // Run the main loop
+    pcmk__metrics_init(crm_system_name);
     mainloop = g_main_loop_new(NULL, FALSE);
     crm_notice("Pacemaker CIB manager successfully started and accepting connections");
     g_main_loop_run(mainloop);
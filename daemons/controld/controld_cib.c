@@ -12,6 +12,7 @@
 #include <unistd.h>  /* sleep */
 
 #include <crm/common/alerts_internal.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/xml.h>
 #include <crm/crm.h>
 #include <crm/lrmd_internal.h>
@@ -21,6 +22,25 @@
 // Call ID of the most recent in-progress CIB resource update (or 0 if none)
 static int pending_rsc_update = 0;
 
+/* Expected results for the local node are coalesced into a single CIB update
+ * for up to this long, so that a burst of results (such as probes when a node
+ * joins) does not cause a CIB commit, diff broadcast, and transition abort for
+ * each one
+ */
+#define HISTORY_BATCH_MS 100
+
+// Coalesced results are recorded immediately once there are this many
+#define HISTORY_BATCH_MAX 250
+
+// Coalesced resource history update for the local node (or NULL if none)
+static xmlNode *pending_history = NULL;
+static xmlNode *pending_resources = NULL; // Within pending_history
+static int pending_history_count = 0;
+static mainloop_timer_t *history_timer = NULL;
+
+static void flush_resource_history(void);
+static void discard_resource_history(void);
+
 /*!
  * \internal
  * \brief Respond to a dropped CIB connection
@@ -104,6 +124,7 @@ controld_disconnect_cib_manager(void)
     crm_debug("Disconnecting from the CIB manager");
 
     controld_clear_fsa_input_flags(R_CIB_CONNECTED);
+    discard_resource_history();
 
     cib_conn->cmds->del_notify_callback(cib_conn, PCMK__VALUE_CIB_DIFF_NOTIFY,
                                         do_cib_updated);
@@ -135,6 +156,9 @@ do_cib_control(long long action,
     CRM_ASSERT(cib_conn != NULL);
 
     if (pcmk_is_set(action, A_CIB_STOP)) {
+        if (cib_conn->state != cib_disconnected) {
+            flush_resource_history();
+        }
         if ((cib_conn->state != cib_disconnected)
             && (pending_rsc_update != 0)) {
 
@@ -373,6 +397,7 @@ controld_delete_node_state(const char *uname, enum controld_section_e section,
 
     CRM_ASSERT((uname != NULL) && (cib != NULL));
 
+    flush_resource_history(); // Deletion must not be undone by older results
     controld_node_state_deletion_strings(uname, section, &xpath, &desc);
 
     cib__set_call_options(options, "node state deletion",
@@ -423,7 +448,8 @@ controld_delete_resource_history(const char *rsc_id, const char *node,
         return ENOTCONN;
     }
 
-    // Ask CIB to delete the entry
+    // Ask CIB to delete the entry (after any older results are recorded)
+    flush_resource_history();
     xpath = crm_strdup_printf(XPATH_RESOURCE_HISTORY, node, rsc_id);
 
     cib->cmds->set_user(cib, user_name);
@@ -859,34 +885,22 @@ controld_update_cib(const char *section, xmlNode *data, int options,
 
 /*!
  * \internal
- * \brief Update resource history entry in CIB
+ * \brief Create the skeleton of a resource history update for a node
  *
- * \param[in]     node_name  Node where action occurred
- * \param[in]     rsc        Resource that action is for
- * \param[in,out] op         Action to record
- * \param[in]     lock_time  If nonzero, when resource was locked to node
+ * \param[in]  node_name  Node where actions occurred
+ * \param[in]  origin     Name of function requesting update (for debugging)
+ * \param[out] resources  Where to store \c PCMK__XE_LRM_RESOURCES element
  *
- * \note On success, the CIB update's call ID will be stored in
- *       pending_rsc_update.
+ * \return Newly created \c PCMK_XE_STATUS element for update
+ * \note The caller is responsible for freeing the result with \c free_xml().
  */
-void
-controld_update_resource_history(const char *node_name,
-                                 const lrmd_rsc_info_t *rsc,
-                                 lrmd_event_data_t *op, time_t lock_time)
+static xmlNode *
+new_history_update(const char *node_name, const char *origin,
+                   xmlNode **resources)
 {
     xmlNode *update = NULL;
     xmlNode *xml = NULL;
-    int call_opt = crmd_cib_smart_opt();
     const char *node_id = NULL;
-    const char *container = NULL;
-
-    CRM_CHECK((node_name != NULL) && (op != NULL), return);
-
-    if (rsc == NULL) {
-        crm_warn("Resource %s no longer exists in the executor", op->rsc_id);
-        controld_ack_event_directly(NULL, NULL, rsc, op, op->rsc_id);
-        return;
-    }
 
     // <status>
     update = pcmk__xe_create(NULL, PCMK_XE_STATUS);
@@ -902,17 +916,41 @@ controld_update_resource_history(const char *node_name,
     }
     crm_xml_add(xml, PCMK_XA_ID, node_id);
     crm_xml_add(xml, PCMK_XA_UNAME, node_name);
-    crm_xml_add(xml, PCMK_XA_CRM_DEBUG_ORIGIN, __func__);
+    crm_xml_add(xml, PCMK_XA_CRM_DEBUG_ORIGIN, origin);
 
     //     <lrm ...>
     xml = pcmk__xe_create(xml, PCMK__XE_LRM);
     crm_xml_add(xml, PCMK_XA_ID, node_id);
 
     //       <lrm_resources>
-    xml = pcmk__xe_create(xml, PCMK__XE_LRM_RESOURCES);
+    *resources = pcmk__xe_create(xml, PCMK__XE_LRM_RESOURCES);
+    return update;
+}
+
+/*!
+ * \internal
+ * \brief Add a resource's history for an action result to an update
+ *
+ * \param[in,out] resources  \c PCMK__XE_LRM_RESOURCES element of update
+ * \param[in]     rsc        Resource that action is for
+ * \param[in,out] op         Action to record
+ * \param[in]     node_name  Node where action occurred
+ * \param[in]     lock_time  If nonzero, when resource was locked to node
+ * \param[in]     origin     Name of function requesting update (for
+ *                           debugging)
+ *
+ * \return Newly added \c PCMK__XE_LRM_RESOURCE element
+ */
+static xmlNode *
+add_resource_history(xmlNode *resources, const lrmd_rsc_info_t *rsc,
+                     lrmd_event_data_t *op, const char *node_name,
+                     time_t lock_time, const char *origin)
+{
+    const char *container = NULL;
 
     //         <lrm_resource ...>
-    xml = pcmk__xe_create(xml, PCMK__XE_LRM_RESOURCE);
+    xmlNode *xml = pcmk__xe_create(resources, PCMK__XE_LRM_RESOURCE);
+
     crm_xml_add(xml, PCMK_XA_ID, op->rsc_id);
     crm_xml_add(xml, PCMK_XA_CLASS, rsc->standard);
     crm_xml_add(xml, PCMK_XA_PROVIDER, rsc->provider);
@@ -937,14 +975,207 @@ controld_update_resource_history(const char *node_name,
     }
 
     //           <lrm_resource_op ...> (possibly more than one)
-    controld_add_resource_history_xml(xml, rsc, op, node_name);
+    controld_add_resource_history_xml_as(origin, xml, rsc, op, node_name);
+    return xml;
+}
 
+/*!
+ * \internal
+ * \brief Request a resource history update from the CIB manager
+ *
+ * \param[in] update  \c PCMK_XE_STATUS element of update
+ */
+static void
+send_history_update(xmlNode *update)
+{
     /* Update CIB asynchronously. Even if it fails, the resource state should be
      * discovered during the next election. Worst case, the node is wrongly
      * fenced for running a resource it isn't.
      */
     crm_log_xml_trace(update, __func__);
-    controld_update_cib(PCMK_XE_STATUS, update, call_opt, cib_rsc_callback);
+    controld_update_cib(PCMK_XE_STATUS, update, crmd_cib_smart_opt(),
+                        cib_rsc_callback);
+    pcmk__metric_add(pcmk__metric_counter("pacemaker_resource_history_updates",
+                                          "Resource history updates requested "
+                                          "from the CIB manager"), 1);
+}
+
+/*!
+ * \internal
+ * \brief Fold a resource's new history into its earlier coalesced history
+ *
+ * \param[in,out] resources  \c PCMK__XE_LRM_RESOURCES element of update
+ * \param[in,out] rsc_xml    Newly added \c PCMK__XE_LRM_RESOURCE child of
+ *                           \p resources (will be freed if folded)
+ */
+static void
+merge_resource_history(xmlNode *resources, xmlNode *rsc_xml)
+{
+    xmlNode *existing = pcmk__xe_first_child(resources, PCMK__XE_LRM_RESOURCE,
+                                             PCMK_XA_ID, pcmk__xe_id(rsc_xml));
+
+    if (existing == rsc_xml) {
+        return; // No earlier results for this resource
+    }
+
+    // Newer values replace older ones, as separate CIB updates would
+    pcmk__xe_copy_attrs(existing, rsc_xml, pcmk__xaf_none);
+
+    for (xmlNode *op = pcmk__xe_first_child(rsc_xml, PCMK__XE_LRM_RSC_OP, NULL,
+                                            NULL);
+         op != NULL; op = pcmk__xe_next_same(op)) {
+
+        xmlNode *old_op = pcmk__xe_first_child(existing, PCMK__XE_LRM_RSC_OP,
+                                               PCMK_XA_ID, pcmk__xe_id(op));
+
+        if (old_op == NULL) {
+            pcmk__xml_copy(existing, op);
+        } else {
+            pcmk__xe_copy_attrs(old_op, op, pcmk__xaf_none);
+        }
+    }
+    free_xml(rsc_xml);
+}
+
+/*!
+ * \internal
+ * \brief Record any coalesced resource history in the CIB now
+ */
+static void
+flush_resource_history(void)
+{
+    if (pending_history == NULL) {
+        return;
+    }
+    mainloop_timer_stop(history_timer);
+
+    crm_debug("Recording %d coalesced resource history result%s in CIB",
+              pending_history_count, pcmk__plural_s(pending_history_count));
+    send_history_update(pending_history);
+
+    free_xml(pending_history);
+    pending_history = NULL;
+    pending_resources = NULL;
+    pending_history_count = 0;
+}
+
+/*!
+ * \internal
+ * \brief Record coalesced resource history when the batch window ends
+ *
+ * \param[in] user_data  Ignored
+ *
+ * \return FALSE (to not repeat timer)
+ */
+static gboolean
+history_timer_cb(gpointer user_data)
+{
+    flush_resource_history();
+    return FALSE;
+}
+
+/*!
+ * \internal
+ * \brief Drop any coalesced resource history without recording it
+ */
+static void
+discard_resource_history(void)
+{
+    if (pending_history != NULL) {
+        crm_warn("Discarding %d resource history result%s not yet recorded "
+                 "in CIB", pending_history_count,
+                 pcmk__plural_s(pending_history_count));
+        free_xml(pending_history);
+        pending_history = NULL;
+        pending_resources = NULL;
+        pending_history_count = 0;
+    }
+    if (history_timer != NULL) {
+        mainloop_timer_del(history_timer);
+        history_timer = NULL;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Check whether an action result can wait to be recorded
+ *
+ * \param[in] node_name  Node where action occurred
+ * \param[in] op         Action result
+ *
+ * \return true if \p op is an expected (or pending) result on the local node,
+ *         otherwise false
+ */
+static bool
+can_coalesce_history(const char *node_name, lrmd_event_data_t *op)
+{
+    return pcmk__str_eq(node_name, controld_globals.our_nodename,
+                        pcmk__str_casei)
+           && !did_rsc_op_fail(op, rsc_op_expected_rc(op));
+}
+
+/*!
+ * \internal
+ * \brief Update resource history entry in CIB
+ *
+ * Expected results on the local node may be coalesced with others for a short
+ * time before being recorded. Anything else is recorded immediately, along with
+ * any coalesced results, so results are always recorded in order.
+ *
+ * \param[in]     node_name  Node where action occurred
+ * \param[in]     rsc        Resource that action is for
+ * \param[in,out] op         Action to record
+ * \param[in]     lock_time  If nonzero, when resource was locked to node
+ *
+ * \note On success, the CIB update's call ID will be stored in
+ *       pending_rsc_update.
+ */
+void
+controld_update_resource_history(const char *node_name,
+                                 const lrmd_rsc_info_t *rsc,
+                                 lrmd_event_data_t *op, time_t lock_time)
+{
+    xmlNode *update = NULL;
+    xmlNode *resources = NULL;
+
+    CRM_CHECK((node_name != NULL) && (op != NULL), return);
+
+    if (rsc == NULL) {
+        crm_warn("Resource %s no longer exists in the executor", op->rsc_id);
+        controld_ack_event_directly(NULL, NULL, rsc, op, op->rsc_id);
+        return;
+    }
+
+    if (can_coalesce_history(node_name, op)) {
+        if (pending_history == NULL) {
+            pending_history = new_history_update(node_name, __func__,
+                                                 &pending_resources);
+            if (history_timer == NULL) {
+                history_timer = mainloop_timer_add("controld_history_batch",
+                                                   HISTORY_BATCH_MS, false,
+                                                   history_timer_cb, NULL);
+            }
+            mainloop_timer_start(history_timer);
+        }
+        merge_resource_history(pending_resources,
+                               add_resource_history(pending_resources, rsc, op,
+                                                    node_name, lock_time,
+                                                    __func__));
+        if (++pending_history_count >= HISTORY_BATCH_MAX) {
+            flush_resource_history();
+        }
+        return;
+    }
+
+    if (pcmk__str_eq(node_name, controld_globals.our_nodename,
+                     pcmk__str_casei)) {
+        // Keep this node's results in order
+        flush_resource_history();
+    }
+
+    update = new_history_update(node_name, __func__, &resources);
+    add_resource_history(resources, rsc, op, node_name, lock_time, __func__);
+    send_history_update(update);
     free_xml(update);
 }
 
@@ -976,6 +1207,8 @@ controld_delete_action_history(const lrmd_event_data_t *op)
     crm_debug("Erasing resource operation history for " PCMK__OP_FMT " (call=%d)",
               op->rsc_id, op->op_type, op->interval_ms, op->call_id);
 
+    flush_resource_history(); // Deletion must not be undone by older results
+
     controld_globals.cib_conn->cmds->remove(controld_globals.cib_conn,
                                             PCMK_XE_STATUS, xml_top, cib_none);
     crm_log_xml_trace(xml_top, "op:cancel");
@@ -1032,6 +1265,7 @@ controld_cib_delete_last_failure(const char *rsc_id, const char *node,
     }
     free(last_failure_key);
 
+    flush_resource_history(); // Deletion must not be undone by older results
     controld_globals.cib_conn->cmds->remove(controld_globals.cib_conn, xpath,
                                             NULL, cib_xpath);
     free(xpath);
@@ -1060,6 +1294,7 @@ controld_delete_action_history_by_key(const char *rsc_id, const char *node,
     } else {
         xpath = crm_strdup_printf(XPATH_HISTORY_ID, node, rsc_id, key);
     }
+    flush_resource_history(); // Deletion must not be undone by older results
     controld_globals.cib_conn->cmds->remove(controld_globals.cib_conn, xpath,
                                             NULL, cib_xpath);
     free(xpath);
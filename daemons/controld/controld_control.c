@@ -232,6 +232,7 @@ crmd_exit(crm_exit_t exit_code)
 
     verify_stopped(controld_globals.fsa_state, LOG_WARNING);
     controld_clear_fsa_input_flags(R_LRM_CONNECTED);
+    controld_free_probe_batches();
     lrm_state_destroy_all();
 
     mainloop_destroy_trigger(config_read_trigger);
@@ -610,6 +611,9 @@ config_query_callback(xmlNode * msg, int call_id, int rc, xmlNode * output, void
     controld_set_fsa_input_flags(R_READ_CONFIG);
     controld_trigger_fsa();
 
+    // Now that the CIB is known to be readable, start fetching agent meta-data
+    controld_prewarm_metadata();
+
     g_hash_table_destroy(config_hash);
   bail:
     crm_time_free(now);
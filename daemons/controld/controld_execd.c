@@ -398,6 +398,7 @@ lrm_state_verify_stopped(lrm_state_t * lrm_state, enum crmd_fsa_state cur_state,
     const char *key = NULL;
     rsc_history_t *entry = NULL;
     active_op_t *pending = NULL;
+    int unacknowledged = 0;
 
     crm_debug("Checking for active resources before exit");
 
@@ -431,9 +432,26 @@ lrm_state_verify_stopped(lrm_state_t * lrm_state, enum crmd_fsa_state cur_state,
         }
     }
 
+    /* Actions requested from a remote executor without waiting for its reply
+     * are not active operations until the reply arrives, but they may already
+     * be running
+     */
+    if (!lrm_state_is_local(lrm_state) && (lrm_state->conn != NULL)) {
+        const lrmd__remote_stats_t *stats = lrmd__remote_stats(lrm_state->conn);
+
+        if (stats != NULL) {
+            unacknowledged = stats->outstanding;
+            counter += unacknowledged;
+        }
+    }
+
     if (counter > 0) {
         do_crm_log(log_level, "%d pending executor operation%s at %s",
                    counter, pcmk__plural_s(counter), when);
+        if (unacknowledged > 0) {
+            do_crm_log(log_level, "%d of them not yet acknowledged by %s",
+                       unacknowledged, lrm_state->node_name);
+        }
 
         if ((cur_state == S_TERMINATE)
             || !pcmk_is_set(controld_globals.fsa_input_register,
@@ -1558,12 +1576,11 @@ do_lrm_invoke(long long action,
             struct ra_metadata_s *md = NULL;
 
             /* Getting metadata from cache is OK except for start actions --
-             * always refresh from the agent for those, in case the resource
-             * agent was updated.
-             *
-             * @TODO Only refresh metadata for starts if the agent actually
-             * changed (using something like inotify, or a hash or modification
-             * time of the agent executable).
+             * always refresh for those, in case the resource agent was
+             * updated. For most agents, this refresh is answered immediately
+             * from the on-disk meta-data cache, which is keyed by the agent
+             * executable's modification time, size, and inode, so the agent
+             * is executed only if it actually changed.
              */
             if (strcmp(operation, PCMK_ACTION_START) != 0) {
                 md = controld_get_rsc_metadata(lrm_state, rsc,
@@ -1913,6 +1930,369 @@ should_nack_action(const char *action)
     return NULL;
 }
 
+/*!
+ * \internal
+ * \brief Track a resource action that the executor has accepted
+ *
+ * All actions are recorded so that we can wait for them to complete during
+ * shutdown.
+ *
+ * \param[in,out] lrm_state  Executor state for node where action is executing
+ * \param[in]     rsc        Resource that action is for
+ * \param[in,out] op         Action (its parameters will be taken)
+ * \param[in]     call_id    Call ID that executor assigned to \p op
+ * \param[in]     lock_time  If nonzero, when resource was locked to node
+ */
+static void
+record_active_op(lrm_state_t *lrm_state, const lrmd_rsc_info_t *rsc,
+                 lrmd_event_data_t *op, int call_id, time_t lock_time)
+{
+    char *op_id = pcmk__op_key(rsc->id, op->op_type, op->interval_ms);
+    char *call_id_s = make_stop_id(rsc->id, call_id);
+    active_op_t *pending = pcmk__assert_alloc(1, sizeof(active_op_t));
+
+    crm_trace("Recording pending op: %d - %s %s", call_id, op_id, call_id_s);
+
+    pending->call_id = call_id;
+    pending->interval_ms = op->interval_ms;
+    pending->op_type = pcmk__str_copy(op->op_type);
+    pending->op_key = op_id;
+    pending->rsc_id = pcmk__str_copy(rsc->id);
+    pending->start_time = time(NULL);
+    pending->user_data = pcmk__str_copy(op->user_data);
+    pending->lock_time = lock_time;
+    g_hash_table_replace(lrm_state->active_ops, call_id_s, pending);
+
+    if ((op->interval_ms > 0)
+        && (op->start_delay > START_DELAY_THRESHOLD)) {
+        int target_rc = PCMK_OCF_OK;
+
+        crm_info("Faking confirmation of %s: execution postponed for over "
+                 "5 minutes", op_id);
+        decode_transition_key(op->user_data, NULL, NULL, NULL, &target_rc);
+        lrmd__set_result(op, target_rc, PCMK_EXEC_DONE, NULL);
+        controld_ack_event_directly(NULL, NULL, rsc, op, rsc->id);
+    }
+
+    pending->params = op->params;
+    op->params = NULL;
+}
+
+/*!
+ * \internal
+ * \brief Record the failure of a resource action to be initiated
+ *
+ * \param[in,out] lrm_state  Executor state for node where action was requested
+ *                           (or NULL if it no longer exists)
+ * \param[in]     rsc_id     ID of resource that action is for
+ * \param[in,out] op         Action that could not be initiated
+ * \param[in]     rc         Standard Pacemaker return code for failure
+ */
+static void
+exec_failed(lrm_state_t *lrm_state, const char *rsc_id, lrmd_event_data_t *op,
+            int rc)
+{
+    fsa_data_t *msg_data = NULL;
+
+    if (lrm_state == NULL) {
+        /* The result can't be recorded in the resource history, but it will
+         * be acknowledged directly, so the transition doesn't wait for it
+         */
+        crm_err("Could not initiate %s action for resource %s because its "
+                "executor state is gone: %s " CRM_XS " rc=%d",
+                op->op_type, rsc_id, pcmk_rc_str(rc), rc);
+        fake_op_status(NULL, op, PCMK_EXEC_NOT_CONNECTED,
+                       PCMK_OCF_UNKNOWN_ERROR, pcmk_rc_str(rc));
+        process_lrm_event(NULL, op, NULL, NULL);
+
+    } else if (lrm_state_is_local(lrm_state)) {
+        crm_err("Could not initiate %s action for resource %s locally: %s "
+                CRM_XS " rc=%d", op->op_type, rsc_id, pcmk_rc_str(rc), rc);
+        fake_op_status(lrm_state, op, PCMK_EXEC_NOT_CONNECTED,
+                       PCMK_OCF_UNKNOWN_ERROR, pcmk_rc_str(rc));
+        process_lrm_event(lrm_state, op, NULL, NULL);
+        register_fsa_error(C_FSA_INTERNAL, I_FAIL, NULL);
+
+    } else {
+        crm_err("Could not initiate %s action for resource %s remotely on %s: "
+                "%s " CRM_XS " rc=%d",
+                op->op_type, rsc_id, lrm_state->node_name, pcmk_rc_str(rc),
+                rc);
+        fake_op_status(lrm_state, op, PCMK_EXEC_NOT_CONNECTED,
+                       PCMK_OCF_UNKNOWN_ERROR, pcmk_rc_str(rc));
+        process_lrm_event(lrm_state, op, NULL, NULL);
+    }
+}
+
+/* Probes (such as those for every resource when a node joins or is reprobed)
+ * are sent to the executor in batches, so that a burst of them needs only one
+ * request per executor connection. The executor limits how many run at once.
+ * Batches are sent once the mainloop is otherwise idle (or they get large).
+ */
+#define PROBE_BATCH_MAX 250
+
+// Probe waiting to be sent to the executor
+typedef struct {
+    lrmd_rsc_info_t *rsc;
+    lrmd_event_data_t *op;
+    time_t lock_time;       // If nonzero, when resource was locked to node
+} batched_probe_t;
+
+static GHashTable *probe_batches = NULL; // Node name -> GPtrArray of probes
+static crm_trigger_t *probe_batch_trigger = NULL;
+
+static void
+free_batched_probe(gpointer data)
+{
+    batched_probe_t *probe = data;
+
+    lrmd_free_rsc_info(probe->rsc);
+    lrmd_free_event(probe->op);
+    free(probe);
+}
+
+/*!
+ * \internal
+ * \brief Send a batch of probes to an executor
+ *
+ * \param[in,out] lrm_state  Executor state for node where probes should run
+ * \param[in,out] batch      Probes to send
+ */
+static void
+exec_probe_batch(lrm_state_t *lrm_state, GPtrArray *batch)
+{
+    int rc = pcmk_rc_ok;
+    lrmd__exec_request_t *requests = NULL;
+
+    requests = pcmk__assert_alloc(batch->len, sizeof(lrmd__exec_request_t));
+    for (guint i = 0; i < batch->len; i++) {
+        const batched_probe_t *probe = g_ptr_array_index(batch, i);
+
+        requests[i].rsc_id = probe->rsc->id;
+        requests[i].action = probe->op->op_type;
+        requests[i].userdata = probe->op->user_data;
+        requests[i].interval_ms = probe->op->interval_ms;
+        requests[i].timeout = probe->op->timeout;
+        requests[i].start_delay = probe->op->start_delay;
+        requests[i].params = probe->op->params;
+    }
+
+    crm_debug("Requesting %u probe%s on %s",
+              batch->len, pcmk__plural_s(batch->len), lrm_state->node_name);
+    rc = controld_execute_batch(lrm_state, requests, (int) batch->len);
+
+    for (guint i = 0; i < batch->len; i++) {
+        batched_probe_t *probe = g_ptr_array_index(batch, i);
+        int call_id = requests[i].call_id;
+        int probe_rc = rc;
+
+        if (rc == EOPNOTSUPP) {
+            // Executor is too old for batches
+            probe_rc = controld_execute_resource_agent(lrm_state,
+                                                       probe->rsc->id,
+                                                       probe->op->op_type,
+                                                       probe->op->user_data,
+                                                       probe->op->interval_ms,
+                                                       probe->op->timeout,
+                                                       probe->op->start_delay,
+                                                       probe->op->params,
+                                                       &call_id);
+
+        } else if ((rc == pcmk_rc_ok) && (call_id < 0)) {
+            probe_rc = pcmk_legacy2rc(call_id);
+        }
+
+        if (probe_rc == pcmk_rc_ok) {
+            record_active_op(lrm_state, probe->rsc, probe->op, call_id,
+                             probe->lock_time);
+        } else {
+            exec_failed(lrm_state, probe->rsc->id, probe->op, probe_rc);
+        }
+    }
+    free(requests);
+}
+
+/*!
+ * \internal
+ * \brief Send all batched probes to their executors
+ *
+ * \param[in] user_data  Ignored
+ *
+ * \return TRUE (to keep trigger)
+ */
+static gboolean
+flush_probe_batches(gpointer user_data)
+{
+    GHashTable *batches = probe_batches;
+    GHashTableIter iter;
+    const char *node_name = NULL;
+    GPtrArray *batch = NULL;
+
+    if (batches == NULL) {
+        return TRUE;
+    }
+
+    // Failure handling could queue more probes, so start a new table for them
+    probe_batches = NULL;
+
+    g_hash_table_iter_init(&iter, batches);
+    while (g_hash_table_iter_next(&iter, (gpointer *) &node_name,
+                                  (gpointer *) &batch)) {
+        lrm_state_t *lrm_state = lrm_state_find(node_name);
+
+        if (lrm_state == NULL) {
+            /* The probes were already recorded as pending, so fail them now
+             * rather than let the transition wait for them to time out
+             */
+            for (guint i = 0; i < batch->len; i++) {
+                batched_probe_t *probe = g_ptr_array_index(batch, i);
+
+                exec_failed(NULL, probe->rsc->id, probe->op, ENOTCONN);
+            }
+            continue;
+        }
+        exec_probe_batch(lrm_state, batch);
+    }
+    g_hash_table_destroy(batches);
+    return TRUE;
+}
+
+/*!
+ * \internal
+ * \brief Queue a probe to be sent to the executor in a batch
+ *
+ * \param[in,out] lrm_state  Executor state for node where probe should run
+ * \param[in]     rsc        Resource to probe
+ * \param[in,out] op         Probe (the queue takes ownership)
+ * \param[in]     lock_time  If nonzero, when resource was locked to node
+ */
+static void
+queue_probe(lrm_state_t *lrm_state, lrmd_rsc_info_t *rsc,
+            lrmd_event_data_t *op, time_t lock_time)
+{
+    GPtrArray *batch = NULL;
+    batched_probe_t *probe = pcmk__assert_alloc(1, sizeof(batched_probe_t));
+
+    probe->rsc = lrmd_copy_rsc_info(rsc);
+    probe->op = op;
+    probe->lock_time = lock_time;
+
+    if (probe_batches == NULL) {
+        probe_batches = pcmk__strikey_table(free,
+                                            (GDestroyNotify) g_ptr_array_unref);
+    }
+    batch = g_hash_table_lookup(probe_batches, lrm_state->node_name);
+    if (batch == NULL) {
+        batch = g_ptr_array_new_with_free_func(free_batched_probe);
+        g_hash_table_insert(probe_batches,
+                            pcmk__str_copy(lrm_state->node_name), batch);
+    }
+    g_ptr_array_add(batch, probe);
+
+    if (batch->len >= PROBE_BATCH_MAX) {
+        flush_probe_batches(NULL);
+        return;
+    }
+
+    if (probe_batch_trigger == NULL) {
+        probe_batch_trigger = mainloop_add_trigger(G_PRIORITY_LOW,
+                                                   flush_probe_batches, NULL);
+    }
+    mainloop_set_trigger(probe_batch_trigger);
+}
+
+/*!
+ * \internal
+ * \brief Free any batched probes that have not been sent
+ */
+void
+controld_free_probe_batches(void)
+{
+    if (probe_batches != NULL) {
+        g_hash_table_destroy(probe_batches);
+        probe_batches = NULL;
+    }
+    if (probe_batch_trigger != NULL) {
+        mainloop_destroy_trigger(probe_batch_trigger);
+        probe_batch_trigger = NULL;
+    }
+}
+
+/* For Pacemaker Remote nodes, non-recurring actions are sent without waiting
+ * for the executor's reply, so that a remote node with a long round-trip time
+ * does not stall the controller (and every other node's actions) once per
+ * action. The reply is handled whenever it arrives.
+ */
+
+// Action sent to a remote executor whose reply has not yet arrived
+typedef struct {
+    char *node_name;
+    lrmd_rsc_info_t *rsc;
+    lrmd_event_data_t *op;
+    time_t lock_time;       // If nonzero, when resource was locked to node
+} async_exec_t;
+
+/*!
+ * \internal
+ * \brief Record the result of an asynchronous execution request
+ *
+ * \param[in]     rc         Call ID on success, otherwise negative errno
+ * \param[in,out] user_data  Action that was requested (will be freed)
+ */
+static void
+async_exec_cb(int rc, void *user_data)
+{
+    async_exec_t *exec = user_data;
+    lrm_state_t *lrm_state = lrm_state_find(exec->node_name);
+
+    if (lrm_state == NULL) {
+        // The action can't be tracked, so don't let the transition wait for it
+        exec_failed(NULL, exec->rsc->id, exec->op, ENOTCONN);
+
+    } else if (rc >= 0) {
+        record_active_op(lrm_state, exec->rsc, exec->op, rc, exec->lock_time);
+
+    } else {
+        exec_failed(lrm_state, exec->rsc->id, exec->op, pcmk_legacy2rc(rc));
+    }
+
+    free(exec->node_name);
+    lrmd_free_rsc_info(exec->rsc);
+    lrmd_free_event(exec->op);
+    free(exec);
+}
+
+/*!
+ * \internal
+ * \brief Request a resource action on a remote node without awaiting a reply
+ *
+ * \param[in,out] lrm_state  Executor state for node where action should run
+ * \param[in]     rsc        Resource to execute action for
+ * \param[in,out] op         Action to execute (will be taken)
+ * \param[in]     lock_time  If nonzero, when resource was locked to node
+ */
+static void
+exec_async(lrm_state_t *lrm_state, lrmd_rsc_info_t *rsc,
+           lrmd_event_data_t *op, time_t lock_time)
+{
+    int rc = pcmk_rc_ok;
+    async_exec_t *exec = pcmk__assert_alloc(1, sizeof(async_exec_t));
+
+    exec->node_name = pcmk__str_copy(lrm_state->node_name);
+    exec->rsc = lrmd_copy_rsc_info(rsc);
+    exec->op = op;
+    exec->lock_time = lock_time;
+
+    rc = controld_execute_resource_agent_async(lrm_state, rsc->id,
+                                               op->op_type, op->user_data,
+                                               op->interval_ms, op->timeout,
+                                               op->start_delay, op->params,
+                                               async_exec_cb, exec);
+    if (rc != pcmk_rc_ok) {
+        async_exec_cb(pcmk_rc2legacy(rc), exec);
+    }
+}
+
 static void
 do_lrm_rsc_op(lrm_state_t *lrm_state, lrmd_rsc_info_t *rsc, xmlNode *msg,
               struct ra_metadata_s *md)
@@ -1920,8 +2300,8 @@ do_lrm_rsc_op(lrm_state_t *lrm_state, lrmd_rsc_info_t *rsc, xmlNode *msg,
     int rc;
     int call_id = 0;
     char *op_id = NULL;
+    time_t lock_time = 0;
     lrmd_event_data_t *op = NULL;
-    fsa_data_t *msg_data = NULL;
     const char *transition = NULL;
     const char *operation = NULL;
     const char *nack_reason = NULL;
@@ -2001,17 +2381,33 @@ do_lrm_rsc_op(lrm_state_t *lrm_state, lrmd_rsc_info_t *rsc, xmlNode *msg,
                          nack_reason);
         controld_ack_event_directly(NULL, NULL, rsc, op, rsc->id);
         lrmd_free_event(op);
-        free(op_id);
         return;
     }
 
     controld_record_pending_op(lrm_state->node_name, rsc, op);
 
-    op_id = pcmk__op_key(rsc->id, op->op_type, op->interval_ms);
+    if (crm_element_value_epoch(msg, PCMK_OPT_SHUTDOWN_LOCK,
+                                &lock_time) != pcmk_ok) {
+        lock_time = 0;
+    }
+
+    if (pcmk_is_probe(op->op_type, op->interval_ms)
+        && !is_remote_lrmd_ra(NULL, NULL, rsc->id)) {
+        queue_probe(lrm_state, rsc, op, lock_time);
+        return;
+    }
+
+    if ((op->interval_ms == 0) && !lrm_state_is_local(lrm_state)
+        && !is_remote_lrmd_ra(NULL, NULL, rsc->id)) {
+        exec_async(lrm_state, rsc, op, lock_time);
+        return;
+    }
 
     if (op->interval_ms > 0) {
         /* cancel it so we can then restart it without conflict */
+        op_id = pcmk__op_key(rsc->id, op->op_type, op->interval_ms);
         cancel_op_key(lrm_state, rsc, op_id, FALSE);
+        free(op_id);
     }
 
     rc = controld_execute_resource_agent(lrm_state, rsc->id, op->op_type,
@@ -2019,59 +2415,10 @@ do_lrm_rsc_op(lrm_state_t *lrm_state, lrmd_rsc_info_t *rsc, xmlNode *msg,
                                          op->timeout, op->start_delay,
                                          op->params, &call_id);
     if (rc == pcmk_rc_ok) {
-        /* record all operations so we can wait
-         * for them to complete during shutdown
-         */
-        char *call_id_s = make_stop_id(rsc->id, call_id);
-        active_op_t *pending = NULL;
-
-        pending = pcmk__assert_alloc(1, sizeof(active_op_t));
-        crm_trace("Recording pending op: %d - %s %s", call_id, op_id, call_id_s);
-
-        pending->call_id = call_id;
-        pending->interval_ms = op->interval_ms;
-        pending->op_type = pcmk__str_copy(operation);
-        pending->op_key = pcmk__str_copy(op_id);
-        pending->rsc_id = pcmk__str_copy(rsc->id);
-        pending->start_time = time(NULL);
-        pending->user_data = pcmk__str_copy(op->user_data);
-        if (crm_element_value_epoch(msg, PCMK_OPT_SHUTDOWN_LOCK,
-                                    &(pending->lock_time)) != pcmk_ok) {
-            pending->lock_time = 0;
-        }
-        g_hash_table_replace(lrm_state->active_ops, call_id_s, pending);
-
-        if ((op->interval_ms > 0)
-            && (op->start_delay > START_DELAY_THRESHOLD)) {
-            int target_rc = PCMK_OCF_OK;
-
-            crm_info("Faking confirmation of %s: execution postponed for over 5 minutes", op_id);
-            decode_transition_key(op->user_data, NULL, NULL, NULL, &target_rc);
-            lrmd__set_result(op, target_rc, PCMK_EXEC_DONE, NULL);
-            controld_ack_event_directly(NULL, NULL, rsc, op, rsc->id);
-        }
-
-        pending->params = op->params;
-        op->params = NULL;
-
-    } else if (lrm_state_is_local(lrm_state)) {
-        crm_err("Could not initiate %s action for resource %s locally: %s "
-                CRM_XS " rc=%d", operation, rsc->id, pcmk_rc_str(rc), rc);
-        fake_op_status(lrm_state, op, PCMK_EXEC_NOT_CONNECTED,
-                       PCMK_OCF_UNKNOWN_ERROR, pcmk_rc_str(rc));
-        process_lrm_event(lrm_state, op, NULL, NULL);
-        register_fsa_error(C_FSA_INTERNAL, I_FAIL, NULL);
-
+        record_active_op(lrm_state, rsc, op, call_id, lock_time);
     } else {
-        crm_err("Could not initiate %s action for resource %s remotely on %s: "
-                "%s " CRM_XS " rc=%d",
-                operation, rsc->id, lrm_state->node_name, pcmk_rc_str(rc), rc);
-        fake_op_status(lrm_state, op, PCMK_EXEC_NOT_CONNECTED,
-                       PCMK_OCF_UNKNOWN_ERROR, pcmk_rc_str(rc));
-        process_lrm_event(lrm_state, op, NULL, NULL);
+        exec_failed(lrm_state, rsc->id, op, rc);
     }
-
-    free(op_id);
     lrmd_free_event(op);
 }
 
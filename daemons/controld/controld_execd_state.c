@@ -338,6 +338,23 @@ lrm_state_disconnect_only(lrm_state_t * lrm_state)
     }
     crm_trace("Disconnecting %s", lrm_state->node_name);
 
+    if (!lrm_state_is_local(lrm_state)) {
+        const lrmd__remote_stats_t *stats = lrmd__remote_stats(lrm_state->conn);
+
+        if ((stats != NULL) && (stats->replies > 0)) {
+            crm_info("Executor connection to %s had %llu replies "
+                     "(average %llums, maximum %llums round trip), at most %d "
+                     "requests in flight, and %u of %u TLS handshakes resumed",
+                     lrm_state->node_name,
+                     (unsigned long long) stats->replies,
+                     (unsigned long long) (stats->total_us / stats->replies
+                                           / 1000),
+                     (unsigned long long) (stats->max_us / 1000),
+                     stats->max_outstanding, stats->resumed,
+                     stats->handshakes);
+        }
+    }
+
     remote_proxy_disconnect_by_node(lrm_state->node_name);
 
     ((lrmd_t *) lrm_state->conn)->cmds->disconnect(lrm_state->conn);
@@ -722,21 +739,11 @@ lrm_state_get_rsc_info(lrm_state_t * lrm_state, const char *rsc_id, enum lrmd_ca
  *
  * \return Standard Pacemaker return code
  */
-int
-controld_execute_resource_agent(lrm_state_t *lrm_state, const char *rsc_id,
-                                const char *action, const char *userdata,
-                                guint interval_ms, int timeout_ms,
-                                int start_delay_ms, GHashTable *parameters,
-                                int *call_id)
+static lrmd_key_value_t *
+params_to_list(GHashTable *parameters)
 {
-    int rc = pcmk_rc_ok;
     lrmd_key_value_t *params = NULL;
 
-    if (lrm_state->conn == NULL) {
-        return ENOTCONN;
-    }
-
-    // Convert parameters from hash table to list
     if (parameters != NULL) {
         const char *key = NULL;
         const char *value = NULL;
@@ -748,6 +755,24 @@ controld_execute_resource_agent(lrm_state_t *lrm_state, const char *rsc_id,
             params = lrmd_key_value_add(params, key, value);
         }
     }
+    return params;
+}
+
+int
+controld_execute_resource_agent(lrm_state_t *lrm_state, const char *rsc_id,
+                                const char *action, const char *userdata,
+                                guint interval_ms, int timeout_ms,
+                                int start_delay_ms, GHashTable *parameters,
+                                int *call_id)
+{
+    int rc = pcmk_rc_ok;
+    lrmd_key_value_t *params = NULL;
+
+    if (lrm_state->conn == NULL) {
+        return ENOTCONN;
+    }
+
+    params = params_to_list(parameters);
 
     if (is_remote_lrmd_ra(NULL, NULL, rsc_id)) {
         rc = controld_execute_remote_agent(lrm_state, rsc_id, action,
@@ -771,6 +796,67 @@ controld_execute_resource_agent(lrm_state_t *lrm_state, const char *rsc_id,
     return rc;
 }
 
+/*!
+ * \internal
+ * \brief Request execution of a resource action without awaiting the reply
+ *
+ * \param[in,out] lrm_state       Executor state to execute action with
+ * \param[in]     rsc_id          ID of resource for action
+ * \param[in]     action          Action to execute
+ * \param[in]     userdata        String to copy and pass to execution callback
+ * \param[in]     interval_ms     Action interval (in milliseconds)
+ * \param[in]     timeout_ms      Action timeout (in milliseconds)
+ * \param[in]     start_delay_ms  Delay (in ms) before initiating action
+ * \param[in]     parameters      Hash table of resource parameters
+ * \param[in]     callback        Function to call with call ID (or negative
+ *                                errno) once executor replies
+ * \param[in]     user_data       Data to pass to \p callback
+ *
+ * \return Standard Pacemaker return code (if not \c pcmk_rc_ok, \p callback
+ *         will not be called)
+ * \note Remote connection resources must not be executed this way.
+ */
+int
+controld_execute_resource_agent_async(lrm_state_t *lrm_state,
+                                      const char *rsc_id, const char *action,
+                                      const char *userdata, guint interval_ms,
+                                      int timeout_ms, int start_delay_ms,
+                                      GHashTable *parameters,
+                                      void (*callback)(int, void *),
+                                      void *user_data)
+{
+    if (lrm_state->conn == NULL) {
+        return ENOTCONN;
+    }
+    return lrmd__exec_async(lrm_state->conn, rsc_id, action, userdata,
+                            interval_ms, timeout_ms, start_delay_ms,
+                            lrmd_opt_notify_changes_only,
+                            params_to_list(parameters), callback, user_data);
+}
+
+/*!
+ * \internal
+ * \brief Request execution of several resource actions with one request
+ *
+ * \param[in,out] lrm_state   Executor state to execute actions with
+ * \param[in,out] requests    Actions to execute (see \c lrmd__exec_batch())
+ * \param[in]     n_requests  Number of entries in \p requests
+ *
+ * \return Standard Pacemaker return code (\c EOPNOTSUPP if the executor does
+ *         not support batches)
+ * \note Remote connection resources must not be included in \p requests.
+ */
+int
+controld_execute_batch(lrm_state_t *lrm_state, lrmd__exec_request_t *requests,
+                       int n_requests)
+{
+    if (lrm_state->conn == NULL) {
+        return ENOTCONN;
+    }
+    return lrmd__exec_batch(lrm_state->conn, requests, n_requests,
+                            lrmd_opt_notify_changes_only);
+}
+
 int
 lrm_state_register_rsc(lrm_state_t * lrm_state,
                        const char *rsc_id,
@@ -1,5 +1,5 @@
 /*
- * Copyright 2004-2023 the Pacemaker project contributors
+ * Copyright 2004-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -9,6 +9,7 @@
 #ifndef CONTROLD_LRM__H
 #  define CONTROLD_LRM__H
 
+#include <crm/lrmd_internal.h>   // lrmd__exec_request_t
 #include <controld_messages.h>
 
 extern gboolean verify_stopped(enum crmd_fsa_state cur_state, int log_level);
@@ -144,6 +145,17 @@ int controld_execute_resource_agent(lrm_state_t *lrm_state, const char *rsc_id,
                                     guint interval_ms, int timeout_ms,
                                     int start_delay_ms,
                                     GHashTable *parameters, int *call_id);
+int controld_execute_resource_agent_async(lrm_state_t *lrm_state,
+                                          const char *rsc_id,
+                                          const char *action,
+                                          const char *userdata,
+                                          guint interval_ms, int timeout_ms,
+                                          int start_delay_ms,
+                                          GHashTable *parameters,
+                                          void (*callback)(int, void *),
+                                          void *user_data);
+int controld_execute_batch(lrm_state_t *lrm_state,
+                           lrmd__exec_request_t *requests, int n_requests);
 lrmd_rsc_info_t *lrm_state_get_rsc_info(lrm_state_t * lrm_state,
                                         const char *rsc_id, enum lrmd_call_options options);
 int lrm_state_register_rsc(lrm_state_t * lrm_state,
@@ -179,5 +191,6 @@ void controld_ack_event_directly(const char *to_host, const char *to_sys,
                                  lrmd_event_data_t *op, const char *rsc_id);
 void controld_rc2event(lrmd_event_data_t *event, int rc);
 void controld_trigger_delete_refresh(const char *from_sys, const char *rsc_id);
+void controld_free_probe_batches(void);
 
 #endif
@@ -18,6 +18,7 @@
 #include <crm/cluster/internal.h>
 #include <crm/cib.h>
 #include <crm/common/ipc_internal.h>
+#include <crm/common/metrics_internal.h>
 
 #include <pacemaker-controld.h>
 
@@ -409,6 +410,7 @@ relay_message(xmlNode * msg, gboolean originated_locally)
 
         } else if (is_for_crm) {
             if (pcmk__strcase_any_of(task, CRM_OP_NODE_INFO,
+                                     PCMK__CONTROLD_CMD_METRICS,
                                      PCMK__CONTROLD_CMD_NODES, NULL)) {
                 /* Node info requests do not specify a host, which is normally
                  * treated as "all hosts", because the whole point is that the
@@ -882,6 +884,81 @@ handle_node_list(const xmlNode *request)
     return I_NULL;
 }
 
+/*!
+ * \brief Handle a PCMK__CONTROLD_CMD_METRICS request
+ *
+ * \param[in] request  Message XML
+ *
+ * \return Next FSA input
+ */
+static enum crmd_fsa_input
+handle_metrics(const xmlNode *request)
+{
+    xmlNode *reply = NULL;
+    xmlNode *reply_data = pcmk__metrics_xml(NULL);
+
+    reply = create_reply(request, reply_data);
+    free_xml(reply_data);
+    if (reply) {
+        (void) relay_message(reply, TRUE);
+        free_xml(reply);
+    }
+
+    // Nothing further to do
+    return I_NULL;
+}
+
+/*!
+ * \brief Handle a PCMK__OP_SET_TRACE request
+ *
+ * \param[in,out] msg    Message XML
+ * \param[in]     cause  What caused the request to be handled
+ *
+ * \return Next FSA input
+ */
+static enum crmd_fsa_input
+handle_set_trace(xmlNode *msg, enum crmd_fsa_cause cause)
+{
+    xmlNode *reply = NULL;
+    pcmk__request_t request = {
+        .ipc_client     = NULL,
+        .ipc_id         = 0,
+        .ipc_flags      = 0, // dispatch_controller_ipc() already acked
+        .peer           = NULL,
+        .xml            = msg,
+        .call_options   = 0,
+        .result         = PCMK__UNKNOWN_RESULT,
+    };
+
+    /* Only local IPC clients can change tracing. dispatch_controller_ipc() set
+     * the sender to the client ID, which the handler checks for privilege.
+     */
+    if (cause == C_IPC_MESSAGE) {
+        request.ipc_client = pcmk__find_client_by_id(
+                                crm_element_value(msg, PCMK__XA_CRM_SYS_FROM));
+    } else {
+        request.peer = crm_element_value(msg, PCMK__XA_SRC);
+    }
+    request.op = pcmk__str_copy(PCMK__OP_SET_TRACE);
+
+    pcmk__handle_set_trace_request(&request);
+    if (!pcmk__result_ok(&request.result)) {
+        crm_warn("%s", pcmk__s(request.result.exit_reason,
+                               "Could not change tracing"));
+    }
+
+    reply = create_reply(msg, NULL);
+    if (reply != NULL) {
+        crm_xml_add_int(reply, PCMK_XA_STATUS, request.result.exit_status);
+        (void) relay_message(reply, TRUE);
+        free_xml(reply);
+    }
+    pcmk__reset_request(&request);
+
+    // Nothing further to do
+    return I_NULL;
+}
+
 /*!
  * \brief Handle a CRM_OP_NODE_INFO request
  *
@@ -1181,6 +1258,12 @@ handle_request(xmlNode *stored_msg, enum crmd_fsa_cause cause)
     } else if (strcmp(op, PCMK__CONTROLD_CMD_NODES) == 0) {
         return handle_node_list(stored_msg);
 
+    } else if (strcmp(op, PCMK__CONTROLD_CMD_METRICS) == 0) {
+        return handle_metrics(stored_msg);
+
+    } else if (strcmp(op, PCMK__OP_SET_TRACE) == 0) {
+        return handle_set_trace(stored_msg, cause);
+
         /*========== (NOT_DC)-Only Actions ==========*/
     } else if (!AM_I_DC) {
 
@@ -15,6 +15,7 @@
 
 #include <crm/crm.h>
 #include <crm/lrmd.h>
+#include <crm/lrmd_internal.h>   // lrmd__metadata_async()
 
 #include <pacemaker-controld.h>
 
@@ -309,3 +310,158 @@ controld_get_rsc_metadata(lrm_state_t *lrm_state, const lrmd_rsc_info_t *rsc,
     free(metadata_str);
     return metadata;
 }
+
+// Agents whose meta-data is still to be prewarmed (lrmd_rsc_info_t *)
+static GQueue *prewarm_queue = NULL;
+
+static void prewarm_next(void);
+
+/*!
+ * \internal
+ * \brief Cache prewarmed meta-data, then request the next agent's
+ *
+ * \param[in]     pid        Ignored
+ * \param[in]     result     Result of meta-data action
+ * \param[in,out] user_data  Resource information for agent
+ */
+static void
+prewarm_complete(int pid, const pcmk__action_result_t *result,
+                 void *user_data)
+{
+    lrmd_rsc_info_t *rsc = user_data;
+    lrm_state_t *lrm_state = lrm_state_find(controld_globals.our_nodename);
+
+    if ((lrm_state != NULL) && pcmk__result_ok(result)) {
+        controld_cache_metadata(lrm_state->metadata_cache, rsc,
+                                result->action_stdout);
+    } else {
+        crm_debug("Could not prewarm meta-data for %s: %s",
+                  rsc->id, pcmk__s(result->exit_reason, "agent failed"));
+    }
+    lrmd_free_rsc_info(rsc);
+    prewarm_next();
+}
+
+/*!
+ * \internal
+ * \brief Request meta-data for the next agent waiting to be prewarmed
+ *
+ * Only one agent is asked at a time, so that prewarming doesn't fork a burst of
+ * processes at startup.
+ */
+static void
+prewarm_next(void)
+{
+    lrmd_rsc_info_t *rsc = NULL;
+
+    if (prewarm_queue == NULL) {
+        return;
+    }
+
+    rsc = g_queue_pop_head(prewarm_queue);
+    if ((rsc == NULL)
+        || pcmk_is_set(controld_globals.fsa_input_register,
+                       R_HA_DISCONNECTED|R_SHUTDOWN)) {
+
+        g_queue_free_full(prewarm_queue, (GDestroyNotify) lrmd_free_rsc_info);
+        prewarm_queue = NULL;
+        return;
+    }
+
+    crm_trace("Prewarming meta-data for %s", rsc->id);
+
+    /* The callback is called (possibly synchronously) even if the request
+     * fails, so it will take care of moving on to the next agent.
+     */
+    (void) lrmd__metadata_async(rsc, prewarm_complete, rsc);
+}
+
+/*!
+ * \internal
+ * \brief Queue an agent used by a resource or template for prewarming
+ *
+ * \param[in]     xml   Resource or template XML
+ * \param[in,out] seen  Table of resource agent keys already queued
+ */
+static void
+prewarm_queue_agent(const xmlNode *xml, GHashTable *seen)
+{
+    const char *standard = crm_element_value(xml, PCMK_XA_CLASS);
+    const char *provider = crm_element_value(xml, PCMK_XA_PROVIDER);
+    const char *type = crm_element_value(xml, PCMK_XA_TYPE);
+    char *key = NULL;
+
+    if ((standard == NULL) || !crm_op_needs_metadata(standard, NULL)) {
+        return; // Templated resource, or agent without parameters
+    }
+
+    key = crm_generate_ra_key(standard, provider, type);
+    if ((key == NULL) || g_hash_table_contains(seen, key)) {
+        free(key);
+        return;
+    }
+
+    // The agent key stands in for a resource ID in log messages
+    g_queue_push_tail(prewarm_queue,
+                      lrmd_new_rsc_info(key, standard, provider, type));
+    g_hash_table_add(seen, key);
+}
+
+static void
+prewarm_query_callback(xmlNode *msg, int call_id, int rc, xmlNode *output,
+                       void *user_data)
+{
+    GHashTable *seen = NULL;
+
+    if ((rc != pcmk_ok) || (output == NULL)) {
+        crm_debug("Not prewarming agent meta-data: %s", pcmk_strerror(rc));
+        return;
+    }
+
+    seen = pcmk__strkey_table(free, NULL);
+    prewarm_queue = g_queue_new();
+
+    // A single match is returned as is, rather than in a wrapper
+    if (pcmk__xe_is(output, PCMK__XE_XPATH_QUERY)) {
+        for (const xmlNode *xml = pcmk__xe_first_child(output, NULL, NULL,
+                                                       NULL);
+             xml != NULL; xml = pcmk__xe_next(xml)) {
+            prewarm_queue_agent(xml, seen);
+        }
+    } else {
+        prewarm_queue_agent(output, seen);
+    }
+
+    crm_info("Prewarming meta-data for %u resource agent%s",
+             g_queue_get_length(prewarm_queue),
+             pcmk__plural_s(g_queue_get_length(prewarm_queue)));
+    g_hash_table_destroy(seen);
+    prewarm_next();
+}
+
+/*!
+ * \internal
+ * \brief Fetch meta-data for all agents in the configuration in the background
+ *
+ * This fills both the local executor state's meta-data table and the on-disk
+ * meta-data cache, so that actions rarely need to wait for an agent's
+ * meta-data action. It does nothing if prewarming has already been done.
+ */
+void
+controld_prewarm_metadata(void)
+{
+    static bool requested = false;
+    cib_t *cib_conn = controld_globals.cib_conn;
+    int call_id = 0;
+
+    if (requested || (cib_conn == NULL)) {
+        return;
+    }
+    requested = true;
+
+    call_id = cib_conn->cmds->query(cib_conn,
+                                    "//" PCMK_XE_PRIMITIVE
+                                    " | //" PCMK_XE_TEMPLATE,
+                                    NULL, cib_xpath|cib_scope_local);
+    fsa_register_cib_callback(call_id, NULL, prewarm_query_callback);
+}
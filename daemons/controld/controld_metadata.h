@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2022 the Pacemaker project contributors
+ * Copyright 2017-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -77,6 +77,7 @@ struct ra_metadata_s *controld_cache_metadata(GHashTable *mdc,
 struct ra_metadata_s *controld_get_rsc_metadata(lrm_state_t *lrm_state,
                                                 const lrmd_rsc_info_t *rsc,
                                                 uint32_t source);
+void controld_prewarm_metadata(void);
 
 static inline const char *
 ra_param_flag2text(enum ra_param_flags_e flag)
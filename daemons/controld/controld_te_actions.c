@@ -355,6 +355,7 @@ execute_rsc_action(pcmk__graph_t *graph, pcmk__graph_action_t *action)
      */
     xmlNode *cmd = NULL;
     xmlNode *rsc_op = NULL;
+    xmlNode *expanded = NULL;
 
     gboolean rc = TRUE;
     gboolean no_wait = FALSE;
@@ -392,6 +393,15 @@ execute_rsc_action(pcmk__graph_t *graph, pcmk__graph_action_t *action)
                                    controld_globals.te_uuid);
     crm_xml_add(rsc_op, PCMK__XA_TRANSITION_KEY, counter);
 
+    /* Actions of clones with notifications enabled may refer to notification
+     * data shared across the graph, which the agent needs in its environment,
+     * so send a copy with it added
+     */
+    expanded = pcmk__expand_notify_data(graph, action);
+    if (expanded != NULL) {
+        rsc_op = expanded;
+    }
+
     if (pcmk__str_eq(router_node, controld_globals.our_nodename,
                      pcmk__str_casei)) {
         is_local = TRUE;
@@ -439,6 +449,7 @@ execute_rsc_action(pcmk__graph_t *graph, pcmk__graph_action_t *action)
 
     free(counter);
     free_xml(cmd);
+    free_xml(expanded);
 
     pcmk__set_graph_action_flags(action, pcmk__graph_action_executed);
 
@@ -17,6 +17,7 @@
 #include <dirent.h>
 
 #include <crm/crm.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/xml.h>
 #include <crm/cluster.h>
 
@@ -46,6 +47,20 @@ static float throttle_load_target = 0.0;
 #define THROTTLE_FACTOR_MEDIUM 1.6
 #define THROTTLE_FACTOR_HIGH   2.0
 
+#define THROTTLE_FACTOR_PRESSURE_MEDIUM 2.0
+#define THROTTLE_FACTOR_PRESSURE_HIGH   4.0
+
+// Default percentage of time stalled on a resource that is noticeable load
+#define THROTTLE_PRESSURE_DEFAULT 10.0
+
+// Highest such percentage for which high load can still be reached
+#define THROTTLE_PRESSURE_MAX (100.0 / THROTTLE_FACTOR_PRESSURE_HIGH)
+
+static double throttle_pressure_target = THROTTLE_PRESSURE_DEFAULT;
+
+// What system load was measured by (sent to peers with the throttle mode)
+static const char *throttle_source = NULL;
+
 static GHashTable *throttle_records = NULL;
 static mainloop_timer_t *throttle_timer = NULL;
 
@@ -295,6 +310,90 @@ throttle_handle_load(float load, const char *desc, int cores)
 
     return throttle_check_thresholds(load, desc, thresholds);
 }
+
+/*!
+ * \internal
+ * \brief Check pressure stall information (PSI) against throttling thresholds
+ *
+ * \param[out] mode  Where to store throttle mode corresponding to pressure
+ *
+ * \return true if \p mode was set from PSI, otherwise false (in which case
+ *         the load average should be used instead)
+ */
+static bool
+throttle_pressure(enum throttle_state_e *mode)
+{
+    static bool psi_available = true;
+    const char *resources[] = { "cpu", "io", "memory" };
+    static bool read_failed[PCMK__NELEM(resources)] = { false, };
+
+    *mode = throttle_none;
+    if (!psi_available || (throttle_pressure_target <= 0.0)) {
+        return false;
+    }
+
+    for (int i = 0; i < PCMK__NELEM(resources); i++) {
+        double some = 0.0;
+        double full = 0.0;
+        float thresholds[4];
+        char *desc = NULL;
+        enum throttle_state_e rsc_mode = throttle_none;
+        int rc = pcmk__procfs_pressure(resources[i], &some, &full);
+
+        if (rc != pcmk_rc_ok) {
+            if ((rc == ENOENT) || (rc == EOPNOTSUPP)) {
+                crm_info("Throttling by load average because pressure stall "
+                         "information is unavailable: %s", pcmk_rc_str(rc));
+                psi_available = false;
+            } else if (!read_failed[i]) {
+                // Warn only once until reading succeeds again
+                crm_warn("Throttling by load average because %s pressure "
+                         "could not be read: %s", resources[i],
+                         pcmk_rc_str(rc));
+                read_failed[i] = true;
+            }
+            *mode = throttle_none;
+            return false;
+        }
+
+        if (read_failed[i]) {
+            crm_info("Reading %s pressure succeeded again", resources[i]);
+            read_failed[i] = false;
+        }
+
+        pcmk__metric_set(pcmk__metric(pcmk__metric_gauge,
+                                      "pacemaker_pressure_stall_percent",
+                                      "Percentage of the last minute that "
+                                      "some tasks were stalled on a resource",
+                                      "resource", resources[i]),
+                         some);
+
+        thresholds[0] = throttle_pressure_target;
+        thresholds[1] = throttle_pressure_target
+                        * THROTTLE_FACTOR_PRESSURE_MEDIUM;
+        thresholds[2] = throttle_pressure_target
+                        * THROTTLE_FACTOR_PRESSURE_HIGH;
+        thresholds[3] = some + 1.0; // never extreme
+
+        desc = crm_strdup_printf("%s pressure", resources[i]);
+        rsc_mode = throttle_check_thresholds(some, desc, thresholds);
+        free(desc);
+
+        /* If every task is stalled on memory for a substantial amount of time,
+         * the node is thrashing, and new work will only make it worse
+         */
+        if (pcmk__str_eq(resources[i], "memory", pcmk__str_none)
+            && (full > thresholds[2])) {
+            crm_notice("Extreme memory pressure detected: %f", full);
+            rsc_mode = throttle_extreme;
+        }
+
+        if (rsc_mode > *mode) {
+            *mode = rsc_mode;
+        }
+    }
+    return true;
+}
 #endif // HAVE_LINUX_PROCFS
 
 static enum throttle_state_e
@@ -302,10 +401,13 @@ throttle_mode(void)
 {
     enum throttle_state_e mode = throttle_none;
 
+    throttle_source = NULL;
+
 #if HAVE_LINUX_PROCFS
     unsigned int cores;
     float load;
     float thresholds[4];
+    enum throttle_state_e pressure = throttle_none;
 
     cores = pcmk__procfs_num_cores();
     if(throttle_cib_load(&load)) {
@@ -343,9 +445,17 @@ throttle_mode(void)
         return mode;
     }
 
-    if(throttle_load_avg(&load)) {
+    if (throttle_pressure(&pressure)) {
+        throttle_source = "pressure";
+        if (pressure > mode) {
+            mode = pressure;
+        }
+
+    } else if(throttle_load_avg(&load)) {
         enum throttle_state_e cpu_load;
 
+        throttle_source = "load-average";
+
         cpu_load = throttle_handle_load(load, "CPU load", cores);
         if (cpu_load > mode) {
             mode = cpu_load;
@@ -362,14 +472,22 @@ throttle_send_command(enum throttle_state_e mode)
     xmlNode *xml = NULL;
     static enum throttle_state_e last = -1;
 
+    pcmk__metric_set(pcmk__metric_gauge("pacemaker_throttle_mode",
+                                        "Local throttle mode (0 negligible, "
+                                        "1 low, 16 medium, 256 high, "
+                                        "4096 extreme)"),
+                     mode);
+
     if(mode != last) {
-        crm_info("New throttle mode: %s load (was %s)",
-                 load2str(mode), load2str(last));
+        crm_info("New throttle mode: %s load (was %s) by %s",
+                 load2str(mode), load2str(last),
+                 pcmk__s(throttle_source, "CIB load only"));
         last = mode;
 
         xml = create_request(CRM_OP_THROTTLE, NULL, NULL, CRM_SYSTEM_CRMD, CRM_SYSTEM_CRMD, NULL);
         crm_xml_add_int(xml, PCMK__XA_CRM_LIMIT_MODE, mode);
         crm_xml_add_int(xml, PCMK__XA_CRM_LIMIT_MAX, throttle_job_max);
+        crm_xml_add(xml, PCMK__XA_CRM_LIMIT_SOURCE, throttle_source);
 
         pcmk__cluster_send_message(NULL, crm_msg_crmd, xml);
         free_xml(xml);
@@ -424,6 +542,32 @@ throttle_update_job_max(const char *preference)
     }
 }
 
+/*!
+ * \internal
+ * \brief Update the pressure stall percentage considered noticeable load
+ */
+static void
+throttle_update_pressure_target(void)
+{
+    const char *value = pcmk__env_option(PCMK__ENV_PRESSURE_THRESHOLD);
+    double target = THROTTLE_PRESSURE_DEFAULT;
+
+    if ((value != NULL)
+        && ((pcmk__scan_double(value, &target, NULL, NULL) != pcmk_rc_ok)
+            || (target < 0.0))) {
+        crm_warn("Using default PCMK_" PCMK__ENV_PRESSURE_THRESHOLD
+                 " of %.0f instead of invalid value '%s'",
+                 THROTTLE_PRESSURE_DEFAULT, value);
+        target = THROTTLE_PRESSURE_DEFAULT;
+
+    } else if (target > THROTTLE_PRESSURE_MAX) {
+        crm_warn("Using maximum PCMK_" PCMK__ENV_PRESSURE_THRESHOLD
+                 " of %.0f instead of %s", THROTTLE_PRESSURE_MAX, value);
+        target = THROTTLE_PRESSURE_MAX;
+    }
+    throttle_pressure_target = target;
+}
+
 void
 throttle_init(void)
 {
@@ -433,6 +577,7 @@ throttle_init(void)
     }
 
     throttle_update_job_max(NULL);
+    throttle_update_pressure_target();
     mainloop_timer_start(throttle_timer);
 }
 
@@ -568,7 +713,10 @@ throttle_update(xmlNode *xml)
     r->max = max;
     r->mode = (enum throttle_state_e) mode;
 
-    crm_debug("Node %s has %s load and supports at most %d jobs; new job limit %d",
-              from, load2str((enum throttle_state_e) mode), max,
-              throttle_get_job_limit(from));
+    crm_debug("Node %s has %s load (by %s) and supports at most %d jobs; "
+              "new job limit %d",
+              from, load2str((enum throttle_state_e) mode),
+              pcmk__s(crm_element_value(xml, PCMK__XA_CRM_LIMIT_SOURCE),
+                      "unknown method"),
+              max, throttle_get_job_limit(from));
 }
@@ -22,6 +22,7 @@
 #include <crm/crm.h>
 #include <crm/common/cmdline_internal.h>
 #include <crm/common/ipc.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/output_internal.h>
 #include <crm/common/xml.h>
 
@@ -202,6 +203,7 @@ crmd_init(void)
     if (state == S_PENDING || state == S_STARTING) {
         /* Create the mainloop and run it... */
         crm_trace("Starting %s's mainloop", crm_system_name);
+        pcmk__metrics_init(crm_system_name);
         controld_globals.mainloop = g_main_loop_new(NULL, FALSE);
         g_main_loop_run(controld_globals.mainloop);
         if (pcmk_is_set(controld_globals.fsa_input_register, R_STAYDOWN)) {
@@ -19,6 +19,7 @@
 #  include <time.h>  /* clock_gettime */
 #endif
 
+#include <limits.h>
 #include <unistd.h>
 
 #include <crm/crm.h>
@@ -28,6 +29,7 @@
 #include <crm/common/mainloop.h>
 #include <crm/common/ipc.h>
 #include <crm/common/ipc_internal.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/xml.h>
 
 #include "pacemaker-execd.h"
@@ -94,6 +96,8 @@ typedef struct lrmd_cmd_s {
     int last_notify_op_status;
     int last_pid;
 
+    bool batched;   // Whether cmd counts against the batch execution limit
+
     GHashTable *params;
 } lrmd_cmd_t;
 
@@ -242,6 +246,17 @@ log_finished(const lrmd_cmd_t *cmd, int exec_time_ms, int queue_time_ms)
                        pcmk__readable_interval(queue_time_ms), NULL);
     }
     g_string_append_c(str, ')');
+
+    pcmk__metric_observe(pcmk__metric(pcmk__metric_seconds,
+                                      "pacemaker_execd_exec_duration_seconds",
+                                      "Time taken to execute resource actions",
+                                      "action", cmd->action),
+                         exec_time_ms / 1000.0);
+    pcmk__metric_observe(pcmk__metric(pcmk__metric_seconds,
+                                      "pacemaker_execd_queue_duration_seconds",
+                                      "Time resource actions spent queued",
+                                      "action", cmd->action),
+                         queue_time_ms / 1000.0);
 #endif
 
     do_crm_log(log_level, "%s", str->str);
@@ -294,11 +309,21 @@ build_rsc_from_xml(xmlNode * msg)
     return rsc;
 }
 
+/*!
+ * \internal
+ * \brief Create a new executor command from a client request
+ *
+ * \param[in] msg      Client request
+ * \param[in] rsc_xml  Resource operation within \p msg to create command for
+ * \param[in] client   Client that sent \p msg
+ *
+ * \return Newly allocated command
+ */
 static lrmd_cmd_t *
-create_lrmd_cmd(xmlNode *msg, pcmk__client_t *client)
+create_lrmd_cmd(const xmlNode *msg, const xmlNode *rsc_xml,
+                const pcmk__client_t *client)
 {
     int call_options = 0;
-    xmlNode *rsc_xml = get_xpath_object("//" PCMK__XE_LRMD_RSC, msg, LOG_ERR);
     lrmd_cmd_t *cmd = NULL;
 
     cmd = pcmk__assert_alloc(1, sizeof(lrmd_cmd_t));
@@ -536,6 +561,105 @@ schedule_lrmd_cmd(lrmd_rsc_t * rsc, lrmd_cmd_t * cmd)
     }
 }
 
+/* Commands received in a batch are held here and released to their resources
+ * only as earlier batched commands complete, so that a large batch (such as the
+ * probes for every resource when a node joins) doesn't fork every agent at
+ * once.
+ */
+static GQueue *batch_queue = NULL;  // lrmd_cmd_t *
+static int batch_active = 0;        // Batched commands released and unfinished
+static int batch_limit = 0;         // Maximum value of batch_active
+
+/*!
+ * \internal
+ * \brief Get the maximum number of batched commands to run at once
+ *
+ * \return Value of \c PCMK_node_action_limit if set, otherwise twice the
+ *         number of cores
+ */
+static int
+get_batch_limit(void)
+{
+    if (batch_limit <= 0) {
+        const char *value = pcmk__env_option(PCMK__ENV_NODE_ACTION_LIMIT);
+        long long limit = 0LL;
+
+        if (value != NULL) {
+            pcmk__scan_ll(value, &limit, 0LL);
+        }
+        if (limit > 0) {
+            batch_limit = (limit >= INT_MAX)? INT_MAX : (int) limit;
+        } else {
+            batch_limit = 2 * pcmk__procfs_num_cores();
+        }
+        crm_debug("Running at most %d batched commands at once", batch_limit);
+    }
+    return batch_limit;
+}
+
+/*!
+ * \internal
+ * \brief Schedule as many queued batched commands as the limit allows
+ */
+static void
+release_batched_cmds(void)
+{
+    if (batch_queue == NULL) {
+        return;
+    }
+
+    while ((batch_active < get_batch_limit())
+           && !g_queue_is_empty(batch_queue)) {
+
+        lrmd_cmd_t *cmd = g_queue_pop_head(batch_queue);
+        lrmd_rsc_t *rsc = g_hash_table_lookup(rsc_list, cmd->rsc_id);
+
+        if (rsc == NULL) {
+            crm_info("Not executing " PCMK__OP_FMT " because resource was "
+                     "unregistered while queued",
+                     cmd->rsc_id, cmd->action, cmd->interval_ms);
+            cmd->batched = false;
+            pcmk__set_result(&(cmd->result), PCMK_OCF_UNKNOWN_ERROR,
+                             PCMK_EXEC_ERROR,
+                             "Resource unregistered before action could run");
+            cmd_finalize(cmd, NULL);
+            continue;
+        }
+
+        batch_active++;
+        schedule_lrmd_cmd(rsc, cmd);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Queue a command received in a batch for execution
+ *
+ * \param[in,out] cmd  Command to queue (the queue takes ownership)
+ */
+static void
+queue_batched_cmd(lrmd_cmd_t *cmd)
+{
+    if (batch_queue == NULL) {
+        batch_queue = g_queue_new();
+    }
+    cmd->batched = true;
+    g_queue_push_tail(batch_queue, cmd);
+}
+
+/*!
+ * \internal
+ * \brief Free any batched commands that have not been released
+ */
+void
+execd_free_batch_queue(void)
+{
+    if (batch_queue != NULL) {
+        g_queue_free_full(batch_queue, (GDestroyNotify) free_lrmd_cmd);
+        batch_queue = NULL;
+    }
+}
+
 static xmlNode *
 create_lrmd_reply(const char *origin, int rc, int call_id)
 {
@@ -547,14 +671,151 @@ create_lrmd_reply(const char *origin, int rc, int call_id)
     return reply;
 }
 
+/* Resource operation completion notifications for clients that accept them
+ * in batches are held here until the mainloop is otherwise idle (or the batch
+ * is large), then sent as a single message.
+ */
+#define NOTIFY_BATCH_MAX 100
+
+static GHashTable *notify_batches = NULL;   // Client ID -> batch XML
+static crm_trigger_t *notify_batch_trigger = NULL;
+
+static void
+notify_client(pcmk__client_t *client, xmlNode *msg)
+{
+    int rc = lrmd_server_send_notify(client, msg);
+    int log_level = LOG_WARNING;
+    const char *reason = NULL;
+
+    if (rc == pcmk_rc_ok) {
+        return;
+    }
+
+    switch (rc) {
+        case ENOTCONN:
+        case EPIPE: // Client exited without waiting for notification
+            log_level = LOG_INFO;
+            reason = "Disconnected";
+            break;
+
+        default:
+            reason = pcmk_rc_str(rc);
+            break;
+    }
+    do_crm_log(log_level, "Could not notify client %s: %s " CRM_XS " rc=%d",
+               pcmk__client_name(client), reason, rc);
+}
+
+/*!
+ * \internal
+ * \brief Send any held completion notifications to a client
+ *
+ * \param[in,out] client  Client to send notifications to
+ */
+static void
+flush_client_notify(pcmk__client_t *client)
+{
+    xmlNode *batch = NULL;
+    xmlNode *first = NULL;
+
+    if (notify_batches == NULL) {
+        return;
+    }
+    batch = g_hash_table_lookup(notify_batches, client->id);
+    if (batch == NULL) {
+        return;
+    }
+
+    // Don't bother wrapping a lone notification
+    first = pcmk__xe_first_child(batch, NULL, NULL, NULL);
+    if ((first != NULL) && (pcmk__xe_next(first) == NULL)) {
+        notify_client(client, first);
+    } else {
+        crm_trace("Sending %lu batched notifications to client %s",
+                  xmlChildElementCount(batch), pcmk__client_name(client));
+        notify_client(client, batch);
+    }
+    g_hash_table_remove(notify_batches, client->id);
+}
+
+static gboolean
+flush_notify_batches(gpointer user_data)
+{
+    GHashTableIter iter;
+    const char *client_id = NULL;
+
+    g_hash_table_iter_init(&iter, notify_batches);
+    while (g_hash_table_iter_next(&iter, (gpointer *) &client_id, NULL)) {
+        pcmk__client_t *client = pcmk__find_client_by_id(client_id);
+
+        if (client != NULL) {
+            flush_client_notify(client);
+            g_hash_table_iter_init(&iter, notify_batches);
+        } else {
+            g_hash_table_iter_remove(&iter);
+        }
+    }
+    return TRUE;
+}
+
+/*!
+ * \internal
+ * \brief Hold a completion notification to send to a client in a batch
+ *
+ * \param[in,out] client  Client to notify
+ * \param[in]     notify  Notification to send
+ */
+static void
+batch_client_notify(pcmk__client_t *client, const xmlNode *notify)
+{
+    xmlNode *batch = NULL;
+
+    if (notify_batches == NULL) {
+        notify_batches = pcmk__strkey_table(free, (GDestroyNotify) free_xml);
+        notify_batch_trigger = mainloop_add_trigger(G_PRIORITY_LOW,
+                                                    flush_notify_batches,
+                                                    NULL);
+    }
+
+    batch = g_hash_table_lookup(notify_batches, client->id);
+    if (batch == NULL) {
+        batch = pcmk__xe_create(NULL, PCMK__XE_LRMD_NOTIFY_BATCH);
+        crm_xml_add(batch, PCMK__XA_LRMD_ORIGIN, __func__);
+        g_hash_table_insert(notify_batches, pcmk__str_copy(client->id),
+                            batch);
+    }
+    pcmk__xml_copy(batch, (xmlNode *) notify);
+
+    if (xmlChildElementCount(batch) >= NOTIFY_BATCH_MAX) {
+        flush_client_notify(client);
+    } else {
+        mainloop_set_trigger(notify_batch_trigger);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Send all held notifications and free batching resources
+ */
+void
+execd_flush_notify_batches(void)
+{
+    if (notify_batches != NULL) {
+        flush_notify_batches(NULL);
+        g_hash_table_destroy(notify_batches);
+        notify_batches = NULL;
+    }
+    if (notify_batch_trigger != NULL) {
+        mainloop_destroy_trigger(notify_batch_trigger);
+        notify_batch_trigger = NULL;
+    }
+}
+
 static void
 send_client_notify(gpointer key, gpointer value, gpointer user_data)
 {
     xmlNode *update_msg = user_data;
     pcmk__client_t *client = value;
-    int rc;
-    int log_level = LOG_WARNING;
-    const char *msg = NULL;
 
     CRM_CHECK(client != NULL, return);
     if (client->name == NULL) {
@@ -571,24 +832,18 @@ send_client_notify(gpointer key, gpointer value, gpointer user_data)
         return;
     }
 
-    rc = lrmd_server_send_notify(client, update_msg);
-    if (rc == pcmk_rc_ok) {
-        return;
-    }
+    if (pcmk_is_set(client->flags, execd_client_batch_notify)) {
+        const char *op = crm_element_value(update_msg, PCMK__XA_LRMD_OP);
 
-    switch (rc) {
-        case ENOTCONN:
-        case EPIPE: // Client exited without waiting for notification
-            log_level = LOG_INFO;
-            msg = "Disconnected";
-            break;
+        if (pcmk__str_eq(op, LRMD_OP_RSC_EXEC, pcmk__str_none)) {
+            batch_client_notify(client, update_msg);
+            return;
+        }
 
-        default:
-            msg = pcmk_rc_str(rc);
-            break;
+        // Keep other notifications in order with held ones
+        flush_client_notify(client);
     }
-    do_crm_log(log_level, "Could not notify client %s: %s " CRM_XS " rc=%d",
-               pcmk__client_name(client), msg, rc);
+    notify_client(client, update_msg);
 }
 
 static void
@@ -740,6 +995,13 @@ cmd_finalize(lrmd_cmd_t * cmd, lrmd_rsc_t * rsc)
         cmd->rsc_deleted = 1;
     }
 
+    if (cmd->batched) {
+        // This frees a slot for another batched command
+        cmd->batched = false;
+        batch_active--;
+        release_batched_cmds();
+    }
+
     /* reset original timeout so client notification has correct information */
     cmd->timeout = cmd->timeout_orig;
 
@@ -808,6 +1070,10 @@ client_disconnect_cleanup(const char *client_id)
             cancel_all_recurring(rsc, client_id);
         }
     }
+
+    if ((client_id != NULL) && (notify_batches != NULL)) {
+        g_hash_table_remove(notify_batches, client_id);
+    }
 }
 
 static void
@@ -1497,6 +1763,10 @@ process_lrmd_signon(pcmk__client_t *client, xmlNode *request, int call_id,
         rc = -EPROTO;
     }
 
+    if (pcmk__xe_attr_is_true(request, PCMK__XA_LRMD_BATCH_NOTIFY)) {
+        pcmk__set_client_flags(client, execd_client_batch_notify);
+    }
+
     if (pcmk__xe_attr_is_true(request, PCMK__XA_LRMD_IS_IPC_PROVIDER)) {
 #ifdef PCMK__COMPILE_REMOTE
         if ((client->remote != NULL)
@@ -1527,6 +1797,9 @@ process_lrmd_signon(pcmk__client_t *client, xmlNode *request, int call_id,
     crm_xml_add(*reply, PCMK__XA_LRMD_CLIENTID, client->id);
     crm_xml_add(*reply, PCMK__XA_LRMD_PROTOCOL_VERSION, LRMD_PROTOCOL_VERSION);
     crm_xml_add_ll(*reply, PCMK__XA_UPTIME, now - start_time);
+    pcmk__xe_set_bool_attr(*reply, PCMK__XA_LRMD_BATCH_NOTIFY,
+                           pcmk_is_set(client->flags,
+                                       execd_client_batch_notify));
 
     if (start_state) {
         crm_xml_add(*reply, PCMK__XA_NODE_START_STATE, start_state);
@@ -1638,7 +1911,7 @@ process_lrmd_rsc_exec(pcmk__client_t *client, uint32_t id, xmlNode *request)
         return -ENODEV;
     }
 
-    cmd = create_lrmd_cmd(request, client);
+    cmd = create_lrmd_cmd(request, rsc_xml, client);
     call_id = cmd->call_id;
 
     /* Don't reference cmd after handing it off to be scheduled.
@@ -1648,6 +1921,79 @@ process_lrmd_rsc_exec(pcmk__client_t *client, uint32_t id, xmlNode *request)
     return call_id;
 }
 
+/*!
+ * \internal
+ * \brief Process a client request to execute several resource actions
+ *
+ * Each action gets its own call ID and is reported separately when it
+ * completes, exactly as if it had been requested individually. However,
+ * non-recurring actions are run only as slots become available (see
+ * \c release_batched_cmds()), rather than all at once.
+ *
+ * \param[in] client   Client that sent \p request
+ * \param[in] request  Request XML
+ * \param[in] call_id  Call ID assigned to \p request
+ *
+ * \return Reply XML, with a \c PCMK__XE_LRMD_RSC child for each action
+ *         giving its call ID (or a negative errno if it could not be queued)
+ */
+static xmlNode *
+process_lrmd_rsc_exec_batch(pcmk__client_t *client, xmlNode *request,
+                            int call_id)
+{
+    int count = 0;
+    int queued = 0;
+    xmlNode *batch = get_xpath_object("//" PCMK__XE_LRMD_EXEC_BATCH, request,
+                                      LOG_ERR);
+    xmlNode *reply = create_lrmd_reply(__func__,
+                                       ((batch == NULL)? -EINVAL : pcmk_ok),
+                                       call_id);
+
+    for (xmlNode *rsc_xml = pcmk__xe_first_child(batch, PCMK__XE_LRMD_RSC,
+                                                 NULL, NULL);
+         rsc_xml != NULL; rsc_xml = pcmk__xe_next_same(rsc_xml)) {
+
+        const char *rsc_id = crm_element_value(rsc_xml, PCMK__XA_LRMD_RSC_ID);
+        xmlNode *result = pcmk__xe_create(reply, PCMK__XE_LRMD_RSC);
+        lrmd_rsc_t *rsc = NULL;
+        lrmd_cmd_t *cmd = NULL;
+
+        crm_xml_add(result, PCMK__XA_LRMD_RSC_ID, rsc_id);
+        count++;
+
+        if (rsc_id == NULL) {
+            crm_xml_add_int(result, PCMK__XA_LRMD_RC, -EINVAL);
+            continue;
+        }
+        rsc = g_hash_table_lookup(rsc_list, rsc_id);
+        if (rsc == NULL) {
+            crm_info("Resource '%s' not found (%d active resources)",
+                     rsc_id, g_hash_table_size(rsc_list));
+            crm_xml_add_int(result, PCMK__XA_LRMD_RC, -ENODEV);
+            continue;
+        }
+
+        cmd = create_lrmd_cmd(request, rsc_xml, client);
+        if (queued++ > 0) {
+            // The request's call ID goes to the first action only
+            cmd->call_id = execd_next_call_id();
+        }
+        crm_xml_add_int(result, PCMK__XA_LRMD_RC, pcmk_ok);
+        crm_xml_add_int(result, PCMK__XA_LRMD_CALLID, cmd->call_id);
+
+        if (cmd->interval_ms == 0) {
+            queue_batched_cmd(cmd);
+        } else {
+            schedule_lrmd_cmd(rsc, cmd);
+        }
+    }
+
+    crm_debug("Queued %d of %d batched resource actions from client %s",
+              queued, count, pcmk__client_name(client));
+    release_batched_cmds();
+    return reply;
+}
+
 static int
 cancel_op(const char *rsc_id, const char *action, guint interval_ms)
 {
@@ -1826,6 +2172,48 @@ process_lrmd_get_recurring(xmlNode *request, int call_id)
     return reply;
 }
 
+/*!
+ * \internal
+ * \brief Change which log callsites are traced, on request
+ *
+ * \param[in,out] client   IPC client that sent request
+ * \param[in]     id       IPC request ID
+ * \param[in,out] request  Request XML
+ *
+ * \return Legacy Pacemaker return code
+ */
+static int
+process_lrmd_set_trace(pcmk__client_t *client, uint32_t id, xmlNode *request)
+{
+    int rc = pcmk_ok;
+    pcmk__request_t trace_request = {
+        .ipc_client     = client,
+        .ipc_id         = id,
+        .ipc_flags      = 0, // The result goes in the usual executor reply
+        .peer           = NULL,
+        .xml            = request,
+        .call_options   = 0,
+        .result         = PCMK__UNKNOWN_RESULT,
+    };
+
+    trace_request.op = pcmk__str_copy(PCMK__OP_SET_TRACE);
+    pcmk__handle_set_trace_request(&trace_request);
+
+    switch (trace_request.result.exit_status) {
+        case CRM_EX_OK:
+            break;
+        case CRM_EX_INSUFFICIENT_PRIV:
+            rc = -EACCES;
+            break;
+        default:
+            crm_warn("%s", trace_request.result.exit_reason);
+            rc = -EINVAL;
+            break;
+    }
+    pcmk__reset_request(&trace_request);
+    return rc;
+}
+
 void
 process_lrmd_message(pcmk__client_t *client, uint32_t id, xmlNode *request)
 {
@@ -1892,6 +2280,13 @@ process_lrmd_message(pcmk__client_t *client, uint32_t id, xmlNode *request)
             rc = -EACCES;
         }
         do_reply = 1;
+    } else if (pcmk__str_eq(op, LRMD_OP_RSC_EXEC_BATCH, pcmk__str_none)) {
+        if (allowed) {
+            reply = process_lrmd_rsc_exec_batch(client, request, call_id);
+        } else {
+            rc = -EACCES;
+        }
+        do_reply = 1;
     } else if (pcmk__str_eq(op, LRMD_OP_RSC_CANCEL, pcmk__str_none)) {
         if (allowed) {
             rc = process_lrmd_rsc_cancel(client, id, request);
@@ -1931,6 +2326,9 @@ process_lrmd_message(pcmk__client_t *client, uint32_t id, xmlNode *request)
             rc = -EACCES;
         }
         do_reply = 1;
+    } else if (pcmk__str_eq(op, PCMK__OP_SET_TRACE, pcmk__str_none)) {
+        rc = process_lrmd_set_trace(client, id, request);
+        do_reply = 1;
     } else {
         rc = -EOPNOTSUPP;
         do_reply = 1;
@@ -1952,6 +2350,12 @@ process_lrmd_message(pcmk__client_t *client, uint32_t id, xmlNode *request)
         if (reply == NULL) {
             reply = create_lrmd_reply(__func__, rc, call_id);
         }
+
+        /* Completions caused by the request (such as cancellations) should
+         * reach the client before the reply does
+         */
+        flush_client_notify(client);
+
         send_rc = lrmd_server_send_reply(client, id, reply);
         free_xml(reply);
         if (send_rc != pcmk_rc_ok) {
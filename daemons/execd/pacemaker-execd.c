@@ -20,6 +20,7 @@
 #include <crm/common/ipc.h>
 #include <crm/common/ipc_internal.h>
 #include <crm/common/mainloop.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/output_internal.h>
 #include <crm/common/remote_internal.h>
 #include <crm/lrmd_internal.h>
@@ -99,6 +100,22 @@ get_stonith_connection(void)
     return stonith_api;
 }
 
+/*!
+ * \internal
+ * \brief Get a new call ID for an executor request
+ *
+ * \return Next call ID (always positive)
+ */
+int
+execd_next_call_id(void)
+{
+    lrmd_call_id++;
+    if (lrmd_call_id < 1) {
+        lrmd_call_id = 1;
+    }
+    return lrmd_call_id;
+}
+
 static int32_t
 lrmd_ipc_accept(qb_ipcs_connection_t * c, uid_t uid, gid_t gid)
 {
@@ -153,14 +170,9 @@ lrmd_ipc_dispatch(qb_ipcs_connection_t * c, void *data, size_t size)
         }
     }
 
-    lrmd_call_id++;
-    if (lrmd_call_id < 1) {
-        lrmd_call_id = 1;
-    }
-
     crm_xml_add(request, PCMK__XA_LRMD_CLIENTID, client->id);
     crm_xml_add(request, PCMK__XA_LRMD_CLIENTNAME, client->name);
-    crm_xml_add_int(request, PCMK__XA_LRMD_CALLID, lrmd_call_id);
+    crm_xml_add_int(request, PCMK__XA_LRMD_CALLID, execd_next_call_id());
 
     process_lrmd_message(client, id, request);
 
@@ -284,6 +296,7 @@ static gboolean
 lrmd_exit(gpointer data)
 {
     crm_info("Terminating with %d clients", pcmk__ipc_client_count());
+    execd_flush_notify_batches();
     stonith_api_delete(stonith_api);
     if (ipcs) {
         mainloop_del_ipc_server(ipcs);
@@ -295,6 +308,7 @@ lrmd_exit(gpointer data)
 #endif
 
     pcmk__client_cleanup();
+    execd_free_batch_queue();
     g_hash_table_destroy(rsc_list);
 
     if (mainloop) {
@@ -559,6 +573,7 @@ main(int argc, char **argv, char **envp)
 #endif
 
     mainloop_add_signal(SIGTERM, lrmd_shutdown);
+    pcmk__metrics_init(crm_system_name);
     mainloop = g_main_loop_new(NULL, FALSE);
     crm_notice("Pacemaker " EXECD_TYPE " executor successfully started and accepting connections");
     crm_notice("OCF resource agent search path is %s", OCF_RA_PATH);
@@ -19,6 +19,13 @@
 
 extern GHashTable *rsc_list;
 extern time_t start_time;
+extern int lrmd_call_id;
+
+// Executor-specific flags for pcmk__client_t:flags (lower 32 bits)
+enum execd_client_flags {
+    //! Client accepts resource operation completions in batches
+    execd_client_batch_notify   = (UINT64_C(1) << 0),
+};
 
 typedef struct lrmd_rsc_s {
     char *rsc_id;
@@ -52,6 +59,8 @@ typedef struct lrmd_rsc_s {
     crm_trigger_t *work;
 } lrmd_rsc_t;
 
+int execd_next_call_id(void);
+
 // in remoted_tls.c
 int lrmd_init_remote_tls_server(void);
 void execd_stop_tls_server(void);
@@ -59,11 +68,13 @@ void execd_stop_tls_server(void);
 int lrmd_server_send_reply(pcmk__client_t *client, uint32_t id, xmlNode *reply);
 
 int lrmd_server_send_notify(pcmk__client_t *client, xmlNode *msg);
+void execd_flush_notify_batches(void);
 
 void notify_of_new_client(pcmk__client_t *new_client);
 
 void process_lrmd_message(pcmk__client_t *client, uint32_t id,
                           xmlNode *request);
+void execd_free_batch_queue(void);
 
 void free_rsc(gpointer data);
 
@@ -27,12 +27,24 @@
 #include "pacemaker-execd.h"
 
 #include <gnutls/gnutls.h>
+#include <gnutls/crypto.h>
 
 #define LRMD_REMOTE_AUTH_TIMEOUT 10000
 gnutls_psk_server_credentials_t psk_cred_s;
 gnutls_dh_params_t dh_params;
 static int ssock = -1;
-extern int lrmd_call_id;
+
+/* Session tickets let reconnecting clients resume their previous TLS session
+ * rather than repeat a full handshake. A resumed session skips the PSK
+ * exchange, so the key for encrypting tickets is derived from both a secret
+ * (generated at start-up, never leaving memory) and the current authentication
+ * key. Replacing the authentication key therefore invalidates all earlier
+ * tickets, and tickets are valid only briefly and until this daemon restarts.
+ */
+#define LRMD_TLS_TICKET_LIFETIME_S 300
+
+static gnutls_datum_t ticket_secret = { NULL, 0 };
+static unsigned char ticket_key_data[64];   // SHA-512 digest of secret and key
 
 static void
 debug_log(int level, const char *str)
@@ -114,14 +126,9 @@ lrmd_remote_client_msg(gpointer data)
                                                   PCMK__XA_LRMD_CLIENTNAME);
         }
 
-        lrmd_call_id++;
-        if (lrmd_call_id < 1) {
-            lrmd_call_id = 1;
-        }
-
         crm_xml_add(request, PCMK__XA_LRMD_CLIENTID, client->id);
         crm_xml_add(request, PCMK__XA_LRMD_CLIENTNAME, client->name);
-        crm_xml_add_int(request, PCMK__XA_LRMD_CALLID, lrmd_call_id);
+        crm_xml_add_int(request, PCMK__XA_LRMD_CALLID, execd_next_call_id());
 
         process_lrmd_message(client, id, request);
         free_xml(request);
@@ -195,6 +202,42 @@ lrmd_auth_timeout_cb(gpointer data)
     return FALSE;
 }
 
+/*!
+ * \internal
+ * \brief Allow a new client's TLS session to be resumed later
+ *
+ * \param[in,out] session  TLS session for new client
+ */
+static void
+enable_session_resumption(gnutls_session_t session)
+{
+    gnutls_datum_t psk_key = { NULL, 0 };
+    gnutls_datum_t ticket_key = { ticket_key_data, sizeof(ticket_key_data) };
+    gnutls_hash_hd_t digest = NULL;
+    int rc = 0;
+
+    if ((ticket_secret.data == NULL)
+        || (lrmd__init_remote_key(&psk_key) != pcmk_rc_ok)) {
+        return;
+    }
+
+    rc = gnutls_hash_init(&digest, GNUTLS_DIG_SHA512);
+    if (rc == 0) {
+        gnutls_hash(digest, ticket_secret.data, ticket_secret.size);
+        gnutls_hash(digest, psk_key.data, psk_key.size);
+        gnutls_hash_deinit(digest, ticket_key_data);
+        rc = gnutls_session_ticket_enable_server(session, &ticket_key);
+    }
+    gnutls_free(psk_key.data);
+
+    if (rc != 0) {
+        crm_debug("Could not enable TLS session resumption for new client: %s",
+                  gnutls_strerror(rc));
+        return;
+    }
+    gnutls_db_set_cache_expiration(session, LRMD_TLS_TICKET_LIFETIME_S);
+}
+
 // Dispatch callback for remote server socket
 static int
 lrmd_remote_listen(gpointer data)
@@ -221,6 +264,7 @@ lrmd_remote_listen(gpointer data)
         close(csock);
         return TRUE;
     }
+    enable_session_resumption(*session);
 
     new_client = pcmk__new_unauth_client(NULL);
     new_client->remote = pcmk__assert_alloc(1, sizeof(pcmk__remote_t));
@@ -373,6 +417,14 @@ lrmd_init_remote_tls_server(void)
     }
     gnutls_free(psk_key.data);
 
+    if ((gnutls_session_ticket_key_generate(&ticket_secret) != 0)
+        || (ticket_secret.size != sizeof(ticket_key_data))) {
+        crm_warn("Reconnecting clients will need full TLS handshakes because "
+                 "session ticket key could not be generated");
+        gnutls_free(ticket_secret.data);
+        ticket_secret.data = NULL;
+    }
+
     if (get_address_info(bind_name, port, &res) != pcmk_rc_ok) {
         return -1;
     }
@@ -422,6 +474,11 @@ execd_stop_tls_server(void)
         psk_cred_s = 0;
     }
 
+    if (ticket_secret.data != NULL) {
+        gnutls_free(ticket_secret.data);
+        ticket_secret.data = NULL;
+    }
+
     if (ssock >= 0) {
         close(ssock);
         ssock = -1;
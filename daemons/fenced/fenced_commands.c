@@ -3570,6 +3570,7 @@ fenced_register_handlers(void)
         { STONITH_OP_LEVEL_ADD, handle_level_add_request },
         { STONITH_OP_LEVEL_DEL, handle_level_delete_request },
         { CRM_OP_RM_NODE_CACHE, handle_cache_request },
+        { PCMK__OP_SET_TRACE, pcmk__handle_set_trace_request },
         { NULL, handle_unknown_request },
     };
 
@@ -25,6 +25,7 @@
 #include <crm/common/cmdline_internal.h>
 #include <crm/common/ipc.h>
 #include <crm/common/ipc_internal.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/output_internal.h>
 
 #include <crm/stonith-ng.h>
@@ -654,6 +655,7 @@ main(int argc, char **argv)
     pcmk__serve_fenced_ipc(&ipcs, &ipc_callbacks);
 
     // Create the mainloop and run it...
+    pcmk__metrics_init(crm_system_name);
     mainloop = g_main_loop_new(NULL, FALSE);
     crm_notice("Pacemaker fencer successfully started and accepting connections");
     g_main_loop_run(mainloop);
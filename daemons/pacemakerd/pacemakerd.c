@@ -29,6 +29,7 @@
 #include <crm/common/xml.h>
 #include <crm/common/cmdline_internal.h>
 #include <crm/common/ipc_pacemakerd.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/output_internal.h>
 #include <crm/cluster/internal.h>
 #include <crm/cluster.h>
@@ -460,6 +461,7 @@ main(int argc, char **argv)
         init_children_processes(NULL);
     }
 
+    pcmk__metrics_init(crm_system_name);
     crm_notice("Pacemaker daemon successfully started and accepting connections");
     g_main_loop_run(mainloop);
 
@@ -160,6 +160,7 @@ pcmkd_register_handlers(void)
         { CRM_OP_RM_NODE_CACHE, handle_node_cache_request },
         { CRM_OP_PING, handle_ping_request },
         { CRM_OP_QUIT, handle_shutdown_request },
+        { PCMK__OP_SET_TRACE, pcmk__handle_set_trace_request },
         { NULL, handle_unknown_request },
     };
 
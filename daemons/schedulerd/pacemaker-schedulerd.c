@@ -19,6 +19,7 @@
 #include <crm/common/cmdline_internal.h>
 #include <crm/common/ipc_internal.h>
 #include <crm/common/mainloop.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/pengine/internal.h>
 #include <pacemaker-internal.h>
 
@@ -160,6 +161,7 @@ main(int argc, char **argv)
     pcmk__output_set_log_level(logger_out, LOG_TRACE);
 
     /* Create the mainloop and run it... */
+    pcmk__metrics_init(crm_system_name);
     mainloop = g_main_loop_new(NULL, FALSE);
     crm_notice("Pacemaker scheduler successfully started and accepting connections");
     g_main_loop_run(mainloop);
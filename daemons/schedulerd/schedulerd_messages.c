@@ -10,16 +10,23 @@
 #include <crm_internal.h>
 
 #include <crm/crm.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/xml.h>
 #include <pacemaker-internal.h>
 
 #include <stdbool.h>
+#include <stdio.h>            // rename()
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <qb/qbutil.h>        // qb_util_nano_current_get()
+
 #include "pacemaker-schedulerd.h"
 
+// Where scheduler input is saved until its series is known
+#define SAVED_INPUT PE_STATE_DIR "/pe-input.tmp"
+
 static GHashTable *schedulerd_handlers = NULL;
 
 static pcmk_scheduler_t *
@@ -39,6 +46,38 @@ init_working_set(void)
     return scheduler;
 }
 
+/*!
+ * \internal
+ * \brief Update metrics for a completed scheduler run
+ *
+ * \param[in] start_ns   Monotonic time (in nanoseconds) scheduling started
+ * \param[in] scheduler  Scheduler data after scheduling
+ */
+static void
+record_scheduler_metrics(uint64_t start_ns, const pcmk_scheduler_t *scheduler)
+{
+    double elapsed = (qb_util_nano_current_get() - start_ns)
+                     / (double) QB_TIME_NS_IN_SEC;
+    int synapses = 0;
+
+    for (const xmlNode *synapse = pcmk__xe_first_child(scheduler->graph,
+                                                       "synapse", NULL, NULL);
+         synapse != NULL; synapse = pcmk__xe_next_same(synapse)) {
+        synapses++;
+    }
+
+    pcmk__metric_observe(pcmk__metric(pcmk__metric_seconds,
+                                      "pacemaker_scheduler_run_duration_seconds",
+                                      "Time taken to calculate transitions",
+                                      NULL, NULL),
+                         elapsed);
+    pcmk__metric_observe(pcmk__metric(pcmk__metric_sizes,
+                                      "pacemaker_transition_synapses",
+                                      "Synapses in calculated transitions",
+                                      NULL, NULL),
+                         synapses);
+}
+
 static xmlNode *
 handle_pecalc_request(pcmk__request_t *request)
 {
@@ -71,6 +110,7 @@ handle_pecalc_request(pcmk__request_t *request)
     time_t execution_date = time(NULL);
     xmlNode *converted = NULL;
     xmlNode *reply = NULL;
+    bool saved = false;
     bool is_repoke = false;
     bool process = true;
     pcmk_scheduler_t *scheduler = init_working_set();
@@ -80,7 +120,26 @@ handle_pecalc_request(pcmk__request_t *request)
 
     digest = calculate_xml_versioned_digest(xml_data, FALSE, FALSE,
                                             CRM_FEATURE_SET);
-    converted = pcmk__xml_copy(NULL, xml_data);
+    is_repoke = pcmk__str_eq(digest, last_digest, pcmk__str_casei);
+
+    /* The scheduler annotates its input (for example, resource history entries
+     * whose failures have expired), so save the input as received before
+     * scheduling it. Which series it belongs to isn't known until then, so
+     * write it to a temporary file to be renamed afterward.
+     */
+    if (!is_repoke) {
+        crm_xml_add_ll(xml_data, PCMK_XA_EXECUTION_DATE,
+                       (long long) execution_date);
+        saved = (pcmk__xml_write_file(xml_data, SAVED_INPUT, true,
+                                      NULL) == pcmk_rc_ok);
+    }
+
+    /* Schedule the received input rather than a copy. The schema update
+     * replaces the input if it must be transformed, so take it out of the
+     * request first.
+     */
+    xmlUnlinkNode(xml_data);
+    converted = xml_data;
     if (pcmk_update_configured_schema(&converted, true) != pcmk_rc_ok) {
         scheduler->graph = pcmk__xe_create(NULL, PCMK__XE_TRANSITION_GRAPH);
         crm_xml_add_int(scheduler->graph, "transition_id", 0);
@@ -88,8 +147,7 @@ handle_pecalc_request(pcmk__request_t *request)
         process = false;
         free(digest);
 
-    } else if (pcmk__str_eq(digest, last_digest, pcmk__str_casei)) {
-        is_repoke = true;
+    } else if (is_repoke) {
         free(digest);
 
     } else {
@@ -98,10 +156,13 @@ handle_pecalc_request(pcmk__request_t *request)
     }
 
     if (process) {
+        uint64_t start_ns = qb_util_nano_current_get();
+
         pcmk__schedule_actions(converted,
                                pcmk_sched_no_counts
                                |pcmk_sched_no_compat
                                |pcmk_sched_show_utilization, scheduler);
+        record_scheduler_metrics(start_ns, scheduler);
     }
 
     // Get appropriate index into series[] array
@@ -162,11 +223,13 @@ handle_pecalc_request(pcmk__request_t *request)
     } else if (is_repoke) {
         crm_info("Input has not changed since last time, not saving to disk");
 
-    } else {
+    } else if (saved) {
         unlink(filename);
-        crm_xml_add_ll(xml_data, PCMK_XA_EXECUTION_DATE,
-                       (long long) execution_date);
-        pcmk__xml_write_file(xml_data, filename, true, NULL);
+        if (rename(SAVED_INPUT, filename) == 0) {
+            saved = false;
+        } else {
+            crm_warn("Could not save %s: %s", filename, strerror(errno));
+        }
         pcmk__write_series_sequence(PE_STATE_DIR, series[series_id].name,
                                     ++seq, series_wrap);
     }
@@ -174,6 +237,9 @@ handle_pecalc_request(pcmk__request_t *request)
     pcmk__set_result(&request->result, CRM_EX_OK, PCMK_EXEC_DONE, NULL);
 
 done:
+    if (saved) {
+        unlink(SAVED_INPUT);
+    }
     free_xml(converted);
     pe_free_working_set(scheduler);
 
@@ -210,6 +276,7 @@ schedulerd_register_handlers(void)
     pcmk__server_command_t handlers[] = {
         { CRM_OP_HELLO, handle_hello_request },
         { CRM_OP_PECALC, handle_pecalc_request },
+        { PCMK__OP_SET_TRACE, pcmk__handle_set_trace_request },
         { NULL, handle_unknown_request },
     };
 
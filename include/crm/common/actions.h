@@ -370,11 +370,14 @@ struct pe_action_s {
     GList *actions_before;
     GList *actions_after;
 
-    /* This is intended to hold data that varies by the type of action, but is
-     * not currently used. Some of the above fields could be moved here except
-     * for API backward compatibility.
+    /* This is intended to hold data that varies by the type of action. It is
+     * currently used only for clone notification data shared by all actions
+     * in a notification round (for Pacemaker use only). Some of the above
+     * fields could be moved here except for API backward compatibility.
      */
     void *action_details;
+
+    pcmk_scheduler_t *scheduler;    // Scheduler data action belongs to
 };
 //!@}
 
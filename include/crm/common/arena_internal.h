@@ -0,0 +1,40 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU Lesser General Public License
+ * version 2.1 or later (LGPLv2.1+) WITHOUT ANY WARRANTY.
+ */
+
+#ifndef PCMK__CRM_COMMON_ARENA_INTERNAL__H
+#define PCMK__CRM_COMMON_ARENA_INTERNAL__H
+
+#include <stddef.h>     // size_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* An arena hands out memory by bumping a pointer through large chunks, and
+ * releases everything it handed out at once. Memory allocated from an arena
+ * must never be passed to free().
+ */
+typedef struct pcmk__arena_s pcmk__arena_t;
+
+//! Default size of arena chunks (in bytes)
+#define PCMK__ARENA_CHUNK_SIZE  (256 * 1024)
+
+pcmk__arena_t *pcmk__arena_new(size_t chunk_size);
+void pcmk__arena_free(pcmk__arena_t *arena);
+void pcmk__arena_reset(pcmk__arena_t *arena);
+void *pcmk__arena_alloc(pcmk__arena_t *arena, size_t size);
+char *pcmk__arena_strdup(pcmk__arena_t *arena, const char *str);
+size_t pcmk__arena_used(const pcmk__arena_t *arena);
+size_t pcmk__arena_peak(const pcmk__arena_t *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PCMK__CRM_COMMON_ARENA_INTERNAL__H
@@ -130,6 +130,7 @@ pid_t pcmk__procfs_pid_of(const char *name);
 unsigned int pcmk__procfs_num_cores(void);
 int pcmk__procfs_pid2path(pid_t pid, char path[], size_t path_size);
 bool pcmk__procfs_has_pids(void);
+int pcmk__procfs_pressure(const char *resource, double *some, double *full);
 
 /* internal functions related to process IDs (from pid.c) */
 
@@ -391,5 +392,11 @@ pcmk__lastfailure_name(const char *rsc_id, const char *op, guint interval_ms)
 
 // internal resource agent functions (from agents.c)
 int pcmk__effective_rc(int rc);
+int pcmk__cached_agent_metadata(const char *standard, const char *provider,
+                                const char *type, const char *agent_path,
+                                char **output);
+void pcmk__cache_agent_metadata(const char *standard, const char *provider,
+                                const char *type, const char *agent_path,
+                                const char *output);
 
 #endif /* CRM_COMMON_INTERNAL__H */
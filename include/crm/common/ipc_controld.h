@@ -35,6 +35,8 @@ enum pcmk_controld_api_reply {
     pcmk_controld_reply_resource,
     pcmk_controld_reply_ping,
     pcmk_controld_reply_nodes,
+    pcmk_controld_reply_metrics,
+    pcmk_controld_reply_set_trace,
 };
 
 // Node information passed with pcmk_controld_reply_nodes
@@ -47,10 +49,11 @@ typedef struct {
 /*!
  * Controller reply passed to event callback
  *
- * \note Shutdown and election calls have no reply. Reprobe calls are
+ * \note Shutdown and election calls have no reply. Reprobe and trace calls are
  *       acknowledged but contain no data (reply_type will be the only item
- *       set). Node info and ping calls have their own reply data. Fail and
- *       refresh calls use the resource reply type and reply data.
+ *       set, and the event status gives the result of a trace call). Node
+ *       info, ping, node list, and metrics calls have their own reply data.
+ *       Fail and refresh calls use the resource reply type and reply data.
  * \note The pointers in the reply are only guaranteed to be meaningful for the
  *       execution of the callback; if the values are needed for later, the
  *       callback should copy them.
@@ -85,6 +88,9 @@ typedef struct {
 
         // pcmk_controld_reply_nodes
         GList *nodes; // list of pcmk_controld_api_node_t *
+
+        // pcmk_controld_reply_metrics
+        xmlNode *metrics;   //!< Controller metrics XML
     } data;
 } pcmk_controld_api_reply_t;
 
@@ -102,6 +108,7 @@ int pcmk_controld_api_refresh(pcmk_ipc_api_t *api, const char *target_node,
                               bool cib_only);
 int pcmk_controld_api_ping(pcmk_ipc_api_t *api, const char *node_name);
 int pcmk_controld_api_list_nodes(pcmk_ipc_api_t *api);
+int pcmk_controld_api_metrics(pcmk_ipc_api_t *api);
 unsigned int pcmk_controld_api_replies_expected(const pcmk_ipc_api_t *api);
 
 #ifdef __cplusplus
@@ -243,7 +243,7 @@ int pcmk__ipc_send_ack_as(const char *function, int line, pcmk__client_t *c,
     pcmk__ipc_send_ack_as(__func__, __LINE__, (c), (req), (flags), (tag), (ver), (st))
 
 int pcmk__ipc_prepare_iov(uint32_t request, const xmlNode *message,
-                          uint32_t max_send_size,
+                          uint32_t max_send_size, bool packed,
                           struct iovec **result, ssize_t *bytes);
 int pcmk__ipc_send_xml(pcmk__client_t *c, uint32_t request,
                        const xmlNode *message, uint32_t flags);
@@ -281,6 +281,9 @@ pcmk__ipc_sys_name(const char *ipc_name, const char *fallback)
 const char *pcmk__pcmkd_state_enum2friendly(enum pcmk_pacemakerd_state state);
 
 const char *pcmk__controld_api_reply2str(enum pcmk_controld_api_reply reply);
+int pcmk__controld_api_set_trace(pcmk_ipc_api_t *api, const char *files,
+                                 const char *functions, const char *formats,
+                                 const char *tags);
 const char *pcmk__pcmkd_api_reply2str(enum pcmk_pacemakerd_api_reply reply);
 
 #ifdef __cplusplus
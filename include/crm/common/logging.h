@@ -11,6 +11,7 @@
 #define PCMK__CRM_COMMON_LOGGING__H
 
 #include <stdio.h>
+#include <stdbool.h>            // bool
 #include <stdint.h>             // uint8_t, uint32_t
 #include <glib.h>
 #include <qb/qblog.h>
@@ -167,6 +168,37 @@ pcmk__clip_log_level(int level)
     return level;
 }
 
+/*!
+ * \internal
+ * \brief Check whether a log callsite is enabled
+ *
+ * Whether a callsite is enabled is cached in its \c targets, which is updated
+ * whenever the logging configuration changes. This checks that directly, and
+ * calls \c crm_is_callsite_active() only if the callsite's level or tags need
+ * to be refiltered, so that a disabled log call costs no function call and
+ * never evaluates its arguments.
+ *
+ * \param[in,out] cs     Log callsite to check
+ * \param[in]     level  Priority that callsite is being used with
+ * \param[in]     tags   Tags that callsite is being used with
+ *
+ * \return true if a message logged at \p cs would go anywhere, otherwise false
+ */
+/* @COMPAT: Make this function internal at a compatibility break. It's used in
+ * public macros for now.
+ */
+static inline bool
+pcmk__callsite_active(struct qb_log_callsite *cs, uint8_t level, uint32_t tags)
+{
+    if (cs == NULL) {
+        return false;
+    }
+    if ((cs->priority == level) && (cs->tags == tags)) {
+        return cs->targets != 0;
+    }
+    return crm_is_callsite_active(cs, level, tags);
+}
+
 /* Using "switch" instead of "if" in these macro definitions keeps
  * static analysis from complaining about constant evaluations
  */
@@ -215,7 +247,7 @@ pcmk__clip_log_level(int level)
                     trace_cs = qb_log_callsite_get(__func__, __FILE__, fmt, \
                                                    _level, __LINE__, 0);    \
                 }                                                           \
-                if (crm_is_callsite_active(trace_cs, _level, 0)) {          \
+                if (pcmk__callsite_active(trace_cs, _level, 0)) {           \
                     qb_log_from_external_source(__func__, __FILE__, fmt,    \
                                                 _level, __LINE__, 0 ,       \
                                                 ##args);                    \
@@ -279,7 +311,7 @@ pcmk__clip_log_level(int level)
                                                  "xml-blob", _level,    \
                                                  __LINE__, 0);          \
                 }                                                       \
-                if (crm_is_callsite_active(xml_cs, _level, 0)) {        \
+                if (pcmk__callsite_active(xml_cs, _level, 0)) {         \
                     pcmk_log_xml_as(__FILE__, __func__, __LINE__, 0,    \
                                     _level, text, (xml));               \
                 }                                                       \
@@ -374,8 +406,8 @@ pcmk__clip_log_level(int level)
                                                        __LINE__,            \
                                                        converted_tag);      \
                 }                                                           \
-                if (crm_is_callsite_active(trace_tag_cs, _level,            \
-                                           converted_tag)) {                \
+                if (pcmk__callsite_active(trace_tag_cs, _level,             \
+                                          converted_tag)) {                 \
                     qb_log_from_external_source(__func__, __FILE__, fmt,    \
                                                 _level, __LINE__,           \
                                                 converted_tag , ##args);    \
@@ -413,9 +445,11 @@ pcmk__clip_log_level(int level)
 
 #define crm_log_xml_explicit(xml, text)  do {                   \
         static struct qb_log_callsite *digest_cs = NULL;        \
-        digest_cs = qb_log_callsite_get(                        \
-            __func__, __FILE__, text, LOG_TRACE, __LINE__,      \
-            crm_trace_nonlog);                                  \
+        if (digest_cs == NULL) {                                \
+            digest_cs = qb_log_callsite_get(                    \
+                __func__, __FILE__, text, LOG_TRACE, __LINE__,  \
+                crm_trace_nonlog);                              \
+        }                                                       \
         if (digest_cs && digest_cs->targets) {                  \
             do_crm_log_xml(LOG_TRACE,   text, xml);             \
         }                                                       \
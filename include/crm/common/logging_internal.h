@@ -140,8 +140,8 @@ void pcmk__set_config_warning_handler(pcmk__config_warning_func warning_handler,
                                            "if_tracing", LOG_TRACE,     \
                                            __LINE__, crm_trace_nonlog); \
         }                                                               \
-        if (crm_is_callsite_active(trace_cs, LOG_TRACE,                 \
-                                   crm_trace_nonlog)) {                 \
+        if (pcmk__callsite_active(trace_cs, LOG_TRACE,                  \
+                                  crm_trace_nonlog)) {                  \
             if_action;                                                  \
         } else {                                                        \
             else_action;                                                \
@@ -171,7 +171,7 @@ void pcmk__set_config_warning_handler(pcmk__config_warning_func warning_handler,
                                                  "xml-changes", _level,     \
                                                  __LINE__, 0);              \
                 }                                                           \
-                if (crm_is_callsite_active(xml_cs, _level, 0)) {            \
+                if (pcmk__callsite_active(xml_cs, _level, 0)) {             \
                     pcmk__log_xml_changes_as(__FILE__, __func__, __LINE__,  \
                                              0, _level, xml);               \
                 }                                                           \
@@ -202,7 +202,7 @@ void pcmk__set_config_warning_handler(pcmk__config_warning_func warning_handler,
                                                  "xml-patchset", _level,    \
                                                  __LINE__, 0);              \
                 }                                                           \
-                if (crm_is_callsite_active(xml_cs, _level, 0)) {            \
+                if (pcmk__callsite_active(xml_cs, _level, 0)) {             \
                     pcmk__log_xml_patchset_as(__FILE__, __func__, __LINE__, \
                                               0, _level, patchset);         \
                 }                                                           \
@@ -234,6 +234,9 @@ void pcmk__add_logfiles(gchar **log_files, pcmk__output_t *out);
 
 void pcmk__free_common_logger(void);
 
+void pcmk__set_trace_options(const char *files, const char *functions,
+                             const char *formats, const char *tags);
+
 #ifdef __cplusplus
 }
 #endif
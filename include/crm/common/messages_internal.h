@@ -73,10 +73,16 @@ typedef struct {
     xmlNode *(*handler)(pcmk__request_t *request);
 } pcmk__server_command_t;
 
+/* IPC request (for daemons that support it) to change which log callsites are
+ * traced, without restarting the daemon
+ */
+#define PCMK__OP_SET_TRACE "set-trace"
+
 const char *pcmk__message_name(const char *name);
 GHashTable *pcmk__register_handlers(const pcmk__server_command_t handlers[]);
 xmlNode *pcmk__process_request(pcmk__request_t *request, GHashTable *handlers);
 void pcmk__reset_request(pcmk__request_t *request);
+xmlNode *pcmk__handle_set_trace_request(pcmk__request_t *request);
 
 /*!
  * \internal
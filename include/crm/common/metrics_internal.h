@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU Lesser General Public License
+ * version 2.1 or later (LGPLv2.1+) WITHOUT ANY WARRANTY.
+ */
+
+#ifndef PCMK__CRM_COMMON_METRICS_INTERNAL__H
+#define PCMK__CRM_COMMON_METRICS_INTERNAL__H
+
+#include <glib.h>               // GString
+#include <libxml/tree.h>        // xmlNode
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * \internal
+ * \brief Kinds of metric a process can keep
+ */
+enum pcmk__metric_type {
+    pcmk__metric_counter,   //!< Monotonically increasing total
+    pcmk__metric_gauge,     //!< Value that can go up and down
+    pcmk__metric_seconds,   //!< Histogram of durations in seconds
+    pcmk__metric_sizes,     //!< Histogram of counts (queue lengths and such)
+};
+
+typedef struct pcmk__metric_s pcmk__metric_t;
+
+pcmk__metric_t *pcmk__metric(enum pcmk__metric_type type, const char *name,
+                             const char *help, const char *label,
+                             const char *label_value);
+void pcmk__metric_add(pcmk__metric_t *metric, double value);
+void pcmk__metric_set(pcmk__metric_t *metric, double value);
+void pcmk__metric_observe(pcmk__metric_t *metric, double value);
+
+xmlNode *pcmk__metrics_xml(xmlNode *parent);
+void pcmk__metrics_xml_to_text(const xmlNode *xml, GString *buffer);
+
+void pcmk__metrics_init(const char *daemon);
+void pcmk__metrics_cleanup(void);
+
+/*!
+ * \internal
+ * \brief Get (creating if needed) an unlabeled counter
+ *
+ * \param[in] name  Metric family name (without "_total")
+ * \param[in] help  Description of metric
+ *
+ * \return Counter (valid until \c pcmk__metrics_cleanup())
+ */
+static inline pcmk__metric_t *
+pcmk__metric_counter(const char *name, const char *help)
+{
+    return pcmk__metric(pcmk__metric_counter, name, help, NULL, NULL);
+}
+
+/*!
+ * \internal
+ * \brief Get (creating if needed) an unlabeled gauge
+ *
+ * \param[in] name  Metric family name
+ * \param[in] help  Description of metric
+ *
+ * \return Gauge (valid until \c pcmk__metrics_cleanup())
+ */
+static inline pcmk__metric_t *
+pcmk__metric_gauge(const char *name, const char *help)
+{
+    return pcmk__metric(pcmk__metric_gauge, name, help, NULL, NULL);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PCMK__CRM_COMMON_METRICS_INTERNAL__H
@@ -264,6 +264,9 @@ struct pe_working_set_s {
     void *priv;                     // For Pacemaker use only
 
     guint node_pending_timeout;     // Pending join times out after this (ms)
+
+    // For Pacemaker use only
+    struct pcmk__scheduler_private *internal;
 };
 //!@}
 
@@ -10,8 +10,13 @@
 #ifndef PCMK__CRM_COMMON_SCHEDULER_INTERNAL__H
 #define PCMK__CRM_COMMON_SCHEDULER_INTERNAL__H
 
+#include <stdbool.h>    // bool
+#include <stddef.h>     // offsetof()
+#include <glib.h>       // GHashTable
+
 #include <crm/common/action_relation_internal.h>
 #include <crm/common/actions_internal.h>
+#include <crm/common/arena_internal.h>
 #include <crm/common/attrs_internal.h>
 #include <crm/common/bundles_internal.h>
 #include <crm/common/clone_internal.h>
@@ -46,6 +51,89 @@ enum pcmk__check_parameters {
 // Group of enum pcmk__warnings flags for warnings we want to log once
 extern uint32_t pcmk__warnings;
 
+// Scheduler data that is for Pacemaker use only
+typedef struct pcmk__scheduler_private {
+    /* Objects that live until the scheduler data is reset are allocated from
+     * this, if not NULL, and are all released at once when it is reset
+     */
+    pcmk__arena_t *arena;
+
+    GHashTable *strings;    // Interned strings (as pcmk__interned_t *)
+    GHashTable *folded;     // First interned spelling of each string ignoring
+                            // case (keys are the values)
+
+    /* Indexes of scheduler objects, so that lookups by name do not need to
+     * walk scheduler->nodes or scheduler->resources
+     */
+    GHashTable *node_ids;   // Node ID (ignoring case) -> first matching node
+                            // in scheduler->nodes
+    GHashTable *node_names; // Node name (ignoring case) -> first matching node
+                            // in scheduler->nodes
+    GHashTable *rsc_names;  // Resource ID, base name, XML ID, or history name
+                            // -> GPtrArray of resources that may match it
+
+    /* Clone instances and bundle replica containers indexed by node, built
+     * on demand when interleaving, for each collective resource -> hash table
+     * of node details -> GPtrArray of instances active (or assigned) there
+     */
+    GHashTable *current_instances;  // Indexed by current node
+    GHashTable *next_instances;     // Indexed by assigned node (discarded
+                                    // whenever any assignment changes)
+
+    /* Main operation digests that are the same on every node, built on demand
+     * for each resource parameter table shared by all nodes -> table of
+     * operation key and feature set -> pcmk__op_digest_t *
+     */
+    GHashTable *main_digests;
+
+    /* Clone notification data written to the transition graph being created,
+     * which actions refer to by ID (serialized data -> ID)
+     */
+    GHashTable *graph_notify_data;
+} pcmk__scheduler_private_t;
+
+/* An interned string is stored once per scheduler run, preceded by a pointer
+ * to the first interned string that is equal to it ignoring case. Two
+ * interned strings are equal ignoring case if and only if they have the same
+ * folded pointer, which lets case-insensitive comparisons of scheduler object
+ * names be done without looking at the characters.
+ */
+typedef struct {
+    const char *fold;   // First interned string equal to this ignoring case
+    char str[];         // String itself
+} pcmk__interned_t;
+
+pcmk__scheduler_private_t *pcmk__new_scheduler_private(void);
+void pcmk__free_scheduler_private(pcmk__scheduler_private_t *priv);
+void pcmk__reset_scheduler_private(pcmk_scheduler_t *scheduler);
+void pcmk__sched_assignment_changed(pcmk_scheduler_t *scheduler);
+
+void *pcmk__sched_alloc(pcmk_scheduler_t *scheduler, size_t size);
+char *pcmk__sched_strdup(pcmk_scheduler_t *scheduler, const char *str);
+void pcmk__sched_free(pcmk_scheduler_t *scheduler, void *ptr);
+
+bool pcmk__sched_interning(const pcmk_scheduler_t *scheduler);
+const char *pcmk__sched_intern(pcmk_scheduler_t *scheduler, const char *str);
+const char *pcmk__sched_fold(const pcmk_scheduler_t *scheduler,
+                             const char *str);
+
+/*!
+ * \internal
+ * \brief Get the case-folded handle of an interned string
+ *
+ * \param[in] interned  String returned by \c pcmk__sched_intern() while
+ *                      interning was enabled
+ *
+ * \return First string interned for the same scheduler data that is equal to
+ *         \p interned ignoring case
+ */
+static inline const char *
+pcmk__interned_fold(const char *interned)
+{
+    return ((const pcmk__interned_t *)
+            (interned - offsetof(pcmk__interned_t, str)))->fold;
+}
+
 /*!
  * \internal
  * \brief Log a resource-tagged message at info severity
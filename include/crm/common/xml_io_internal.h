@@ -15,6 +15,8 @@
  */
 
 #include <stdbool.h>        // bool
+#include <stddef.h>         // size_t
+#include <stdint.h>         // uint32_t
 
 #include <glib.h>           // GString
 #include <libxml/tree.h>    // xmlNode
@@ -25,6 +27,25 @@ xmlNode *pcmk__xml_parse(const char *input);
 void pcmk__xml_string(const xmlNode *data, uint32_t options, GString *buffer,
                       int depth);
 
+/*!
+ * \internal
+ * \brief Function that consumes a chunk of serialized XML text
+ *
+ * \param[in]     text       Text (not nul-terminated)
+ * \param[in]     length     Number of bytes in \p text
+ * \param[in,out] user_data  Caller-supplied data
+ *
+ * \return Standard Pacemaker return code
+ */
+typedef int (*pcmk__xml_write_fn)(const char *text, size_t length,
+                                  void *user_data);
+
+int pcmk__xml_stream(const xmlNode *xml, uint32_t options,
+                     pcmk__xml_write_fn write_fn, void *user_data);
+
+void pcmk__xml_pack(const xmlNode *xml, GString *buffer);
+xmlNode *pcmk__xml_unpack(const char *data, size_t length);
+
 int pcmk__xml2fd(int fd, xmlNode *cur);
 int pcmk__xml_write_fd(const xmlNode *xml, const char *filename, int fd,
                        bool compress, unsigned int *nbytes);
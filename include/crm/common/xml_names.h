@@ -69,6 +69,7 @@ extern "C" {
 #define PCMK_XE_ATTRIBUTE                   "attribute"
 #define PCMK_XE_BAN                         "ban"
 #define PCMK_XE_BANS                        "bans"
+#define PCMK_XE_BUCKET                      "bucket"
 #define PCMK_XE_BUNDLE                      "bundle"
 #define PCMK_XE_CAPACITY                    "capacity"
 #define PCMK_XE_CHANGE                      "change"
@@ -129,6 +130,8 @@ extern "C" {
 #define PCMK_XE_LONGDESC                    "longdesc"
 #define PCMK_XE_META_ATTRIBUTES             "meta_attributes"
 #define PCMK_XE_METADATA                    "metadata"
+#define PCMK_XE_METRIC                      "metric"
+#define PCMK_XE_METRICS                     "metrics"
 #define PCMK_XE_MODIFICATIONS               "modifications"
 #define PCMK_XE_MODIFY_NODE                 "modify_node"
 #define PCMK_XE_MODIFY_TICKET               "modify_ticket"
@@ -168,6 +171,9 @@ extern "C" {
 #define PCMK_XE_PSEUDO_ACTION               "pseudo_action"
 #define PCMK_XE_REASON                      "reason"
 #define PCMK_XE_RECIPIENT                   "recipient"
+#define PCMK_XE_REPLAY                      "replay"
+#define PCMK_XE_REPLAY_SUMMARY              "replay-summary"
+#define PCMK_XE_REPLAYS                     "replays"
 #define PCMK_XE_REPLICA                     "replica"
 #define PCMK_XE_RESOURCE                    "resource"
 #define PCMK_XE_RESOURCE_AGENT              "resource-agent"
@@ -254,6 +260,7 @@ extern "C" {
 #define PCMK_XA_CRM_FEATURE_SET             "crm_feature_set"
 #define PCMK_XA_CRM_TIMESTAMP               "crm-timestamp"
 #define PCMK_XA_CRMD                        "crmd"
+#define PCMK_XA_DAEMON                      "daemon"
 #define PCMK_XA_DAYS                        "days"
 #define PCMK_XA_DC_UUID                     "dc-uuid"
 #define PCMK_XA_DEFAULT                     "default"
@@ -291,6 +298,7 @@ extern "C" {
 #define PCMK_XA_FORMAT                      "format"
 #define PCMK_XA_FUNCTION                    "function"
 #define PCMK_XA_GENERATED                   "generated"
+#define PCMK_XA_GRAPH_DURATION              "graph-duration"
 #define PCMK_XA_HASH                        "hash"
 #define PCMK_XA_HAVE_QUORUM                 "have-quorum"
 #define PCMK_XA_HEALTH                      "health"
@@ -309,7 +317,10 @@ extern "C" {
 #define PCMK_XA_INTERVAL                    "interval"
 #define PCMK_XA_IP_RANGE_START              "ip-range-start"
 #define PCMK_XA_IS_DC                       "is_dc"
+#define PCMK_XA_JOBS                        "jobs"
 #define PCMK_XA_KIND                        "kind"
+#define PCMK_XA_LABEL                       "label"
+#define PCMK_XA_LABEL_VALUE                 "label-value"
 #define PCMK_XA_LANG                        "lang"
 #define PCMK_XA_LAST_FAILURE                "last-failure"
 #define PCMK_XA_LAST_GRANTED                "last-granted"
@@ -392,6 +403,7 @@ extern "C" {
 #define PCMK_XA_RUN_COMMAND                 "run-command"
 #define PCMK_XA_RUNNING                     "running"
 #define PCMK_XA_RUNNING_ON                  "running_on"
+#define PCMK_XA_SCHEDULE_DURATION           "schedule-duration"
 #define PCMK_XA_SCOPE                       "scope"
 #define PCMK_XA_SCORE                       "score"
 #define PCMK_XA_SCORE_ATTRIBUTE             "score-attribute"
@@ -411,6 +423,7 @@ extern "C" {
 #define PCMK_XA_STONITH_ENABLED             "stonith-enabled"
 #define PCMK_XA_STONITH_TIMEOUT_MS          "stonith-timeout-ms"
 #define PCMK_XA_STOP_ALL_RESOURCES          "stop-all-resources"
+#define PCMK_XA_SUM                         "sum"
 #define PCMK_XA_SYMMETRIC_CLUSTER           "symmetric-cluster"
 #define PCMK_XA_SYMMETRICAL                 "symmetrical"
 #define PCMK_XA_SYS_FROM                    "sys_from"
@@ -433,9 +446,11 @@ extern "C" {
 #define PCMK_XA_UNHEALTHY                   "unhealthy"
 #define PCMK_XA_UNIQUE                      "unique"
 #define PCMK_XA_UNMANAGED                   "unmanaged"
+#define PCMK_XA_UNPACK_DURATION             "unpack-duration"
 #define PCMK_XA_UPDATE_CLIENT               "update-client"
 #define PCMK_XA_UPDATE_ORIGIN               "update-origin"
 #define PCMK_XA_UPDATE_USER                 "update-user"
+#define PCMK_XA_UPPER_BOUND                 "upper-bound"
 #define PCMK_XA_USER                        "user"
 #define PCMK_XA_VALID                       "valid"
 #define PCMK_XA_VALIDATE_WITH               "validate-with"
@@ -40,10 +40,12 @@ typedef struct lrmd_key_value_s {
  * Protocol  Pacemaker  Significant changes
  * --------  ---------  -------------------
  *   1.2       2.1.8    PCMK__CIB_REQUEST_SCHEMAS
+ *   1.3       2.1.9    LRMD_OP_RSC_EXEC_BATCH
  */
-#define LRMD_PROTOCOL_VERSION "1.2"
+#define LRMD_PROTOCOL_VERSION "1.3"
 
 #define LRMD_SUPPORTS_SCHEMA_XFER(x) (compare_version((x), "1.2") >= 0)
+#define LRMD_SUPPORTS_EXEC_BATCH(x) (compare_version((x), "1.3") >= 0)
 
 /* The major protocol version the client and server both need to support for
  * the connection to be successful.  This should only ever be the major
@@ -69,6 +71,7 @@ typedef struct lrmd_key_value_s {
 
 #define LRMD_OP_RSC_REG           "lrmd_rsc_register"
 #define LRMD_OP_RSC_EXEC          "lrmd_rsc_exec"
+#define LRMD_OP_RSC_EXEC_BATCH    "lrmd_rsc_exec_batch"
 #define LRMD_OP_RSC_CANCEL        "lrmd_rsc_cancel"
 #define LRMD_OP_RSC_UNREG         "lrmd_rsc_unregister"
 #define LRMD_OP_RSC_INFO          "lrmd_rsc_info"
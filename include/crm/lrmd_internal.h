@@ -46,6 +46,43 @@ void lrmd__set_result(lrmd_event_data_t *event, enum ocf_exitcode rc,
 
 void lrmd__reset_result(lrmd_event_data_t *event);
 
+//! Resource action to request in a batch (see \c lrmd__exec_batch())
+typedef struct {
+    const char *rsc_id;
+    const char *action;
+    const char *userdata;
+    guint interval_ms;
+    int timeout;            // Milliseconds
+    int start_delay;        // Milliseconds
+    GHashTable *params;     // Resource parameters (may be NULL)
+    int call_id;            // Set to call ID (or negative errno) on return
+} lrmd__exec_request_t;
+
+int lrmd__exec_batch(lrmd_t *lrmd, lrmd__exec_request_t *requests,
+                     int n_requests, enum lrmd_call_options options);
+
+int lrmd__exec_async(lrmd_t *lrmd, const char *rsc_id, const char *action,
+                     const char *userdata, guint interval_ms, int timeout,
+                     int start_delay, enum lrmd_call_options options,
+                     lrmd_key_value_t *params,
+                     void (*callback)(int rc, void *user_data),
+                     void *user_data);
+
+//! Round-trip statistics for a Pacemaker Remote connection
+typedef struct {
+    guint64 replies;            // Replies received
+    guint64 total_us;           // Sum of round-trip times (microseconds)
+    guint64 max_us;             // Longest round-trip time (microseconds)
+    guint64 last_us;            // Most recent round-trip time (microseconds)
+    guint64 requests_async;     // Requests sent without waiting for reply
+    int outstanding;            // Asynchronous requests awaiting a reply
+    int max_outstanding;        // Most asynchronous requests awaiting a reply
+    unsigned int handshakes;    // Successful TLS handshakes
+    unsigned int resumed;       // TLS handshakes that resumed a session
+} lrmd__remote_stats_t;
+
+const lrmd__remote_stats_t *lrmd__remote_stats(const lrmd_t *lrmd);
+
 time_t lrmd__uptime(lrmd_t *lrmd);
 const char *lrmd__node_start_state(lrmd_t *lrmd);
 
@@ -33,6 +33,7 @@ pcmk_resource_t *pe__last_group_member(const pcmk_resource_t *group);
 
 const pcmk_resource_t *pe__const_top_resource(const pcmk_resource_t *rsc,
                                               bool include_bundle);
+GList *pe__rscs_with_id(const pcmk_scheduler_t *scheduler, const char *id);
 
 int pe__clone_max(const pcmk_resource_t *clone);
 int pe__clone_node_max(const pcmk_resource_t *clone);
@@ -87,6 +88,8 @@ char *pe__node_display_name(pcmk_node_t *node, bool print_detail);
 void pe__order_notifs_after_fencing(const pcmk_action_t *action,
                                     pcmk_resource_t *rsc,
                                     pcmk_action_t *stonith_op);
+void pe__foreach_notify_meta(const pcmk_action_t *action, GHFunc fn,
+                             gpointer user_data);
 
 
 // Resource output methods
@@ -124,6 +127,8 @@ void pe__count_bundle(pcmk_resource_t *rsc);
 void common_free(pcmk_resource_t *rsc);
 
 pcmk_node_t *pe__copy_node(const pcmk_node_t *this_node);
+pcmk_node_t *pe__copy_action_node(pcmk_action_t *action,
+                                  const pcmk_node_t *node);
 time_t get_effective_time(pcmk_scheduler_t *scheduler);
 
 /* Failure handling utilities (from failcounts.c) */
@@ -1,5 +1,5 @@
 /*
- * Copyright 2010-2022 the Pacemaker project contributors
+ * Copyright 2010-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -55,6 +55,9 @@ void services__format_result(svc_action_t *action, int agent_status,
                              enum pcmk_exec_status exec_status,
                              const char *format, ...) G_GNUC_PRINTF(4, 5);
 
+bool services__metadata_from_cache(svc_action_t *action);
+void services__metadata_to_cache(const svc_action_t *action);
+
 #  ifdef __cplusplus
 }
 #  endif
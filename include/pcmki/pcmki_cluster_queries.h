@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2023 the Pacemaker project contributors
+ * Copyright 2020-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -27,6 +27,12 @@ int pcmk__controller_status(pcmk__output_t *out, const char *node_name,
                             unsigned int message_timeout_ms);
 int pcmk__designated_controller(pcmk__output_t *out,
                                 unsigned int message_timeout_ms);
+int pcmk__controller_metrics(pcmk__output_t *out,
+                             unsigned int message_timeout_ms);
+int pcmk__controller_set_trace(pcmk__output_t *out, const char *files,
+                               const char *functions, const char *formats,
+                               const char *tags,
+                               unsigned int message_timeout_ms);
 int pcmk__pacemakerd_status(pcmk__output_t *out, const char *ipc_name,
                             unsigned int message_timeout_ms, bool show_output,
                             enum pcmk_pacemakerd_state *state);
@@ -1,5 +1,5 @@
 /*
- * Copyright 2021-2023 the Pacemaker project contributors
+ * Copyright 2021-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -35,6 +35,37 @@
 void pcmk__profile_dir(const char *dir, long long repeat,
                        pcmk_scheduler_t *scheduler, const char *use_date);
 
+/*!
+ * \internal
+ * \brief Replay every scheduler input in a directory and check the results
+ *
+ * Calculate the transition graph (and assignment scores, if expected scores
+ * exist) for each input, and compare them against the expected results as
+ * cts-scheduler does. Inputs are replayed in parallel by worker processes, and
+ * the result and timings of each are printed once all have been replayed.
+ *
+ * \param[in,out] out           Output object
+ * \param[in]     input_dir     Directory with scheduler inputs (\c *.xml or
+ *                              \c *.xml.bz2)
+ * \param[in]     expected_dir  Directory with expected results (\c *.exp and
+ *                              \c *.scores, either directly or in \c exp and
+ *                              \c scores subdirectories), or \c NULL to use
+ *                              \p input_dir
+ * \param[in]     update        If \c true, write new expected results instead
+ *                              of comparing against existing ones
+ * \param[in]     jobs          Maximum number of worker processes (or 0 to
+ *                              use one per online processor)
+ * \param[in]     flags         Group of enum pcmk_scheduler_flags to use
+ * \param[in]     use_date      The date to set the cluster's time to (if
+ *                              \c NULL, use each input's execution date)
+ *
+ * \return Standard Pacemaker return code (\c pcmk_rc_error if any input
+ *         failed)
+ */
+int pcmk__replay_dir(pcmk__output_t *out, const char *input_dir,
+                     const char *expected_dir, bool update, int jobs,
+                     unsigned long long flags, const char *use_date);
+
 /*!
  * \internal
  * \brief Simulate executing a transition
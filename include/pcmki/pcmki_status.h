@@ -1,5 +1,5 @@
 /*
- * Copyright 2022-2023 the Pacemaker project contributors
+ * Copyright 2022-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -41,6 +41,42 @@ extern "C" {
 int pcmk__output_simple_status(pcmk__output_t *out,
                                const pcmk_scheduler_t *scheduler);
 
+/*!
+ * \internal
+ * \brief Cluster status kept between refreshes by a long-running monitor
+ *
+ * The upgraded CIB is kept up to date by applying the caller's CIB patchsets to
+ * it, as long as they change only the CIB status section. Changes to node
+ * transient attributes are applied to the unpacked status in place. Other
+ * status changes, and the expiration of anything evaluated against the current
+ * time (such as failure timeouts and time-based rules), unpack the kept CIB
+ * again. Only configuration changes (or a patchset that can't be applied) make
+ * the CIB be copied and upgraded again. The fencing history is reused until the
+ * caller reports that it changed (typically upon a fencer notification).
+ */
+typedef struct {
+    xmlNode *cib;                   // Upgraded copy of CIB (NULL if none yet)
+    int admin_epoch;                // CIB version that cib reflects
+    int epoch;
+    int num_updates;
+    pcmk_scheduler_t *scheduler;    // Unpacked cib (NULL if none yet)
+    bool have_constraints;          // Whether scheduler has constraints
+    bool status_changed;            // Whether cib has changed since scheduler
+                                    // was unpacked in a way that needs it to
+                                    // be unpacked again
+    GHashTable *attrs_changed;      // IDs of nodes whose transient attributes
+                                    // changed in cib since scheduler was
+                                    // unpacked (NULL if none)
+
+    stonith_history_t *fence_history;       // Cached fencing history
+    enum pcmk__fence_history fence_level;   // How much history is cached
+    bool have_fence_history;                // Whether fence_history is usable
+} pcmk__status_cache_t;
+
+void pcmk__status_cache_patch(pcmk__status_cache_t *cache, xmlNode *patchset);
+void pcmk__status_cache_fencing_changed(pcmk__status_cache_t *cache);
+void pcmk__status_cache_clear(pcmk__status_cache_t *cache);
+
 int pcmk__output_cluster_status(pcmk__output_t *out, stonith_t *stonith,
                                 cib_t *cib, xmlNode *current_cib,
                                 enum pcmk_pacemakerd_state pcmkd_state,
@@ -48,7 +84,8 @@ int pcmk__output_cluster_status(pcmk__output_t *out, stonith_t *stonith,
                                 uint32_t show, uint32_t show_opts,
                                 const char *only_node, const char *only_rsc,
                                 const char *neg_location_prefix,
-                                bool simple_output);
+                                bool simple_output,
+                                pcmk__status_cache_t *cache);
 
 int pcmk__status(pcmk__output_t *out, cib_t *cib,
                  enum pcmk__fence_history fence_history, uint32_t show,
@@ -136,6 +136,9 @@ typedef struct {
 
     //! Time (from epoch) by which the controller should re-run the scheduler
     time_t recheck_by;
+
+    //! Clone notification data shared by actions (ID -> attributes XML)
+    GHashTable *notify_data;
 } pcmk__graph_t;
 
 
@@ -161,6 +164,8 @@ enum pcmk__graph_status pcmk__execute_graph(pcmk__graph_t *graph);
 void pcmk__update_graph(pcmk__graph_t *graph,
                         const pcmk__graph_action_t *action);
 void pcmk__free_graph(pcmk__graph_t *graph);
+xmlNode *pcmk__expand_notify_data(const pcmk__graph_t *graph,
+                                  const pcmk__graph_action_t *action);
 const char *pcmk__graph_status2text(enum pcmk__graph_status state);
 void pcmk__log_graph(unsigned int log_level, pcmk__graph_t *graph);
 void pcmk__log_graph_action(int log_level, pcmk__graph_action_t *action);
@@ -32,6 +32,7 @@
 #include <crm/common/ipc.h>
 #include <crm/common/ipc_internal.h>    // PCMK__SPECIAL_PID
 #include <crm/common/mainloop.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/xml.h>
 
 #include "crmcluster_private.h"
@@ -190,6 +191,14 @@ crm_cs_flush_cb(gpointer data)
 // Send no more than this many CPG messages in one flush
 #define CS_SEND_MAX 200
 
+static inline void
+set_queue_length_metric(guint queue_len)
+{
+    pcmk__metric_set(pcmk__metric_gauge("pacemaker_cpg_queue_length",
+                                        "CPG messages waiting to be sent"),
+                     queue_len);
+}
+
 /*!
  * \internal
  * \brief Send messages in Corosync CPG message queue
@@ -210,6 +219,7 @@ crm_cs_flush(gpointer data)
     }
 
     queue_len = g_list_length(cs_message_queue);
+    set_queue_length_metric(queue_len);
     if (((queue_len % 1000) == 0) && (queue_len > 1)) {
         crm_err("CPG queue has grown to %d", queue_len);
 
@@ -241,6 +251,10 @@ crm_cs_flush(gpointer data)
     }
 
     queue_len -= sent;
+    pcmk__metric_add(pcmk__metric_counter("pacemaker_cpg_messages_sent",
+                                          "CPG messages sent"),
+                     sent);
+    set_queue_length_metric(queue_len);
     do_crm_log((queue_len > 5)? LOG_INFO : LOG_TRACE,
                "Sent %u CPG message%s (%d still queued): %s (rc=%d)",
                sent, pcmk__plural_s(sent), queue_len, pcmk__cs_err_str(rc),
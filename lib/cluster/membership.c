@@ -39,6 +39,18 @@
  */
 GHashTable *crm_peer_cache = NULL;
 
+/*
+ * Secondary indexes of the cluster node cache, so that looking up a node by ID
+ * or name (which is done for every cluster message) does not have to iterate
+ * over the whole cache. Each maps a key to one cache entry with that key; if
+ * several entries share a key, the index points to any one of them, which is
+ * what an iteration would have found. They are maintained by
+ * pcmk__get_node() and update_peer_uname() (which set the keys), and by the
+ * cache's value destructor (so every way of removing an entry is covered).
+ */
+static GHashTable *cluster_node_by_id = NULL;   // Node ID -> crm_node_t *
+static GHashTable *cluster_node_by_name = NULL; // Name (ignoring case) -> node
+
 /*
  * The remote peer cache tracks pacemaker_remote nodes. While the
  * value has the same type as the peer cache's, it is tracked separately for
@@ -529,6 +541,119 @@ destroy_crm_node(gpointer data)
     free(node);
 }
 
+/*!
+ * \internal
+ * \brief Find a cluster node cache entry with the same ID or name as another
+ *
+ * \param[in] node   Node to match
+ * \param[in] by_id  If true, match by node ID, otherwise by name
+ *
+ * \return Cluster node cache entry other than \p node with the same ID (or
+ *         name, ignoring case) as \p node, or \c NULL if none
+ */
+static crm_node_t *
+find_duplicate_cluster_node(const crm_node_t *node, bool by_id)
+{
+    GHashTableIter iter;
+    crm_node_t *other = NULL;
+
+    g_hash_table_iter_init(&iter, crm_peer_cache);
+    while (g_hash_table_iter_next(&iter, NULL, (gpointer *) &other)) {
+        if (other == node) {
+            continue;
+        }
+        if (by_id? (other->id == node->id)
+                 : pcmk__str_eq(other->uname, node->uname, pcmk__str_casei)) {
+            return other;
+        }
+    }
+    return NULL;
+}
+
+/*!
+ * \internal
+ * \brief Add a cluster node cache entry to the ID or name index
+ *
+ * \param[in,out] node   Cache entry to index
+ * \param[in]     by_id  If true, index by node ID, otherwise by name
+ *
+ * \note If another entry is already indexed under the same key, the index is
+ *       left unchanged.
+ */
+static void
+index_cluster_node(crm_node_t *node, bool by_id)
+{
+    if (cluster_node_by_id == NULL) {
+        return;
+    }
+    if (by_id) {
+        if ((node->id > 0)
+            && !g_hash_table_contains(cluster_node_by_id,
+                                      GUINT_TO_POINTER(node->id))) {
+            g_hash_table_insert(cluster_node_by_id, GUINT_TO_POINTER(node->id),
+                                node);
+        }
+
+    } else if ((node->uname != NULL)
+               && !g_hash_table_contains(cluster_node_by_name, node->uname)) {
+        g_hash_table_insert(cluster_node_by_name, node->uname, node);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Remove a cluster node cache entry from the ID or name index
+ *
+ * \param[in] node   Cache entry to remove from index
+ * \param[in] by_id  If true, remove from ID index, otherwise from name index
+ *
+ * \note If another entry shares the key, it takes the removed entry's place.
+ */
+static void
+unindex_cluster_node(const crm_node_t *node, bool by_id)
+{
+    crm_node_t *other = NULL;
+
+    if (cluster_node_by_id == NULL) {
+        return;
+    }
+    if (by_id) {
+        if ((node->id == 0)
+            || (g_hash_table_lookup(cluster_node_by_id,
+                                    GUINT_TO_POINTER(node->id)) != node)) {
+            return;
+        }
+        g_hash_table_remove(cluster_node_by_id, GUINT_TO_POINTER(node->id));
+
+    } else {
+        if ((node->uname == NULL)
+            || (g_hash_table_lookup(cluster_node_by_name,
+                                    node->uname) != node)) {
+            return;
+        }
+        g_hash_table_remove(cluster_node_by_name, node->uname);
+    }
+
+    other = find_duplicate_cluster_node(node, by_id);
+    if (other != NULL) {
+        index_cluster_node(other, by_id);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Free a cluster node cache entry after removing it from the indexes
+ *
+ * \param[in,out] data  Cache entry to free
+ */
+static void
+destroy_cluster_node(gpointer data)
+{
+    unindex_cluster_node(data, true);
+    unindex_cluster_node(data, false);
+    destroy_crm_node(data);
+}
+
 /*!
  * \internal
  * \brief Initialize node caches
@@ -537,7 +662,9 @@ void
 pcmk__cluster_init_node_caches(void)
 {
     if (crm_peer_cache == NULL) {
-        crm_peer_cache = pcmk__strikey_table(free, destroy_crm_node);
+        crm_peer_cache = pcmk__strikey_table(free, destroy_cluster_node);
+        cluster_node_by_id = g_hash_table_new(NULL, NULL);
+        cluster_node_by_name = pcmk__strikey_table(NULL, NULL);
     }
 
     if (crm_remote_peer_cache == NULL) {
@@ -559,6 +686,13 @@ pcmk__cluster_destroy_node_caches(void)
     if (crm_peer_cache != NULL) {
         crm_trace("Destroying peer cache with %d members",
                   g_hash_table_size(crm_peer_cache));
+
+        // Destroy indexes first so entries aren't unindexed one by one
+        g_hash_table_destroy(cluster_node_by_id);
+        cluster_node_by_id = NULL;
+        g_hash_table_destroy(cluster_node_by_name);
+        cluster_node_by_name = NULL;
+
         g_hash_table_destroy(crm_peer_cache);
         crm_peer_cache = NULL;
     }
@@ -662,24 +796,16 @@ search_cluster_member_cache(unsigned int id, const char *uname,
     pcmk__cluster_init_node_caches();
 
     if (uname != NULL) {
-        g_hash_table_iter_init(&iter, crm_peer_cache);
-        while (g_hash_table_iter_next(&iter, NULL, (gpointer *) &node)) {
-            if(node->uname && strcasecmp(node->uname, uname) == 0) {
-                crm_trace("Name match: %s = %p", node->uname, node);
-                by_name = node;
-                break;
-            }
+        by_name = g_hash_table_lookup(cluster_node_by_name, uname);
+        if (by_name != NULL) {
+            crm_trace("Name match: %s = %p", by_name->uname, by_name);
         }
     }
 
     if (id > 0) {
-        g_hash_table_iter_init(&iter, crm_peer_cache);
-        while (g_hash_table_iter_next(&iter, NULL, (gpointer *) &node)) {
-            if(node->id == id) {
-                crm_trace("ID match: %u = %p", node->id, node);
-                by_id = node;
-                break;
-            }
+        by_id = g_hash_table_lookup(cluster_node_by_id, GUINT_TO_POINTER(id));
+        if (by_id != NULL) {
+            crm_trace("ID match: %u = %p", by_id->id, by_id);
         }
 
     } else if (uuid != NULL) {
@@ -943,6 +1069,7 @@ pcmk__get_node(unsigned int id, const char *uname, const char *uuid,
 
     if(id > 0 && node->id == 0) {
         node->id = id;
+        index_cluster_node(node, true);
     }
 
     if (uname && (node->uname == NULL)) {
@@ -1000,7 +1127,14 @@ update_peer_uname(crm_node_t *node, const char *uname)
         }
     }
 
-    pcmk__str_update(&node->uname, uname);
+    if (pcmk_is_set(node->flags, crm_remote_node)) {
+        pcmk__str_update(&node->uname, uname);
+
+    } else {
+        unindex_cluster_node(node, false);
+        pcmk__str_update(&node->uname, uname);
+        index_cluster_node(node, false);
+    }
 
     if (peer_status_callback != NULL) {
         peer_status_callback(crm_status_uname, node, NULL);
@@ -353,6 +353,7 @@ pcmk__unpack_acl(xmlNode *source, xmlNode *target, const char *user)
 void
 pcmk__enable_acl(xmlNode *acl_source, xmlNode *target, const char *user)
 {
+    pcmk__xml_new_private_data(target);
     pcmk__unpack_acl(acl_source, target, user);
     pcmk__set_xml_doc_flag(target, pcmk__xf_acl_enabled);
     pcmk__apply_acl(target);
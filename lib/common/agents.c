@@ -1,5 +1,5 @@
 /*
- * Copyright 2004-2021 the Pacemaker project contributors
+ * Copyright 2004-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -13,9 +13,14 @@
 #  define _GNU_SOURCE
 #endif
 
+#include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 
 #include <crm/crm.h>
 #include <crm/common/util.h>
@@ -212,3 +217,178 @@ crm_provider_required(const char *standard)
 
 // LCOV_EXCL_STOP
 // End deprecated API
+
+/*!
+ * \internal
+ * \brief Get the path of the on-disk meta-data cache file for an agent
+ *
+ * \param[in] standard  Agent standard
+ * \param[in] provider  Agent provider (if applicable)
+ * \param[in] type      Agent type
+ *
+ * \return Newly allocated file path, or NULL if agent can't be cached
+ */
+static char *
+metadata_cache_file(const char *standard, const char *provider,
+                    const char *type)
+{
+    char *key = crm_generate_ra_key(standard, provider, type);
+    char *file = NULL;
+
+    // Only simple names can be used, to stay inside the cache directory
+    if ((key != NULL) && (strchr(key, '/') == NULL) && (key[0] != '.')) {
+        file = crm_strdup_printf(PCMK__METADATA_CACHE_DIR "/%s", key);
+    }
+    free(key);
+    return file;
+}
+
+/*!
+ * \internal
+ * \brief Identify the current version of an agent executable
+ *
+ * A cache entry is valid only while its first line matches this, so replacing
+ * or editing the agent (for example, with a package update) invalidates it.
+ *
+ * \param[in] agent_path  Full path of agent executable
+ *
+ * \return Newly allocated header line, or NULL if agent can't be found
+ */
+static char *
+metadata_cache_header(const char *agent_path)
+{
+    struct stat sb;
+
+    if ((agent_path == NULL) || (stat(agent_path, &sb) != 0)) {
+        return NULL;
+    }
+    return crm_strdup_printf("%s %lld %lld %llu\n", agent_path,
+                             (long long) sb.st_mtime, (long long) sb.st_size,
+                             (unsigned long long) sb.st_ino);
+}
+
+/*!
+ * \internal
+ * \brief Get an agent's meta-data from the on-disk cache
+ *
+ * \param[in]  standard    Agent standard
+ * \param[in]  provider    Agent provider (if applicable)
+ * \param[in]  type        Agent type
+ * \param[in]  agent_path  Full path of agent executable
+ * \param[out] output      Where to store meta-data (which the caller is
+ *                         responsible for freeing) on success
+ *
+ * \return Standard Pacemaker return code (specifically, \c ENOENT if no
+ *         cache entry exists for the current version of the agent)
+ */
+int
+pcmk__cached_agent_metadata(const char *standard, const char *provider,
+                            const char *type, const char *agent_path,
+                            char **output)
+{
+    char *file = NULL;
+    char *header = NULL;
+    char *contents = NULL;
+    int rc = ENOENT;
+
+    CRM_CHECK(output != NULL, return EINVAL);
+    *output = NULL;
+
+    file = metadata_cache_file(standard, provider, type);
+    header = metadata_cache_header(agent_path);
+
+    if ((file != NULL) && (header != NULL)
+        && (pcmk__file_contents(file, &contents) == pcmk_rc_ok)
+        && pcmk__starts_with(contents, header)
+        && (contents[strlen(header)] != '\0')) {
+
+        *output = pcmk__str_copy(contents + strlen(header));
+        crm_trace("Read cached meta-data for %s from %s", agent_path, file);
+        rc = pcmk_rc_ok;
+    }
+    free(contents);
+    free(header);
+    free(file);
+    return rc;
+}
+
+/*!
+ * \internal
+ * \brief Save an agent's meta-data in the on-disk cache
+ *
+ * \param[in] standard    Agent standard
+ * \param[in] provider    Agent provider (if applicable)
+ * \param[in] type        Agent type
+ * \param[in] agent_path  Full path of agent executable
+ * \param[in] output      Meta-data obtained from the agent
+ *
+ * \note This does nothing if the caller can't write to the cache directory
+ *       (for example, an unprivileged command-line tool). Entries are replaced
+ *       atomically, so concurrent readers see either the old or new entry.
+ */
+void
+pcmk__cache_agent_metadata(const char *standard, const char *provider,
+                           const char *type, const char *agent_path,
+                           const char *output)
+{
+    char *file = NULL;
+    char *header = NULL;
+    char *tmp_file = NULL;
+    char *contents = NULL;
+    int fd = -1;
+    int rc = pcmk_rc_ok;
+
+    if (pcmk__str_empty(output)
+        || (access(PCMK__METADATA_CACHE_DIR, W_OK) != 0)) {
+        return;
+    }
+
+    file = metadata_cache_file(standard, provider, type);
+    header = metadata_cache_header(agent_path);
+    if ((file == NULL) || (header == NULL)) {
+        goto done;
+    }
+
+    tmp_file = crm_strdup_printf("%s.XXXXXX", file);
+    fd = mkstemp(tmp_file);
+    if (fd < 0) {
+        crm_debug("Could not cache meta-data for %s: %s",
+                  agent_path, strerror(errno));
+        goto done;
+    }
+
+    // Entries written by root must still be readable by the daemon user
+    if (geteuid() == 0) {
+        uid_t uid = 0;
+        gid_t gid = 0;
+
+        if ((pcmk_daemon_user(&uid, &gid) == pcmk_ok)
+            && (fchown(fd, uid, gid) < 0)) {
+            crm_debug("Could not set ownership of %s: %s",
+                      tmp_file, strerror(errno));
+        }
+    }
+    if (fchmod(fd, S_IRUSR|S_IWUSR|S_IRGRP) < 0) {
+        crm_debug("Could not set permissions of %s: %s",
+                  tmp_file, strerror(errno));
+    }
+
+    contents = crm_strdup_printf("%s%s", header, output);
+    rc = pcmk__write_sync(fd, contents);
+    if ((rc == pcmk_rc_ok) && (rename(tmp_file, file) < 0)) {
+        rc = errno;
+    }
+    if (rc == pcmk_rc_ok) {
+        crm_debug("Cached meta-data for %s in %s", agent_path, file);
+    } else {
+        crm_debug("Could not cache meta-data for %s: %s",
+                  agent_path, pcmk_rc_str(rc));
+        unlink(tmp_file);
+    }
+
+done:
+    free(contents);
+    free(tmp_file);
+    free(header);
+    free(file);
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU Lesser General Public License
+ * version 2.1 or later (LGPLv2.1+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <stddef.h>             // size_t
+#include <stdlib.h>             // free()
+#include <string.h>             // memset(), strlen(), memcpy()
+
+#include <crm/common/arena_internal.h>
+
+// Alignment of arena allocations (matches what glibc malloc() guarantees)
+#define ARENA_ALIGNMENT (2 * sizeof(size_t))
+
+#define arena_align(size) \
+    (((size) + ARENA_ALIGNMENT - 1) & ~((size_t) ARENA_ALIGNMENT - 1))
+
+typedef struct arena_chunk_s {
+    struct arena_chunk_s *next; // Previously filled chunk, if any
+    size_t size;                // Usable bytes in this chunk
+    size_t used;                // Bytes handed out from this chunk
+} arena_chunk_t;
+
+// Offset of usable memory from the start of a chunk
+#define ARENA_CHUNK_HEADER  arena_align(sizeof(arena_chunk_t))
+
+struct pcmk__arena_s {
+    arena_chunk_t *chunks;  // Chunk being filled, linked to older chunks
+    size_t chunk_size;      // Usable bytes in a standard chunk
+    size_t used;            // Bytes handed out since last reset
+    size_t peak;            // Highest value of used
+};
+
+/*!
+ * \internal
+ * \brief Allocate a new arena chunk
+ *
+ * \param[in] size  Usable bytes in new chunk
+ *
+ * \return Newly allocated chunk (guaranteed not to be \c NULL)
+ */
+static arena_chunk_t *
+new_chunk(size_t size)
+{
+    arena_chunk_t *chunk = pcmk__assert_alloc(1, ARENA_CHUNK_HEADER + size);
+
+    chunk->size = size;
+    return chunk;
+}
+
+/*!
+ * \internal
+ * \brief Create a new memory arena
+ *
+ * \param[in] chunk_size  Size of memory blocks to allocate from the system
+ *                        (or 0 to use \c PCMK__ARENA_CHUNK_SIZE)
+ *
+ * \return Newly allocated arena (guaranteed not to be \c NULL)
+ * \note The caller is responsible for freeing the result with
+ *       \c pcmk__arena_free().
+ */
+pcmk__arena_t *
+pcmk__arena_new(size_t chunk_size)
+{
+    pcmk__arena_t *arena = pcmk__assert_alloc(1, sizeof(pcmk__arena_t));
+
+    if (chunk_size == 0) {
+        chunk_size = PCMK__ARENA_CHUNK_SIZE;
+    }
+    arena->chunk_size = arena_align(chunk_size);
+    return arena;
+}
+
+/*!
+ * \internal
+ * \brief Free all chunks in a list of arena chunks
+ *
+ * \param[in,out] chunk  First chunk in list to free
+ */
+static void
+free_chunks(arena_chunk_t *chunk)
+{
+    while (chunk != NULL) {
+        arena_chunk_t *next = chunk->next;
+
+        free(chunk);
+        chunk = next;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Free a memory arena and everything allocated from it
+ *
+ * \param[in,out] arena  Arena to free
+ */
+void
+pcmk__arena_free(pcmk__arena_t *arena)
+{
+    if (arena != NULL) {
+        free_chunks(arena->chunks);
+        free(arena);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Release everything allocated from an arena at once
+ *
+ * The arena keeps one standard-sized chunk so that it can be refilled without
+ * going back to the system allocator.
+ *
+ * \param[in,out] arena  Arena to reset
+ */
+void
+pcmk__arena_reset(pcmk__arena_t *arena)
+{
+    arena_chunk_t *keep = NULL;
+    arena_chunk_t *chunk = NULL;
+
+    if (arena == NULL) {
+        return;
+    }
+
+    chunk = arena->chunks;
+    while (chunk != NULL) {
+        arena_chunk_t *next = chunk->next;
+
+        if ((keep == NULL) && (chunk->size == arena->chunk_size)) {
+            keep = chunk;
+        } else {
+            free(chunk);
+        }
+        chunk = next;
+    }
+
+    if (keep != NULL) {
+        keep->next = NULL;
+        keep->used = 0;
+    }
+    arena->chunks = keep;
+    arena->used = 0;
+}
+
+/*!
+ * \internal
+ * \brief Allocate zero-initialized memory from an arena, asserting on failure
+ *
+ * \param[in,out] arena  Arena to allocate from
+ * \param[in]     size   Number of bytes to allocate
+ *
+ * \return Newly allocated memory (guaranteed not to be \c NULL), suitably
+ *         aligned for any type
+ * \note The result is valid until \p arena is reset or freed, and must not be
+ *       freed individually.
+ */
+void *
+pcmk__arena_alloc(pcmk__arena_t *arena, size_t size)
+{
+    arena_chunk_t *chunk = NULL;
+    void *ptr = NULL;
+
+    CRM_ASSERT(arena != NULL);
+
+    size = arena_align((size == 0)? 1 : size);
+    chunk = arena->chunks;
+
+    if (size > (arena->chunk_size / 4)) {
+        /* Give large allocations a dedicated chunk, linked behind the current
+         * one so that the rest of the current chunk stays available.
+         */
+        arena_chunk_t *large = new_chunk(size);
+
+        if (chunk == NULL) {
+            arena->chunks = large;
+        } else {
+            large->next = chunk->next;
+            chunk->next = large;
+        }
+        large->used = size;
+        ptr = (char *) large + ARENA_CHUNK_HEADER;
+
+    } else {
+        if ((chunk == NULL) || ((chunk->size - chunk->used) < size)) {
+            chunk = new_chunk(arena->chunk_size);
+            chunk->next = arena->chunks;
+            arena->chunks = chunk;
+        }
+        ptr = (char *) chunk + ARENA_CHUNK_HEADER + chunk->used;
+        chunk->used += size;
+
+        // A reused chunk may contain earlier data
+        memset(ptr, 0, size);
+    }
+
+    arena->used += size;
+    if (arena->used > arena->peak) {
+        arena->peak = arena->used;
+    }
+    return ptr;
+}
+
+/*!
+ * \internal
+ * \brief Duplicate a string into an arena
+ *
+ * \param[in,out] arena  Arena to allocate from
+ * \param[in]     str    String to duplicate
+ *
+ * \return Copy of \p str in \p arena, or \c NULL if \p str is \c NULL
+ * \note The result is valid until \p arena is reset or freed, and must not be
+ *       freed individually.
+ */
+char *
+pcmk__arena_strdup(pcmk__arena_t *arena, const char *str)
+{
+    char *copy = NULL;
+    size_t len = 0;
+
+    if (str == NULL) {
+        return NULL;
+    }
+    len = strlen(str) + 1;
+    copy = pcmk__arena_alloc(arena, len);
+    memcpy(copy, str, len);
+    return copy;
+}
+
+/*!
+ * \internal
+ * \brief Get the number of bytes currently allocated from an arena
+ *
+ * \param[in] arena  Arena to check
+ *
+ * \return Number of bytes allocated since \p arena was created or last reset
+ */
+size_t
+pcmk__arena_used(const pcmk__arena_t *arena)
+{
+    return (arena == NULL)? 0 : arena->used;
+}
+
+/*!
+ * \internal
+ * \brief Get the highest number of bytes ever allocated from an arena
+ *
+ * \param[in] arena  Arena to check
+ *
+ * \return Highest number of bytes allocated between resets of \p arena
+ */
+size_t
+pcmk__arena_peak(const pcmk__arena_t *arena)
+{
+    return (arena == NULL)? 0 : arena->peak;
+}
@@ -78,6 +78,12 @@ bool pcmk__tracking_xml_changes(xmlNode *xml, bool lazy);
 G_GNUC_INTERNAL
 void pcmk__xml_mark_created(xmlNode *xml);
 
+G_GNUC_INTERNAL
+bool pcmk__xml_defer_private_data(bool defer);
+
+G_GNUC_INTERNAL
+void pcmk__xml_new_private_data(xmlNode *xml);
+
 G_GNUC_INTERNAL
 int pcmk__xml_position(const xmlNode *xml,
                        enum xml_private_flags ignore_if_set);
@@ -259,6 +265,17 @@ typedef struct pcmk__ipc_header_s {
     uint8_t version;
 } pcmk__ipc_header_t;
 
+/* IPC header flags used only between Pacemaker's own clients and servers (these
+ * must not overlap with enum crm_ipc_flags values)
+ */
+enum pcmk__ipc_header_flags {
+    //! Payload uses the compact encoding from pcmk__xml_pack() rather than text
+    pcmk__ipc_packed    = (UINT32_C(1) << 24),
+
+    //! Server accepts compactly encoded requests from this client
+    pcmk__ipc_packed_ok = (UINT32_C(1) << 25),
+};
+
 G_GNUC_INTERNAL
 int pcmk__send_ipc_request(pcmk_ipc_api_t *api, const xmlNode *request);
 
@@ -831,6 +831,7 @@ struct crm_ipc_s {
     char *buffer;
     char *server_name;          // server IPC name being connected to
     qb_ipcc_connection_t *ipc;
+    bool packed_ok;             // whether server accepts compact requests
 };
 
 /*!
@@ -999,6 +1000,9 @@ crm_ipc_close(crm_ipc_t * client)
             client->ipc = NULL;
             qb_ipcc_disconnect(ipc);
         }
+
+        // A new connection might be to a server without compact encoding
+        client->packed_ok = false;
     }
 }
 
@@ -1118,6 +1122,14 @@ crm_ipc_decompress(crm_ipc_t * client)
 {
     pcmk__ipc_header_t *header = (pcmk__ipc_header_t *)(void*)client->buffer;
 
+    // A server that accepts compactly encoded requests says so in responses
+    if (!client->packed_ok
+        && pcmk_is_set(header->flags, pcmk__ipc_packed_ok)) {
+        crm_debug("%s IPC server accepts compact message encoding",
+                  client->server_name);
+        client->packed_ok = true;
+    }
+
     if (header->size_compressed) {
         int rc = 0;
         unsigned int size_u = 1 + header->size_uncompressed;
@@ -1348,7 +1360,8 @@ crm_ipc_send(crm_ipc_t *client, const xmlNode *message,
 
     id++;
     CRM_LOG_ASSERT(id != 0); /* Crude wrap-around detection */
-    rc = pcmk__ipc_prepare_iov(id, message, client->max_buf_size, &iov, &bytes);
+    rc = pcmk__ipc_prepare_iov(id, message, client->max_buf_size,
+                               client->packed_ok, &iov, &bytes);
     if (rc != pcmk_rc_ok) {
         crm_warn("Couldn't prepare %s IPC request: %s " CRM_XS " rc=%d",
                  client->server_name, pcmk_rc_str(rc), rc);
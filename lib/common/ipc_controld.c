@@ -48,6 +48,10 @@ pcmk__controld_api_reply2str(enum pcmk_controld_api_reply reply)
             return "ping";
         case pcmk_controld_reply_nodes:
             return "nodes";
+        case pcmk_controld_reply_metrics:
+            return "metrics";
+        case pcmk_controld_reply_set_trace:
+            return "set-trace";
         default:
             return "unknown";
     }
@@ -181,6 +185,7 @@ reply_expected(pcmk_ipc_api_t *api, const xmlNode *request)
 {
     // We only need to handle commands that API functions can send
     return pcmk__str_any_of(crm_element_value(request, PCMK__XA_CRM_TASK),
+                            PCMK__CONTROLD_CMD_METRICS,
                             PCMK__CONTROLD_CMD_NODES,
                             CRM_OP_LRM_DELETE,
                             CRM_OP_LRM_FAIL,
@@ -188,6 +193,7 @@ reply_expected(pcmk_ipc_api_t *api, const xmlNode *request)
                             CRM_OP_PING,
                             CRM_OP_REPROBE,
                             CRM_OP_RM_NODE_CACHE,
+                            PCMK__OP_SET_TRACE,
                             NULL);
 }
 
@@ -268,6 +274,18 @@ dispatch(pcmk_ipc_api_t *api, xmlNode *reply)
     } else if (!strcmp(value, PCMK__CONTROLD_CMD_NODES)) {
         set_nodes_data(&reply_data, msg_data);
 
+    } else if (!strcmp(value, PCMK__CONTROLD_CMD_METRICS)) {
+        reply_data.reply_type = pcmk_controld_reply_metrics;
+        reply_data.data.metrics = msg_data;
+
+    } else if (!strcmp(value, PCMK__OP_SET_TRACE)) {
+        int exit_status = CRM_EX_OK;
+
+        reply_data.reply_type = pcmk_controld_reply_set_trace;
+        if (crm_element_value_int(reply, PCMK_XA_STATUS, &exit_status) == 0) {
+            status = (crm_exit_t) exit_status;
+        }
+
     } else {
         crm_info("Unrecognizable message from controller: unknown command '%s'",
                  value);
@@ -472,6 +490,70 @@ pcmk_controld_api_list_nodes(pcmk_ipc_api_t *api)
     return rc;
 }
 
+/*!
+ * \brief Ask the controller for its internal metrics
+ *
+ * \param[in,out] api  Controller connection
+ *
+ * \return Standard Pacemaker return code
+ * \note Event callback will get a reply of type pcmk_controld_reply_metrics.
+ */
+int
+pcmk_controld_api_metrics(pcmk_ipc_api_t *api)
+{
+    xmlNode *request;
+    int rc = EINVAL;
+
+    request = create_controller_request(api, PCMK__CONTROLD_CMD_METRICS, NULL,
+                                        NULL);
+    if (request != NULL) {
+        rc = send_controller_request(api, request, true);
+        free_xml(request);
+    }
+    return rc;
+}
+
+/*!
+ * \internal
+ * \brief Ask the controller to change which log callsites it traces
+ *
+ * Each argument has the same meaning as the corresponding \c PCMK_trace_*
+ * environment variable. A \c NULL argument clears that setting.
+ *
+ * \param[in,out] api        Controller connection
+ * \param[in]     files      Source files to trace
+ * \param[in]     functions  Functions to trace
+ * \param[in]     formats    Log message formats to trace
+ * \param[in]     tags       Log tags to trace
+ *
+ * \return Standard Pacemaker return code
+ * \note Event callback will get a reply of type
+ *       pcmk_controld_reply_set_trace, with the result as the event status.
+ */
+int
+pcmk__controld_api_set_trace(pcmk_ipc_api_t *api, const char *files,
+                             const char *functions, const char *formats,
+                             const char *tags)
+{
+    xmlNode *request = NULL;
+    xmlNode *options = pcmk__xe_create(NULL, PCMK__XE_TRACE_OPTIONS);
+    int rc = EINVAL;
+
+    crm_xml_add(options, PCMK__XA_TRACE_FILES, files);
+    crm_xml_add(options, PCMK__XA_TRACE_FUNCTIONS, functions);
+    crm_xml_add(options, PCMK__XA_TRACE_FORMATS, formats);
+    crm_xml_add(options, PCMK__XA_TRACE_TAGS, tags);
+
+    request = create_controller_request(api, PCMK__OP_SET_TRACE, NULL,
+                                        options);
+    if (request != NULL) {
+        rc = send_controller_request(api, request, true);
+        free_xml(request);
+    }
+    free_xml(options);
+    return rc;
+}
+
 // \return Standard Pacemaker return code
 static int
 controller_resource_op(pcmk_ipc_api_t *api, const char *op,
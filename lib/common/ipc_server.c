@@ -19,6 +19,7 @@
 #include <crm/common/xml.h>
 #include <crm/common/ipc.h>
 #include <crm/common/ipc_internal.h>
+#include <crm/common/metrics_internal.h>
 #include "crmcommon_private.h"
 
 /* Evict clients whose event queue grows this large (by default) */
@@ -260,7 +261,7 @@ pcmk_free_ipc_event(struct iovec *event)
 {
     if (event != NULL) {
         free(event[0].iov_base);
-        free(event[1].iov_base);
+        g_free(event[1].iov_base);
         free(event);
     }
 }
@@ -424,7 +425,17 @@ pcmk__client_data2xml(pcmk__client_t *c, void *data, uint32_t *id,
 
     CRM_ASSERT(text[header->size_uncompressed - 1] == 0);
 
-    xml = pcmk__xml_parse(text);
+    if (!pcmk_is_set(header->flags, pcmk__ipc_packed)) {
+        xml = pcmk__xml_parse(text);
+
+    } else if (pcmk_is_set(c->flags, pcmk__client_privileged)) {
+        xml = pcmk__xml_unpack(text, header->size_uncompressed - 1);
+
+    } else {
+        // We never offer the compact encoding to unprivileged clients
+        crm_warn("Ignoring compactly encoded IPC message from unprivileged "
+                 "client %s", pcmk__client_name(c));
+    }
     crm_log_xml_trace(xml, "[IPC received]");
 
     free(uncompressed);
@@ -487,6 +498,13 @@ crm_ipcs_flush_events(pcmk__client_t *c)
     if (c->event_queue) {
         queue_len = g_queue_get_length(c->event_queue);
     }
+    if (queue_len > 0) {
+        pcmk__metric_observe(pcmk__metric(pcmk__metric_sizes,
+                                          "pacemaker_ipc_event_queue_length",
+                                          "IPC events queued for a client "
+                                          "when flushing", NULL, NULL),
+                             queue_len);
+    }
     while (sent < 100) {
         pcmk__ipc_header_t *header = NULL;
         struct iovec *event = NULL;
@@ -540,6 +558,10 @@ crm_ipcs_flush_events(pcmk__client_t *c)
             } else {
                 crm_err("Evicting client with process ID %u due to backlog of %u messages "
                          CRM_XS " %p", c->pid, queue_len, c->ipcs);
+                pcmk__metric_add(pcmk__metric_counter("pacemaker_ipc_evictions",
+                                                      "IPC clients evicted due "
+                                                      "to event backlog"),
+                                 1);
                 c->queue_backlog = 0;
                 qb_ipcs_disconnect(c->ipcs);
                 return rc;
@@ -557,6 +579,128 @@ crm_ipcs_flush_events(pcmk__client_t *c)
     return rc;
 }
 
+// IPC message payload being serialized
+struct ipc_payload {
+    GString *text;          // Uncompressed text, while it might fit as is
+    bool compressing;       // Whether text has been switched to compressor
+    bz_stream bz;           // Compressor (if compressing)
+    char *compressed;       // Compressor output buffer (if compressing)
+    unsigned int max;       // Largest uncompressed payload that can be sent
+    unsigned int length;    // Uncompressed bytes serialized so far
+    bool too_big;           // Whether compressed output exceeded limit
+};
+
+/*!
+ * \internal
+ * \brief Feed data to an IPC payload's compressor
+ *
+ * \param[in,out] payload  IPC payload being compressed
+ * \param[in]     data     Data to compress
+ * \param[in]     length   Number of bytes in \p data
+ * \param[in]     action   \c BZ_RUN, or \c BZ_FINISH for the final data
+ *
+ * \return Standard Pacemaker return code
+ * \note If the compressed data won't fit in the output buffer, this sets
+ *       \p payload->too_big and returns success, so the caller can continue to
+ *       measure the full message size.
+ */
+static int
+compress_ipc_payload(struct ipc_payload *payload, const char *data,
+                     unsigned int length, int action)
+{
+    // bzip2 doesn't modify its input, despite the lack of const
+    payload->bz.next_in = (char *) data;
+    payload->bz.avail_in = length;
+
+    while (true) {
+        int rc = BZ2_bzCompress(&(payload->bz), action);
+
+        if (rc < 0) {
+            rc = pcmk__bzlib2rc(rc);
+            crm_err("Could not compress IPC message: %s", pcmk_rc_str(rc));
+            return rc;
+        }
+        if ((rc == BZ_STREAM_END)
+            || ((action == BZ_RUN) && (payload->bz.avail_in == 0))) {
+            return pcmk_rc_ok;
+        }
+        if (payload->bz.avail_out == 0) {
+            payload->too_big = true;
+            return pcmk_rc_ok;
+        }
+    }
+}
+
+/*!
+ * \internal
+ * \brief Switch an IPC payload from plain text to compression
+ *
+ * \param[in,out] payload  IPC payload whose text is too big to send as is
+ *
+ * \return Standard Pacemaker return code
+ */
+static int
+start_ipc_compression(struct ipc_payload *payload)
+{
+    int rc = BZ2_bzCompressInit(&(payload->bz), CRM_BZ2_BLOCKS, 0,
+                                CRM_BZ2_WORK);
+
+    rc = pcmk__bzlib2rc(rc);
+    if (rc != pcmk_rc_ok) {
+        crm_err("Could not prepare to compress IPC message: %s",
+                pcmk_rc_str(rc));
+        return rc;
+    }
+    payload->compressing = true;
+
+    // The compressed payload must fit in a message, too
+    payload->compressed = g_malloc(payload->max);
+    payload->bz.next_out = payload->compressed;
+    payload->bz.avail_out = payload->max;
+
+    rc = compress_ipc_payload(payload, payload->text->str,
+                              (unsigned int) payload->text->len, BZ_RUN);
+    g_string_free(payload->text, TRUE);
+    payload->text = NULL;
+    return rc;
+}
+
+/*!
+ * \internal
+ * \brief Add a chunk of serialized XML to an IPC payload
+ *
+ * Text is kept as is as long as it fits in an uncompressed message. Once it
+ * doesn't, it and all subsequent text go straight to a compressor, so neither
+ * the full uncompressed text nor a copy of it is ever held in memory.
+ *
+ * \param[in]     text       Text to add
+ * \param[in]     length     Number of bytes in \p text
+ * \param[in,out] user_data  IPC payload (<tt>struct ipc_payload *</tt>)
+ *
+ * \return Standard Pacemaker return code
+ */
+static int
+add_ipc_payload(const char *text, size_t length, void *user_data)
+{
+    struct ipc_payload *payload = user_data;
+
+    payload->length += (unsigned int) length;
+    if (payload->too_big) {
+        return pcmk_rc_ok; // Only measuring the message at this point
+    }
+
+    if (payload->compressing) {
+        return compress_ipc_payload(payload, text, (unsigned int) length,
+                                    BZ_RUN);
+    }
+
+    g_string_append_len(payload->text, text, length);
+    if ((payload->text->len + 1) < payload->max) {
+        return pcmk_rc_ok;
+    }
+    return start_ipc_compression(payload);
+}
+
 /*!
  * \internal
  * \brief Create an I/O vector for sending an IPC XML message
@@ -564,6 +708,9 @@ crm_ipcs_flush_events(pcmk__client_t *c)
  * \param[in]  request        Identifier for libqb response header
  * \param[in]  message        XML message to send
  * \param[in]  max_send_size  If 0, default IPC buffer size is used
+ * \param[in]  packed         If \c true, use the compact encoding from
+ *                            \c pcmk__xml_pack() rather than text (only if the
+ *                            recipient has said it accepts that)
  * \param[out] result         Where to store prepared I/O vector
  * \param[out] bytes          Size of prepared data in bytes
  *
@@ -571,12 +718,13 @@ crm_ipcs_flush_events(pcmk__client_t *c)
  */
 int
 pcmk__ipc_prepare_iov(uint32_t request, const xmlNode *message,
-                      uint32_t max_send_size, struct iovec **result,
-                      ssize_t *bytes)
+                      uint32_t max_send_size, bool packed,
+                      struct iovec **result, ssize_t *bytes)
 {
+    static unsigned int biggest = 0;
+
     struct iovec *iov;
-    unsigned int total = 0;
-    GString *buffer = NULL;
+    struct ipc_payload payload = { NULL, };
     pcmk__ipc_header_t *header = NULL;
     int rc = pcmk_rc_ok;
 
@@ -591,60 +739,76 @@ pcmk__ipc_prepare_iov(uint32_t request, const xmlNode *message,
        goto done;
     }
 
-    buffer = g_string_sized_new(1024);
-    pcmk__xml_string(message, 0, buffer, 0);
-
     if (max_send_size == 0) {
         max_send_size = crm_ipc_default_buffer_size();
     }
     CRM_LOG_ASSERT(max_send_size != 0);
 
+    payload.text = g_string_sized_new(1024);
+    payload.max = max_send_size - QB_MIN(max_send_size,
+                                         sizeof(pcmk__ipc_header_t));
+    if (packed) {
+        pcmk__xml_pack(message, payload.text);
+        payload.length = (unsigned int) payload.text->len;
+        if ((payload.text->len + 1) >= payload.max) {
+            rc = start_ipc_compression(&payload);
+        }
+    } else {
+        rc = pcmk__xml_stream(message, 0, add_ipc_payload, &payload);
+    }
+
+    // The payload includes the text's terminating nul
+    payload.length++;
+    if ((rc == pcmk_rc_ok) && payload.compressing && !payload.too_big) {
+        rc = compress_ipc_payload(&payload, "", 1, BZ_FINISH);
+    }
+    if (rc != pcmk_rc_ok) {
+        free(header);
+        goto done;
+    }
+
+    if (payload.too_big) {
+        crm_log_xml_trace(message, "EMSGSIZE");
+        biggest = QB_MAX(payload.length, biggest);
+
+        crm_err("Could not compress %u-byte message into less than IPC "
+                "limit of %u bytes; set PCMK_ipc_buffer to higher value "
+                "(%u bytes suggested)",
+                payload.length, max_send_size, 4 * biggest);
+
+        free(header);
+        rc = EMSGSIZE;
+        goto done;
+    }
+
     *result = NULL;
     iov = pcmk__new_ipc_event();
     iov[0].iov_len = sizeof(pcmk__ipc_header_t);
     iov[0].iov_base = header;
 
     header->version = PCMK__IPC_VERSION;
-    header->size_uncompressed = 1 + buffer->len;
-    total = iov[0].iov_len + header->size_uncompressed;
+    header->size_uncompressed = payload.length;
+    if (packed) {
+        pcmk__set_ipc_flags(header->flags, "send data", pcmk__ipc_packed);
+    }
 
-    if (total < max_send_size) {
-        iov[1].iov_base = pcmk__str_copy(buffer->str);
+    if (!payload.compressing) {
+        // Hand over the serialized text rather than copying it
         iov[1].iov_len = header->size_uncompressed;
+        iov[1].iov_base = g_string_free(payload.text, FALSE);
+        payload.text = NULL;
 
     } else {
-        static unsigned int biggest = 0;
-
-        char *compressed = NULL;
-        unsigned int new_size = 0;
-
-        if (pcmk__compress(buffer->str,
-                           (unsigned int) header->size_uncompressed,
-                           (unsigned int) max_send_size, &compressed,
-                           &new_size) == pcmk_rc_ok) {
-
-            pcmk__set_ipc_flags(header->flags, "send data", crm_ipc_compressed);
-            header->size_compressed = new_size;
-
-            iov[1].iov_len = header->size_compressed;
-            iov[1].iov_base = compressed;
+        pcmk__set_ipc_flags(header->flags, "send data", crm_ipc_compressed);
+        header->size_compressed = payload.bz.total_out_lo32;
 
-            biggest = QB_MAX(header->size_compressed, biggest);
+        iov[1].iov_len = header->size_compressed;
+        iov[1].iov_base = payload.compressed;
+        payload.compressed = NULL;
 
-        } else {
-            crm_log_xml_trace(message, "EMSGSIZE");
-            biggest = QB_MAX(header->size_uncompressed, biggest);
-
-            crm_err("Could not compress %u-byte message into less than IPC "
-                    "limit of %u bytes; set PCMK_ipc_buffer to higher value "
-                    "(%u bytes suggested)",
-                    header->size_uncompressed, max_send_size, 4 * biggest);
-
-            free(compressed);
-            pcmk_free_ipc_event(iov);
-            rc = EMSGSIZE;
-            goto done;
-        }
+        crm_trace("Compressed %u-byte IPC message into %u bytes",
+                  header->size_uncompressed, header->size_compressed);
+        biggest = QB_MAX(header->size_compressed, biggest);
     }
 
     header->qb.size = iov[0].iov_len + iov[1].iov_len;
@@ -657,9 +821,13 @@ pcmk__ipc_prepare_iov(uint32_t request, const xmlNode *message,
     }
 
 done:
-    if (buffer != NULL) {
-        g_string_free(buffer, TRUE);
+    if (payload.text != NULL) {
+        g_string_free(payload.text, TRUE);
     }
+    if (payload.compressing) {
+        BZ2_bzCompressEnd(&(payload.bz));
+    }
+    g_free(payload.compressed);
     return rc;
 }
 
@@ -699,7 +867,7 @@ pcmk__ipc_send_iov(pcmk__client_t *c, struct iovec *iov, uint32_t flags)
             memcpy(iov_copy[0].iov_base, iov[0].iov_base, iov[0].iov_len);
 
             iov_copy[1].iov_len = iov[1].iov_len;
-            iov_copy[1].iov_base = malloc(iov[1].iov_len);
+            iov_copy[1].iov_base = g_malloc(iov[1].iov_len);
             memcpy(iov_copy[1].iov_base, iov[1].iov_base, iov[1].iov_len);
 
             add_event(c, iov_copy);
@@ -710,6 +878,17 @@ pcmk__ipc_send_iov(pcmk__client_t *c, struct iovec *iov, uint32_t flags)
 
         CRM_LOG_ASSERT(header->qb.id != 0);     /* Replying to a specific request */
 
+        /* Let trusted clients know they may send compactly encoded requests.
+         * This is done only in responses, which (unlike events) are never
+         * shared among clients.
+         */
+        if (pcmk_is_set(c->flags, pcmk__client_privileged)) {
+            pcmk__set_ipc_flags(header->flags, "response", pcmk__ipc_packed_ok);
+        } else {
+            pcmk__clear_ipc_flags(header->flags, "response",
+                                  pcmk__ipc_packed_ok);
+        }
+
         qb_rc = qb_ipcs_response_sendv(c->ipcs, iov, 2);
         if (qb_rc < header->qb.size) {
             if (qb_rc < 0) {
@@ -753,7 +932,7 @@ pcmk__ipc_send_xml(pcmk__client_t *c, uint32_t request, const xmlNode *message,
         return EINVAL;
     }
     rc = pcmk__ipc_prepare_iov(request, message, crm_ipc_default_buffer_size(),
-                               &iov, NULL);
+                               false, &iov, NULL);
     if (rc == pcmk_rc_ok) {
         pcmk__set_ipc_flags(flags, "send data", crm_ipc_server_free);
         rc = pcmk__ipc_send_iov(c, iov, flags);
@@ -704,6 +704,28 @@ crm_time_as_string(const crm_time_t *dt, int flags)
     return pcmk__str_copy(result);
 }
 
+/*!
+ * \internal
+ * \brief Scan exactly two decimal digits
+ *
+ * \param[in]  str     String to scan
+ * \param[out] result  Where to store value of digits
+ *
+ * \return true if \p str starts with two digits, otherwise false
+ * \note This is used for fast paths handling the fixed-width fields that
+ *       Pacemaker itself writes, with \c sscanf() as the fallback for the
+ *       other forms that ISO 8601 allows.
+ */
+static inline bool
+scan_two_digits(const char *str, uint32_t *result)
+{
+    if (!isdigit((int) str[0]) || !isdigit((int) str[1])) {
+        return false;
+    }
+    *result = ((str[0] - '0') * 10) + (str[1] - '0');
+    return true;
+}
+
 /*!
  * \internal
  * \brief Determine number of seconds from an hour:minute:second string
@@ -725,12 +747,22 @@ crm_time_parse_sec(const char *time_str, int *result)
 
     *result = 0;
 
-    // Must have at least hour, but minutes and seconds are optional
-    rc = sscanf(time_str, "%" SCNu32 ":%" SCNu32 ":%" SCNu32,
-                &hour, &minute, &second);
-    if (rc == 1) {
-        rc = sscanf(time_str, "%2" SCNu32 "%2" SCNu32 "%2" SCNu32,
+    if (scan_two_digits(time_str, &hour) && (time_str[2] == ':')
+        && scan_two_digits(time_str + 3, &minute) && (time_str[5] == ':')
+        && scan_two_digits(time_str + 6, &second)
+        && !isdigit((int) time_str[8])) {
+        rc = 3; // Fast path for hh:mm:ss
+
+    } else {
+        hour = minute = second = 0;
+
+        // Must have at least hour, but minutes and seconds are optional
+        rc = sscanf(time_str, "%" SCNu32 ":%" SCNu32 ":%" SCNu32,
                     &hour, &minute, &second);
+        if (rc == 1) {
+            rc = sscanf(time_str, "%2" SCNu32 "%2" SCNu32 "%2" SCNu32,
+                        &hour, &minute, &second);
+        }
     }
     if (rc == 0) {
         crm_err("%s is not a valid ISO 8601 time specification", time_str);
@@ -769,10 +801,9 @@ crm_time_parse_sec(const char *time_str, int *result)
 static bool
 crm_time_parse_offset(const char *offset_str, int *offset)
 {
-    tzset();
-
     if (offset_str == NULL) {
         // Use local offset
+        tzset();
 #if defined(HAVE_STRUCT_TM_TM_GMTOFF)
         time_t now = time(NULL);
         struct tm *now_tm = localtime(&now);
@@ -830,8 +861,6 @@ crm_time_parse(const char *time_str, crm_time_t *a_time)
     uint32_t h, m, s;
     char *offset_s = NULL;
 
-    tzset();
-
     if (time_str) {
         if (crm_time_parse_sec(time_str, &(a_time->seconds)) == FALSE) {
             return FALSE;
@@ -862,6 +891,38 @@ crm_time_parse(const char *time_str, crm_time_t *a_time)
     return TRUE;
 }
 
+/*!
+ * \internal
+ * \brief Scan a date in the form YYYY-MM-DD (without validating it)
+ *
+ * \param[in]  str    String to scan
+ * \param[out] year   Where to store year
+ * \param[out] month  Where to store month
+ * \param[out] day    Where to store day of month
+ *
+ * \return true if \p str starts with a date in exactly that form, otherwise
+ *         false
+ */
+static bool
+scan_extended_date(const char *str, int *year, int *month, int *day)
+{
+    uint32_t century = 0;
+    uint32_t year_of_century = 0;
+    uint32_t m = 0;
+    uint32_t d = 0;
+
+    if (!scan_two_digits(str, &century)
+        || !scan_two_digits(str + 2, &year_of_century) || (str[4] != '-')
+        || !scan_two_digits(str + 5, &m) || (str[7] != '-')
+        || !scan_two_digits(str + 8, &d) || isdigit((int) str[10])) {
+        return false;
+    }
+    *year = (int) ((century * 100) + year_of_century);
+    *month = (int) m;
+    *day = (int) d;
+    return true;
+}
+
 /*
  * \internal
  * \brief Parse a time object from an ISO 8601 date/time specification
@@ -913,10 +974,14 @@ parse_date(const char *date_str)
     }
 
     /* YYYY-MM-DD */
-    rc = sscanf(date_str, "%d-%d-%d", &year, &month, &day);
-    if (rc == 1) {
-        /* YYYYMMDD */
-        rc = sscanf(date_str, "%4d%2d%2d", &year, &month, &day);
+    if (scan_extended_date(date_str, &year, &month, &day)) {
+        rc = 3;
+    } else {
+        rc = sscanf(date_str, "%d-%d-%d", &year, &month, &day);
+        if (rc == 1) {
+            /* YYYYMMDD */
+            rc = sscanf(date_str, "%4d%2d%2d", &year, &month, &day);
+        }
     }
     if (rc == 3) {
         if (month > 12) {
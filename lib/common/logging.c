@@ -58,6 +58,21 @@ void *pcmk__config_warning_context = NULL;
 
 static gboolean crm_tracing_enabled(void);
 
+/* Which callsites to enable beyond the log level. These are parsed into sets
+ * once (from the environment at first use, or by pcmk__set_trace_options()),
+ * so that filtering a callsite does not depend on the length of the lists.
+ */
+static struct {
+    bool loaded;            // Whether environment has been checked
+    GHashTable *files;      // Source file names (or NULL for none)
+    char *files_s;          // files as configured (for logging)
+    GHashTable *functions;  // Function names (or NULL for none)
+    char *functions_s;      // functions as configured (for logging)
+    char *formats;          // Message formats (or NULL for none)
+    char *tags;             // Message tags (or NULL for none)
+    char *blackbox;         // function:line callsites that dump blackbox
+} trace_settings = { false, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+
 static void
 crm_glib_handler(const gchar * log_domain, GLogLevelFlags flags, const gchar * message,
                  gpointer user_data)
@@ -569,10 +584,33 @@ crm_quark_to_string(uint32_t tag)
     return "";
 }
 
+/*!
+ * \internal
+ * \brief Check whether a callsite's source file should be traced
+ *
+ * \param[in] cs  Callsite to check
+ *
+ * \return true if the callsite's file name (with or without directories) was
+ *         configured for tracing, otherwise false
+ */
+static bool
+trace_file(const struct qb_log_callsite *cs)
+{
+    const char *basename = NULL;
+
+    if ((trace_settings.files == NULL) || (cs->filename == NULL)) {
+        return false;
+    }
+    if (g_hash_table_contains(trace_settings.files, cs->filename)) {
+        return true;
+    }
+    basename = strrchr(cs->filename, '/');
+    return (basename != NULL)
+           && g_hash_table_contains(trace_settings.files, basename + 1);
+}
+
 static void
-crm_log_filter_source(int source, const char *trace_files, const char *trace_fns,
-                      const char *trace_fmts, const char *trace_tags, const char *trace_blackbox,
-                      struct qb_log_callsite *cs)
+crm_log_filter_source(int source, struct qb_log_callsite *cs)
 {
     if (qb_log_ctl(source, QB_LOG_CONF_STATE_GET, 0) != QB_LOG_STATE_ENABLED) {
         return;
@@ -585,10 +623,10 @@ crm_log_filter_source(int source, const char *trace_files, const char *trace_fns
         if (cs->priority <= LOG_ERR) {
             qb_bit_set(cs->targets, source);
 
-        } else if (trace_blackbox) {
+        } else if (trace_settings.blackbox != NULL) {
             char *key = crm_strdup_printf("%s:%d", cs->function, cs->lineno);
 
-            if (strstr(trace_blackbox, key) != NULL) {
+            if (strstr(trace_settings.blackbox, key) != NULL) {
                 qb_bit_set(cs->targets, source);
             }
             free(key);
@@ -601,13 +639,16 @@ crm_log_filter_source(int source, const char *trace_files, const char *trace_fns
         /* Log file tracing options... */
     } else if (cs->priority <= crm_log_level) {
         qb_bit_set(cs->targets, source);
-    } else if (trace_files && strstr(trace_files, cs->filename) != NULL) {
+    } else if (trace_file(cs)) {
         qb_bit_set(cs->targets, source);
-    } else if (trace_fns && strstr(trace_fns, cs->function) != NULL) {
+    } else if ((trace_settings.functions != NULL) && (cs->function != NULL)
+               && g_hash_table_contains(trace_settings.functions,
+                                        cs->function)) {
         qb_bit_set(cs->targets, source);
-    } else if (trace_fmts && strstr(trace_fmts, cs->format) != NULL) {
+    } else if ((trace_settings.formats != NULL) && (cs->format != NULL)
+               && (strstr(trace_settings.formats, cs->format) != NULL)) {
         qb_bit_set(cs->targets, source);
-    } else if (trace_tags
+    } else if ((trace_settings.tags != NULL)
                && cs->tags != 0
                && cs->tags != crm_trace_nonlog && g_quark_to_string(cs->tags) != NULL) {
         qb_bit_set(cs->targets, source);
@@ -628,51 +669,122 @@ strchrnul(const char *s, int c)
 }
 #endif
 
+/*!
+ * \internal
+ * \brief Parse a list of names to trace into a set
+ *
+ * \param[in] list  Names separated by commas and/or spaces (may be NULL)
+ *
+ * \return Newly allocated set of names (or NULL if \p list has none)
+ */
+static GHashTable *
+trace_name_table(const char *list)
+{
+    GHashTable *table = NULL;
+    gchar **names = NULL;
+
+    if (pcmk__str_empty(list)) {
+        return NULL;
+    }
+
+    names = g_strsplit_set(list, ", ", 0);
+    for (gchar **name = names; *name != NULL; name++) {
+        if (**name != '\0') {
+            if (table == NULL) {
+                table = pcmk__strkey_table(free, NULL);
+            }
+            g_hash_table_add(table, pcmk__str_copy(*name));
+        }
+    }
+    g_strfreev(names);
+    return table;
+}
+
+/*!
+ * \internal
+ * \brief Create message tags for a list of tags to trace
+ *
+ * Messages are logged with a tag only if the tag already exists, so create any
+ * that are configured for tracing.
+ *
+ * \param[in] list  Tags separated by commas and/or spaces (may be NULL)
+ */
 static void
-crm_log_filter(struct qb_log_callsite *cs)
+create_trace_tags(const char *list)
 {
-    int lpc = 0;
-    static int need_init = 1;
-    static const char *trace_fns = NULL;
-    static const char *trace_tags = NULL;
-    static const char *trace_fmts = NULL;
-    static const char *trace_files = NULL;
-    static const char *trace_blackbox = NULL;
-
-    if (need_init) {
-        need_init = 0;
-        trace_fns = pcmk__env_option(PCMK__ENV_TRACE_FUNCTIONS);
-        trace_fmts = pcmk__env_option(PCMK__ENV_TRACE_FORMATS);
-        trace_tags = pcmk__env_option(PCMK__ENV_TRACE_TAGS);
-        trace_files = pcmk__env_option(PCMK__ENV_TRACE_FILES);
-        trace_blackbox = pcmk__env_option(PCMK__ENV_TRACE_BLACKBOX);
-
-        if (trace_tags != NULL) {
-            uint32_t tag;
-            char token[500];
-            const char *offset = NULL;
-            const char *next = trace_tags;
-
-            do {
-                offset = next;
-                next = strchrnul(offset, ',');
-                snprintf(token, sizeof(token), "%.*s", (int)(next - offset), offset);
-
-                tag = g_quark_from_string(token);
-                crm_info("Created GQuark %u from token '%s' in '%s'", tag, token, trace_tags);
-
-                if (next[0] != 0) {
-                    next++;
-                }
-
-            } while (next != NULL && next[0] != 0);
+    gchar **tags = NULL;
+
+    if (pcmk__str_empty(list)) {
+        return;
+    }
+    tags = g_strsplit_set(list, ", ", 0);
+    for (gchar **tag = tags; *tag != NULL; tag++) {
+        if (**tag != '\0') {
+            uint32_t quark = g_quark_from_string(*tag);
+
+            crm_info("Created GQuark %u from token '%s' in '%s'",
+                     quark, *tag, list);
         }
     }
+    g_strfreev(tags);
+}
+
+static void
+free_trace_settings(void)
+{
+    g_clear_pointer(&trace_settings.files, g_hash_table_destroy);
+    g_clear_pointer(&trace_settings.files_s, free);
+    g_clear_pointer(&trace_settings.functions, g_hash_table_destroy);
+    g_clear_pointer(&trace_settings.functions_s, free);
+    g_clear_pointer(&trace_settings.formats, free);
+    g_clear_pointer(&trace_settings.tags, free);
+}
+
+static void
+set_trace_settings(const char *files, const char *functions,
+                   const char *formats, const char *tags)
+{
+    free_trace_settings();
+    trace_settings.files = trace_name_table(files);
+    if (trace_settings.files != NULL) {
+        trace_settings.files_s = pcmk__str_copy(files);
+    }
+    trace_settings.functions = trace_name_table(functions);
+    if (trace_settings.functions != NULL) {
+        trace_settings.functions_s = pcmk__str_copy(functions);
+    }
+    if (!pcmk__str_empty(formats)) {
+        trace_settings.formats = pcmk__str_copy(formats);
+    }
+    if (!pcmk__str_empty(tags)) {
+        trace_settings.tags = pcmk__str_copy(tags);
+        create_trace_tags(tags);
+    }
+}
+
+static void
+load_trace_settings(void)
+{
+    if (trace_settings.loaded) {
+        return;
+    }
+    trace_settings.loaded = true;
+    set_trace_settings(pcmk__env_option(PCMK__ENV_TRACE_FILES),
+                       pcmk__env_option(PCMK__ENV_TRACE_FUNCTIONS),
+                       pcmk__env_option(PCMK__ENV_TRACE_FORMATS),
+                       pcmk__env_option(PCMK__ENV_TRACE_TAGS));
+    trace_settings.blackbox =
+        pcmk__str_copy(pcmk__env_option(PCMK__ENV_TRACE_BLACKBOX));
+}
+
+static void
+crm_log_filter(struct qb_log_callsite *cs)
+{
+    load_trace_settings();
 
     cs->targets = 0;            /* Reset then find targets to enable */
-    for (lpc = QB_LOG_SYSLOG; lpc < QB_LOG_TARGET_MAX; lpc++) {
-        crm_log_filter_source(lpc, trace_files, trace_fns, trace_fmts, trace_tags, trace_blackbox,
-                              cs);
+    for (int lpc = QB_LOG_SYSLOG; lpc < QB_LOG_TARGET_MAX; lpc++) {
+        crm_log_filter_source(lpc, cs);
     }
 }
 
@@ -708,28 +820,53 @@ crm_is_callsite_active(struct qb_log_callsite *cs, uint8_t level, uint32_t tags)
 void
 crm_update_callsites(void)
 {
-    static gboolean log = TRUE;
-
-    if (log) {
-        log = FALSE;
-        crm_debug
-            ("Enabling callsites based on priority=%d, files=%s, functions=%s, formats=%s, tags=%s",
-             crm_log_level, pcmk__env_option(PCMK__ENV_TRACE_FILES),
-             pcmk__env_option(PCMK__ENV_TRACE_FUNCTIONS),
-             pcmk__env_option(PCMK__ENV_TRACE_FORMATS),
-             pcmk__env_option(PCMK__ENV_TRACE_TAGS));
-    }
+    load_trace_settings();
+    crm_debug("Enabling callsites based on priority=%d, files=%s, "
+              "functions=%s, formats=%s, tags=%s",
+              crm_log_level, pcmk__s(trace_settings.files_s, "(none)"),
+              pcmk__s(trace_settings.functions_s, "(none)"),
+              pcmk__s(trace_settings.formats, "(none)"),
+              pcmk__s(trace_settings.tags, "(none)"));
     qb_log_filter_fn_set(crm_log_filter);
 }
 
+/*!
+ * \internal
+ * \brief Change which callsites are traced, without restarting
+ *
+ * This replaces any tracing configured via the environment (\c PCMK_trace_*)
+ * or a previous call, and refilters all callsites once, so that the cost of a
+ * disabled log call does not depend on these settings.
+ *
+ * \param[in] files      Source file names to trace, separated by commas or
+ *                       spaces (NULL or empty to trace no files)
+ * \param[in] functions  Function names to trace, separated by commas or
+ *                       spaces (NULL or empty to trace no functions)
+ * \param[in] formats    Message formats to trace (NULL or empty for none)
+ * \param[in] tags       Message tags to trace, separated by commas or spaces
+ *                       (NULL or empty for none)
+ */
+void
+pcmk__set_trace_options(const char *files, const char *functions,
+                        const char *formats, const char *tags)
+{
+    load_trace_settings();
+    set_trace_settings(files, functions, formats, tags);
+    crm_notice("Tracing files=%s functions=%s formats=%s tags=%s",
+               pcmk__s(files, "(none)"), pcmk__s(functions, "(none)"),
+               pcmk__s(formats, "(none)"), pcmk__s(tags, "(none)"));
+    crm_update_callsites();
+}
+
 static gboolean
 crm_tracing_enabled(void)
 {
+    load_trace_settings();
     return (crm_log_level == LOG_TRACE)
-            || (pcmk__env_option(PCMK__ENV_TRACE_FILES) != NULL)
-            || (pcmk__env_option(PCMK__ENV_TRACE_FUNCTIONS) != NULL)
-            || (pcmk__env_option(PCMK__ENV_TRACE_FORMATS) != NULL)
-            || (pcmk__env_option(PCMK__ENV_TRACE_TAGS) != NULL);
+            || (trace_settings.files != NULL)
+            || (trace_settings.functions != NULL)
+            || (trace_settings.formats != NULL)
+            || (trace_settings.tags != NULL);
 }
 
 static int
@@ -1255,6 +1392,10 @@ pcmk__free_common_logger(void)
         pcmk__output_free(logger_out);
         logger_out = NULL;
     }
+
+    free_trace_settings();
+    g_clear_pointer(&trace_settings.blackbox, free);
+    trace_settings.loaded = false;
 }
 
 // Deprecated functions kept only for backward API compatibility
@@ -17,6 +17,7 @@
 
 #include <crm/common/xml.h>
 #include <crm/common/xml_internal.h>
+#include <crm/common/messages_internal.h>
 
 /*!
  * \brief Create a Pacemaker request (for IPC or cluster layer)
@@ -281,6 +282,77 @@ pcmk__reset_request(pcmk__request_t *request)
     pcmk__reset_result(&(request->result));
 }
 
+/*!
+ * \internal
+ * \brief Handle an IPC request to change which log callsites are traced
+ *
+ * The request's data (or the request itself) should contain a
+ * \c PCMK__XE_TRACE_OPTIONS element whose attributes have the same meaning as
+ * the corresponding \c PCMK_trace_* environment variables. An absent attribute
+ * clears that setting.
+ *
+ * \param[in,out] request  Request to handle
+ *
+ * \return NULL (an acknowledgement is sent to the client directly)
+ * \note Only privileged (root or \c CRM_DAEMON_USER) IPC clients may change
+ *       tracing, since the logs it produces may contain sensitive data.
+ */
+xmlNode *
+pcmk__handle_set_trace_request(pcmk__request_t *request)
+{
+    xmlNode *options = NULL;
+
+    if ((request->ipc_client == NULL)
+        || !pcmk_is_set(request->ipc_client->flags, pcmk__client_privileged)) {
+
+        if (request->ipc_client != NULL) {
+            pcmk__ipc_send_ack(request->ipc_client, request->ipc_id,
+                               request->ipc_flags, PCMK__XE_ACK, NULL,
+                               CRM_EX_INSUFFICIENT_PRIV);
+        }
+        pcmk__format_result(&request->result, CRM_EX_INSUFFICIENT_PRIV,
+                            PCMK_EXEC_ERROR,
+                            "Ignoring %s request from unprivileged %s %s",
+                            request->op, pcmk__request_origin_type(request),
+                            pcmk__request_origin(request));
+        return NULL;
+    }
+
+    options = pcmk__xe_first_child(request->xml, PCMK__XE_TRACE_OPTIONS, NULL,
+                                   NULL);
+    if (options == NULL) {
+        xmlNode *data = pcmk__xe_first_child(request->xml, PCMK__XE_CRM_XML,
+                                             NULL, NULL);
+
+        options = pcmk__xe_first_child(data, PCMK__XE_TRACE_OPTIONS, NULL,
+                                       NULL);
+    }
+
+    if (options == NULL) {
+        pcmk__ipc_send_ack(request->ipc_client, request->ipc_id,
+                           request->ipc_flags, PCMK__XE_ACK, NULL,
+                           CRM_EX_INVALID_PARAM);
+        pcmk__format_result(&request->result, CRM_EX_INVALID_PARAM,
+                            PCMK_EXEC_INVALID,
+                            "%s request from %s %s has no "
+                            PCMK__XE_TRACE_OPTIONS,
+                            request->op, pcmk__request_origin_type(request),
+                            pcmk__request_origin(request));
+        return NULL;
+    }
+
+    pcmk__set_trace_options(crm_element_value(options, PCMK__XA_TRACE_FILES),
+                            crm_element_value(options,
+                                              PCMK__XA_TRACE_FUNCTIONS),
+                            crm_element_value(options, PCMK__XA_TRACE_FORMATS),
+                            crm_element_value(options, PCMK__XA_TRACE_TAGS));
+
+    pcmk__ipc_send_ack(request->ipc_client, request->ipc_id, request->ipc_flags,
+                       PCMK__XE_ACK, NULL, CRM_EX_OK);
+    pcmk__set_result(&request->result, CRM_EX_OK, PCMK_EXEC_DONE, NULL);
+    return NULL;
+}
+
 // Deprecated functions kept only for backward API compatibility
 // LCOV_EXCL_START
 
@@ -0,0 +1,539 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU Lesser General Public License
+ * version 2.1 or later (LGPLv2.1+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdint.h>                 // uint64_t
+#include <string.h>                 // strcmp()
+#include <unistd.h>                 // unlink()
+
+#include <glib.h>
+#include <libxml/tree.h>            // xmlNode
+
+#include <crm/crm.h>                // crm_system_name
+#include <crm/common/metrics_internal.h>
+#include <crm/common/xml.h>
+
+// How often (in seconds) to write metrics to PCMK_metrics_directory
+#define METRICS_DUMP_INTERVAL_S 10
+
+/* Histogram bucket upper bounds. These are fixed so that values from different
+ * nodes and daemons can be aggregated.
+ */
+static const double seconds_bounds[] = {
+    0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5, 10, 30, 60,
+};
+
+static const double sizes_bounds[] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 5000, 10000,
+};
+
+struct pcmk__metric_s {
+    enum pcmk__metric_type type;
+    char *key;              // Registry key (name plus label, if any)
+    char *name;             // Metric family name
+    char *help;             // Description of metric family
+    char *label;            // Label name, if any
+    char *label_value;      // Label value, if any
+    double value;           // Current value, or sum of histogram observations
+    uint64_t count;         // Number of histogram observations
+    const double *bounds;   // Histogram bucket upper bounds
+    int n_bounds;           // Number of entries in bounds
+    uint64_t *buckets;      // Observations per bucket (not cumulative)
+};
+
+// Metric key => pcmk__metric_t *
+static GHashTable *metrics = NULL;
+
+static char *metrics_daemon = NULL;
+static char *dump_path = NULL;
+static guint dump_timer = 0;
+
+static void
+free_metric(gpointer data)
+{
+    pcmk__metric_t *metric = data;
+
+    free(metric->key);
+    free(metric->name);
+    free(metric->help);
+    free(metric->label);
+    free(metric->label_value);
+    free(metric->buckets);
+    free(metric);
+}
+
+/*!
+ * \internal
+ * \brief Get (creating if needed) a metric
+ *
+ * \param[in] type         Type of metric
+ * \param[in] name         Metric family name (for counters, without
+ *                         "_total"; for histograms, ending with a unit such as
+ *                         "_seconds" where one applies)
+ * \param[in] help         Description of metric family
+ * \param[in] label        If not \c NULL, name of label distinguishing this
+ *                         metric within its family
+ * \param[in] label_value  Value of \p label (ignored if \p label is \c NULL)
+ *
+ * \return Metric (valid until \c pcmk__metrics_cleanup())
+ *
+ * \note Metrics are cheap to update but looking one up builds its key, so
+ *       callers on hot paths should keep the returned pointer when the label
+ *       value is fixed.
+ */
+pcmk__metric_t *
+pcmk__metric(enum pcmk__metric_type type, const char *name, const char *help,
+             const char *label, const char *label_value)
+{
+    pcmk__metric_t *metric = NULL;
+    char *key = NULL;
+
+    CRM_ASSERT(name != NULL);
+
+    if (metrics == NULL) {
+        metrics = pcmk__strkey_table(NULL, free_metric);
+    }
+
+    if (label == NULL) {
+        metric = g_hash_table_lookup(metrics, name);
+    } else {
+        key = crm_strdup_printf("%s{%s=\"%s\"}",
+                                name, label, pcmk__s(label_value, ""));
+        metric = g_hash_table_lookup(metrics, key);
+    }
+
+    if (metric != NULL) {
+        free(key);
+        return metric;
+    }
+
+    metric = pcmk__assert_alloc(1, sizeof(pcmk__metric_t));
+    metric->type = type;
+    metric->key = (key != NULL)? key : pcmk__str_copy(name);
+    metric->name = pcmk__str_copy(name);
+    metric->help = pcmk__str_copy(help);
+    if (label != NULL) {
+        metric->label = pcmk__str_copy(label);
+        metric->label_value = pcmk__str_copy(pcmk__s(label_value, ""));
+    }
+
+    switch (type) {
+        case pcmk__metric_seconds:
+            metric->bounds = seconds_bounds;
+            metric->n_bounds = PCMK__NELEM(seconds_bounds);
+            break;
+        case pcmk__metric_sizes:
+            metric->bounds = sizes_bounds;
+            metric->n_bounds = PCMK__NELEM(sizes_bounds);
+            break;
+        default:
+            break;
+    }
+    if (metric->n_bounds > 0) {
+        metric->buckets = pcmk__assert_alloc(metric->n_bounds,
+                                             sizeof(uint64_t));
+    }
+
+    g_hash_table_insert(metrics, metric->key, metric);
+    return metric;
+}
+
+/*!
+ * \internal
+ * \brief Increase a counter or gauge
+ *
+ * \param[in,out] metric  Metric to update
+ * \param[in]     value   Amount to add (must not be negative for counters)
+ */
+void
+pcmk__metric_add(pcmk__metric_t *metric, double value)
+{
+    if ((metric != NULL) && (metric->bounds == NULL)) {
+        metric->value += value;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Set the current value of a gauge
+ *
+ * \param[in,out] metric  Metric to update
+ * \param[in]     value   New value
+ */
+void
+pcmk__metric_set(pcmk__metric_t *metric, double value)
+{
+    if ((metric != NULL) && (metric->type == pcmk__metric_gauge)) {
+        metric->value = value;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Record an observation in a histogram
+ *
+ * \param[in,out] metric  Metric to update
+ * \param[in]     value   Observed value
+ */
+void
+pcmk__metric_observe(pcmk__metric_t *metric, double value)
+{
+    if ((metric == NULL) || (metric->bounds == NULL)) {
+        return;
+    }
+
+    metric->value += value;
+    metric->count++;
+
+    // Observations above the largest bound are counted only in the +Inf bucket
+    for (int i = 0; i < metric->n_bounds; i++) {
+        if (value <= metric->bounds[i]) {
+            metric->buckets[i]++;
+            break;
+        }
+    }
+}
+
+static const char *
+metric_type_text(const pcmk__metric_t *metric)
+{
+    switch (metric->type) {
+        case pcmk__metric_counter:
+            return "counter";
+        case pcmk__metric_gauge:
+            return "gauge";
+        default:
+            return "histogram";
+    }
+}
+
+static gint
+compare_metrics(gconstpointer a, gconstpointer b)
+{
+    return strcmp(((const pcmk__metric_t *) a)->key,
+                  ((const pcmk__metric_t *) b)->key);
+}
+
+static void
+add_double(xmlNode *xml, const char *name, double value)
+{
+    char buf[32];
+
+    snprintf(buf, sizeof(buf), "%.15g", value);
+    crm_xml_add(xml, name, buf);
+}
+
+/*!
+ * \internal
+ * \brief Create XML with the current value of every metric in this process
+ *
+ * \param[in,out] parent  If not \c NULL, add XML as a child of this
+ *
+ * \return Newly created XML (metrics are sorted by name and label)
+ */
+xmlNode *
+pcmk__metrics_xml(xmlNode *parent)
+{
+    xmlNode *xml = pcmk__xe_create(parent, PCMK_XE_METRICS);
+    GList *sorted = NULL;
+
+    crm_xml_add(xml, PCMK_XA_DAEMON,
+                pcmk__s(metrics_daemon, crm_system_name));
+
+    if (metrics != NULL) {
+        sorted = g_list_sort(g_hash_table_get_values(metrics),
+                             compare_metrics);
+    }
+
+    for (const GList *iter = sorted; iter != NULL; iter = iter->next) {
+        const pcmk__metric_t *metric = iter->data;
+        xmlNode *metric_xml = pcmk__xe_create(xml, PCMK_XE_METRIC);
+        uint64_t cumulative = 0;
+
+        crm_xml_add(metric_xml, PCMK_XA_NAME, metric->name);
+        crm_xml_add(metric_xml, PCMK_XA_TYPE, metric_type_text(metric));
+        crm_xml_add(metric_xml, PCMK_XA_DESCRIPTION, metric->help);
+        crm_xml_add(metric_xml, PCMK_XA_LABEL, metric->label);
+        crm_xml_add(metric_xml, PCMK_XA_LABEL_VALUE, metric->label_value);
+
+        if (metric->bounds == NULL) {
+            add_double(metric_xml, PCMK_XA_VALUE, metric->value);
+            continue;
+        }
+
+        crm_xml_add_ll(metric_xml, PCMK_XA_COUNT, (long long) metric->count);
+        add_double(metric_xml, PCMK_XA_SUM, metric->value);
+
+        for (int i = 0; i < metric->n_bounds; i++) {
+            xmlNode *bucket = pcmk__xe_create(metric_xml, PCMK_XE_BUCKET);
+
+            cumulative += metric->buckets[i];
+            add_double(bucket, PCMK_XA_UPPER_BOUND, metric->bounds[i]);
+            crm_xml_add_ll(bucket, PCMK_XA_COUNT, (long long) cumulative);
+        }
+    }
+
+    g_list_free(sorted);
+    return xml;
+}
+
+/*!
+ * \internal
+ * \brief Append a string to a buffer, escaped as OpenMetrics requires
+ *
+ * \param[in,out] buffer  Buffer to append to
+ * \param[in]     text    String to escape
+ * \param[in]     quoted  Whether \p text will be inside double quotes
+ */
+static void
+append_escaped(GString *buffer, const char *text, bool quoted)
+{
+    for (const char *c = pcmk__s(text, ""); *c != '\0'; c++) {
+        switch (*c) {
+            case '\\':
+                g_string_append(buffer, "\\\\");
+                break;
+            case '\n':
+                g_string_append(buffer, "\\n");
+                break;
+            case '"':
+                g_string_append(buffer, (quoted? "\\\"" : "\""));
+                break;
+            default:
+                g_string_append_c(buffer, *c);
+                break;
+        }
+    }
+}
+
+/*!
+ * \internal
+ * \brief Append one OpenMetrics sample line to a buffer
+ *
+ * \param[in,out] buffer  Buffer to append to
+ * \param[in]     daemon  Name of daemon that metric came from, if known
+ * \param[in]     metric  Metric XML
+ * \param[in]     suffix  Sample name suffix (such as "_total"), if any
+ * \param[in]     le      Histogram bucket upper bound, if any
+ * \param[in]     value   Sample value
+ */
+static void
+append_sample(GString *buffer, const char *daemon, const xmlNode *metric,
+              const char *suffix, const char *le, const char *value)
+{
+    const char *label = crm_element_value(metric, PCMK_XA_LABEL);
+    const char *sep = "";
+
+    g_string_append(buffer, crm_element_value(metric, PCMK_XA_NAME));
+    g_string_append(buffer, pcmk__s(suffix, ""));
+
+    if ((daemon != NULL) || (label != NULL) || (le != NULL)) {
+        g_string_append_c(buffer, '{');
+        if (daemon != NULL) {
+            g_string_append(buffer, "daemon=\"");
+            append_escaped(buffer, daemon, true);
+            g_string_append_c(buffer, '"');
+            sep = ",";
+        }
+        if (label != NULL) {
+            pcmk__g_strcat(buffer, sep, label, "=\"", NULL);
+            append_escaped(buffer,
+                           crm_element_value(metric, PCMK_XA_LABEL_VALUE),
+                           true);
+            g_string_append_c(buffer, '"');
+            sep = ",";
+        }
+        if (le != NULL) {
+            pcmk__g_strcat(buffer, sep, "le=\"", le, "\"", NULL);
+        }
+        g_string_append_c(buffer, '}');
+    }
+
+    pcmk__g_strcat(buffer, " ", pcmk__s(value, "0"), "\n", NULL);
+}
+
+/*!
+ * \internal
+ * \brief Render metrics XML as OpenMetrics text
+ *
+ * \param[in]     xml     Metrics XML, as created by \c pcmk__metrics_xml()
+ * \param[in,out] buffer  Buffer to append text to
+ *
+ * \note Each sample gets a "daemon" label so that files from several daemons
+ *       can be collected together.
+ */
+void
+pcmk__metrics_xml_to_text(const xmlNode *xml, GString *buffer)
+{
+    const char *daemon = crm_element_value(xml, PCMK_XA_DAEMON);
+    const char *last_name = NULL;
+
+    for (const xmlNode *metric = pcmk__xe_first_child(xml, PCMK_XE_METRIC,
+                                                      NULL, NULL);
+         metric != NULL; metric = pcmk__xe_next_same(metric)) {
+
+        const char *name = crm_element_value(metric, PCMK_XA_NAME);
+        const char *type = crm_element_value(metric, PCMK_XA_TYPE);
+
+        if (name == NULL) {
+            continue;
+        }
+
+        // Metrics are sorted, so each family's samples are together
+        if (!pcmk__str_eq(name, last_name, pcmk__str_none)) {
+            pcmk__g_strcat(buffer, "# TYPE ", name, " ", type, "\n", NULL);
+            pcmk__g_strcat(buffer, "# HELP ", name, " ", NULL);
+            append_escaped(buffer,
+                           crm_element_value(metric, PCMK_XA_DESCRIPTION),
+                           false);
+            g_string_append_c(buffer, '\n');
+            last_name = name;
+        }
+
+        if (pcmk__str_eq(type, "counter", pcmk__str_none)) {
+            append_sample(buffer, daemon, metric, "_total", NULL,
+                          crm_element_value(metric, PCMK_XA_VALUE));
+
+        } else if (pcmk__str_eq(type, "histogram", pcmk__str_none)) {
+            const char *count = crm_element_value(metric, PCMK_XA_COUNT);
+
+            for (const xmlNode *bucket = pcmk__xe_first_child(metric,
+                                                              PCMK_XE_BUCKET,
+                                                              NULL, NULL);
+                 bucket != NULL; bucket = pcmk__xe_next_same(bucket)) {
+
+                append_sample(buffer, daemon, metric, "_bucket",
+                              crm_element_value(bucket, PCMK_XA_UPPER_BOUND),
+                              crm_element_value(bucket, PCMK_XA_COUNT));
+            }
+            append_sample(buffer, daemon, metric, "_bucket", "+Inf", count);
+            append_sample(buffer, daemon, metric, "_count", NULL, count);
+            append_sample(buffer, daemon, metric, "_sum", NULL,
+                          crm_element_value(metric, PCMK_XA_SUM));
+
+        } else {
+            append_sample(buffer, daemon, metric, NULL, NULL,
+                          crm_element_value(metric, PCMK_XA_VALUE));
+        }
+    }
+    g_string_append(buffer, "# EOF\n");
+}
+
+/*!
+ * \internal
+ * \brief Write all metrics to the metrics file
+ *
+ * The file is written under a temporary name then renamed, so that readers
+ * such as a node exporter's text file collector never see a partial file.
+ *
+ * \return Standard Pacemaker return code
+ */
+static int
+dump_metrics(void)
+{
+    xmlNode *xml = pcmk__metrics_xml(NULL);
+    GString *buffer = g_string_sized_new(4096);
+    char *tmp_path = crm_strdup_printf("%s.tmp", dump_path);
+    FILE *fp = NULL;
+    int rc = pcmk_rc_ok;
+
+    pcmk__metrics_xml_to_text(xml, buffer);
+    free_xml(xml);
+
+    fp = fopen(tmp_path, "w");
+    if (fp == NULL) {
+        rc = errno;
+        goto done;
+    }
+    if (fputs(buffer->str, fp) < 0) {
+        rc = EIO;
+    }
+    if ((fclose(fp) != 0) && (rc == pcmk_rc_ok)) {
+        rc = errno;
+    }
+    if ((rc == pcmk_rc_ok) && (rename(tmp_path, dump_path) < 0)) {
+        rc = errno;
+    }
+    if (rc != pcmk_rc_ok) {
+        unlink(tmp_path);
+    }
+
+done:
+    free(tmp_path);
+    g_string_free(buffer, TRUE);
+    return rc;
+}
+
+static gboolean
+dump_metrics_cb(gpointer user_data)
+{
+    int rc = dump_metrics();
+
+    if (rc != pcmk_rc_ok) {
+        crm_warn("Could not write metrics to %s: %s",
+                 dump_path, pcmk_rc_str(rc));
+    }
+    return G_SOURCE_CONTINUE;
+}
+
+/*!
+ * \internal
+ * \brief Set up metrics for a daemon
+ *
+ * If the PCMK_metrics_directory environment variable is set, this also
+ * arranges for the daemon's metrics to be written periodically to
+ * "<daemon>.prom" in that directory, in OpenMetrics text format.
+ *
+ * \param[in] daemon  Name of daemon
+ *
+ * \note This should be called after logging is initialized and before the
+ *       main loop is started.
+ */
+void
+pcmk__metrics_init(const char *daemon)
+{
+    const char *dir = pcmk__env_option(PCMK__ENV_METRICS_DIRECTORY);
+
+    CRM_ASSERT(daemon != NULL);
+    pcmk__str_update(&metrics_daemon, daemon);
+
+    if (pcmk__str_empty(dir) || (dump_timer != 0)) {
+        return;
+    }
+
+    dump_path = crm_strdup_printf("%s/%s.prom", dir, daemon);
+    dump_timer = g_timeout_add_seconds(METRICS_DUMP_INTERVAL_S,
+                                       dump_metrics_cb, NULL);
+    crm_info("Writing metrics to %s every %ds",
+             dump_path, METRICS_DUMP_INTERVAL_S);
+}
+
+/*!
+ * \internal
+ * \brief Free all metrics and stop writing them to a file
+ */
+void
+pcmk__metrics_cleanup(void)
+{
+    if (dump_timer != 0) {
+        g_source_remove(dump_timer);
+        dump_timer = 0;
+    }
+    if (metrics != NULL) {
+        g_hash_table_destroy(metrics);
+        metrics = NULL;
+    }
+    free(dump_path);
+    dump_path = NULL;
+    free(metrics_daemon);
+    metrics_daemon = NULL;
+}
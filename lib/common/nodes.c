@@ -149,14 +149,38 @@ pcmk__xe_add_node(xmlNode *xml, const char *node, int nodeid)
 pcmk_node_t *
 pcmk__find_node_in_list(const GList *nodes, const char *node_name)
 {
-    if (node_name != NULL) {
-        for (const GList *iter = nodes; iter != NULL; iter = iter->next) {
-            pcmk_node_t *node = (pcmk_node_t *) iter->data;
+    const pcmk_scheduler_t *scheduler = NULL;
+    const char *fold = NULL;
 
-            if (pcmk__str_eq(node->details->uname, node_name,
-                             pcmk__str_casei)) {
+    if ((node_name == NULL) || (nodes == NULL)) {
+        return NULL;
+    }
+
+    scheduler = ((const pcmk_node_t *) nodes->data)->details->data_set;
+    if (pcmk__sched_interning(scheduler)) {
+        if (nodes == scheduler->nodes) {
+            return g_hash_table_lookup(scheduler->internal->node_names,
+                                       node_name);
+        }
+
+        // Node names are interned if the nodes' scheduler data supports it
+        fold = pcmk__sched_fold(scheduler, node_name);
+        if (fold == NULL) {
+            return NULL;
+        }
+    }
+
+    for (const GList *iter = nodes; iter != NULL; iter = iter->next) {
+        pcmk_node_t *node = (pcmk_node_t *) iter->data;
+
+        if (fold != NULL) {
+            if ((node->details->uname != NULL)
+                && (pcmk__interned_fold(node->details->uname) == fold)) {
                 return node;
             }
+        } else if (pcmk__str_eq(node->details->uname, node_name,
+                                pcmk__str_casei)) {
+            return node;
         }
     }
     return NULL;
@@ -339,6 +339,9 @@ xml_create_patchset(int format, xmlNode *source, xmlNode *target,
         return NULL; /* No change */
     }
 
+    // In case change tracking was never enabled for parts of target
+    pcmk__xml_new_private_data(target);
+
     config = is_config_change(target);
     if (config_changed) {
         *config_changed = config;
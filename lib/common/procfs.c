@@ -1,5 +1,5 @@
 /*
- * Copyright 2015-2022 the Pacemaker project contributors
+ * Copyright 2015-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -164,6 +164,79 @@ pcmk__procfs_num_cores(void)
     return cores? cores : 1;
 }
 
+/*!
+ * \internal
+ * \brief Get the recent pressure stall information (PSI) for a resource
+ *
+ * \param[in]  resource  Resource to check ("cpu", "io", or "memory")
+ * \param[out] some      Where to store the percentage of the last minute in
+ *                       which at least one task was stalled on \p resource
+ * \param[out] full      If not NULL, where to store the percentage of the last
+ *                       minute in which all non-idle tasks were stalled on
+ *                       \p resource (or 0.0 if the kernel doesn't report it)
+ *
+ * \return Standard Pacemaker return code
+ * \note PSI is available only on Linux 4.20 and later, and only if the kernel
+ *       was built (and booted) with it enabled.
+ */
+int
+pcmk__procfs_pressure(const char *resource, double *some, double *full)
+{
+#if HAVE_LINUX_PROCFS
+    char path[PATH_MAX];
+    char buffer[256];
+    FILE *stream = NULL;
+    bool found_some = false;
+    int rc = pcmk_rc_ok;
+
+    if ((resource == NULL) || (some == NULL)) {
+        return EINVAL;
+    }
+    *some = 0.0;
+    if (full != NULL) {
+        *full = 0.0;
+    }
+
+    if (snprintf(path, PATH_MAX, "/proc/pressure/%s",
+                 resource) >= PATH_MAX) {
+        return ENAMETOOLONG;
+    }
+
+    stream = fopen(path, "r");
+    if (stream == NULL) {
+        return errno;
+    }
+
+    /* Each line looks like:
+     * some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+     */
+    while (fgets(buffer, sizeof(buffer), stream) != NULL) {
+        double avg60 = 0.0;
+
+        if (sscanf(buffer, "some avg10=%*f avg60=%lf", &avg60) == 1) {
+            *some = avg60;
+            found_some = true;
+
+        } else if ((full != NULL)
+                   && (sscanf(buffer, "full avg10=%*f avg60=%lf",
+                              &avg60) == 1)) {
+            *full = avg60;
+        }
+    }
+
+    // Reads fail with EOPNOTSUPP if PSI was disabled at boot
+    if (ferror(stream)) {
+        rc = (errno != 0)? errno : EIO;
+    } else if (!found_some) {
+        rc = pcmk_rc_bad_input;
+    }
+    fclose(stream);
+    return rc;
+#else
+    return EOPNOTSUPP;
+#endif // HAVE_LINUX_PROCFS
+}
+
 /*!
  * \internal
  * \brief Get the executable path corresponding to a process ID
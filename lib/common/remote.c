@@ -472,6 +472,26 @@ remote_send_iovs(pcmk__remote_t *remote, struct iovec *iov, int iovs)
     return rc;
 }
 
+/*!
+ * \internal
+ * \brief Add a chunk of serialized XML to a list of I/O vectors
+ *
+ * \param[in]     text       Text to add
+ * \param[in]     length     Number of bytes in \p text
+ * \param[in,out] user_data  I/O vectors (<tt>GArray *</tt> of \c struct iovec)
+ *
+ * \return Standard Pacemaker return code
+ */
+static int
+add_xml_iov(const char *text, size_t length, void *user_data)
+{
+    GArray *iovs = user_data;
+    struct iovec iov = { g_strndup(text, length), length };
+
+    g_array_append_val(iovs, iov);
+    return pcmk_rc_ok;
+}
+
 /*!
  * \internal
  * \brief Send an XML message over a Pacemaker Remote connection
@@ -486,42 +506,54 @@ pcmk__remote_send_xml(pcmk__remote_t *remote, const xmlNode *msg)
 {
     int rc = pcmk_rc_ok;
     static uint64_t id = 0;
-    GString *xml_text = NULL;
-
-    struct iovec iov[2];
+    GArray *iovs = NULL;
+    struct iovec *iov = NULL;
     struct remote_header_v0 *header;
 
     CRM_CHECK((remote != NULL) && (msg != NULL), return EINVAL);
 
-    xml_text = g_string_sized_new(1024);
-    pcmk__xml_string(msg, 0, xml_text, 0);
-    CRM_CHECK(xml_text->len > 0,
-              g_string_free(xml_text, TRUE); return EINVAL);
+    /* Rather than build the whole message as one contiguous (and repeatedly
+     * reallocated) string, keep it as the serializer's chunks and send those
+     * in turn. The first vector is reserved for the header.
+     */
+    iovs = g_array_sized_new(FALSE, TRUE, sizeof(struct iovec), 8);
+    g_array_set_size(iovs, 1);
+    rc = pcmk__xml_stream(msg, 0, add_xml_iov, iovs);
+    CRM_CHECK((rc == pcmk_rc_ok) && (iovs->len > 1), rc = EINVAL; goto done);
 
-    header = pcmk__assert_alloc(1, sizeof(struct remote_header_v0));
+    iov = (struct iovec *) (void *) iovs->data;
 
+    header = pcmk__assert_alloc(1, sizeof(struct remote_header_v0));
     iov[0].iov_base = header;
     iov[0].iov_len = sizeof(struct remote_header_v0);
 
-    iov[1].iov_len = 1 + xml_text->len;
-    iov[1].iov_base = g_string_free(xml_text, FALSE);
+    // Each chunk is nul-terminated, so the last one can include that
+    iov[iovs->len - 1].iov_len++;
 
     id++;
     header->id = id;
     header->endian = ENDIAN_LOCAL;
     header->version = REMOTE_MSG_VERSION;
     header->payload_offset = iov[0].iov_len;
-    header->payload_uncompressed = iov[1].iov_len;
-    header->size_total = iov[0].iov_len + iov[1].iov_len;
+    header->size_total = 0;
+    for (guint lpc = 0; lpc < iovs->len; lpc++) {
+        header->size_total += iov[lpc].iov_len;
+    }
+    header->payload_uncompressed = header->size_total - iov[0].iov_len;
 
-    rc = remote_send_iovs(remote, iov, 2);
+    rc = remote_send_iovs(remote, iov, (int) iovs->len);
     if (rc != pcmk_rc_ok) {
         crm_err("Could not send remote message: %s " CRM_XS " rc=%d",
                 pcmk_rc_str(rc), rc);
     }
 
+done:
+    iov = (struct iovec *) (void *) iovs->data;
     free(iov[0].iov_base);
-    g_free((gchar *) iov[1].iov_base);
+    for (guint lpc = 1; lpc < iovs->len; lpc++) {
+        g_free(iov[lpc].iov_base);
+    }
+    g_array_free(iovs, TRUE);
     return rc;
 }
 
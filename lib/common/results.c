@@ -21,6 +21,7 @@
 #include <qb/qbdefs.h>
 
 #include <crm/common/mainloop.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/xml.h>
 
 G_DEFINE_QUARK(pcmk-rc-error-quark, pcmk__rc_error)
@@ -943,6 +944,7 @@ crm_exit(crm_exit_t rc)
     }
 
     mainloop_cleanup();
+    pcmk__metrics_cleanup();
     crm_xml_cleanup();
 
     free(pcmk__our_nodename);
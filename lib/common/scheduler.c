@@ -10,11 +10,14 @@
 #include <crm_internal.h>
 
 #include <stdint.h>             // uint32_t
+#include <stdlib.h>             // getenv(), free()
+#include <string.h>             // strstr(), strlen(), memcpy()
 #include <errno.h>              // EINVAL
 #include <glib.h>               // gboolean, FALSE
 #include <libxml/tree.h>        // xmlNode
 
 #include <crm/common/scheduler.h>
+#include <crm/common/scheduler_internal.h>
 
 uint32_t pcmk__warnings = 0;
 
@@ -107,3 +110,271 @@ pcmk_find_node(const pcmk_scheduler_t *scheduler, const char *node_name)
     }
     return pcmk__find_node_in_list(scheduler->nodes, node_name);
 }
+
+/*!
+ * \internal
+ * \brief Create new private scheduler data
+ *
+ * \return Newly allocated private scheduler data (guaranteed not \c NULL)
+ * \note The caller is responsible for freeing the result with
+ *       \c pcmk__free_scheduler_private().
+ */
+pcmk__scheduler_private_t *
+pcmk__new_scheduler_private(void)
+{
+    pcmk__scheduler_private_t *priv = NULL;
+    const char *slice = getenv("G_SLICE");
+
+    priv = pcmk__assert_alloc(1, sizeof(pcmk__scheduler_private_t));
+
+    /* Honor GLib's convention for disabling custom allocators, so that tools
+     * such as valgrind can track scheduler objects individually
+     */
+    if ((slice == NULL) || (strstr(slice, "always-malloc") == NULL)) {
+        priv->arena = pcmk__arena_new(0);
+    }
+
+    /* Interned strings are allocated from the arena if there is one, and are
+     * otherwise owned by the strings table
+     */
+    priv->strings = g_hash_table_new_full(g_str_hash, g_str_equal, NULL,
+                                          (priv->arena == NULL)? free : NULL);
+    priv->folded = pcmk__strikey_table(NULL, NULL);
+
+    priv->node_ids = pcmk__strikey_table(NULL, NULL);
+    priv->node_names = pcmk__strikey_table(NULL, NULL);
+    priv->rsc_names = pcmk__strkey_table(free,
+                                         (GDestroyNotify) g_ptr_array_unref);
+    priv->current_instances = g_hash_table_new_full(NULL, NULL, NULL,
+                                                    (GDestroyNotify)
+                                                    g_hash_table_destroy);
+    priv->next_instances = g_hash_table_new_full(NULL, NULL, NULL,
+                                                 (GDestroyNotify)
+                                                 g_hash_table_destroy);
+    return priv;
+}
+
+/*!
+ * \internal
+ * \brief Free private scheduler data
+ *
+ * \param[in,out] priv  Private scheduler data to free
+ */
+void
+pcmk__free_scheduler_private(pcmk__scheduler_private_t *priv)
+{
+    if (priv != NULL) {
+        if (priv->main_digests != NULL) {
+            g_hash_table_destroy(priv->main_digests);
+        }
+        if (priv->graph_notify_data != NULL) {
+            g_hash_table_destroy(priv->graph_notify_data);
+        }
+        g_hash_table_destroy(priv->next_instances);
+        g_hash_table_destroy(priv->current_instances);
+        g_hash_table_destroy(priv->rsc_names);
+        g_hash_table_destroy(priv->node_names);
+        g_hash_table_destroy(priv->node_ids);
+        g_hash_table_destroy(priv->folded);
+        g_hash_table_destroy(priv->strings);
+        pcmk__arena_free(priv->arena);
+        free(priv);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Release per-run contents of private scheduler data
+ *
+ * \param[in,out] scheduler  Scheduler data
+ *
+ * \note This must be called only after all objects allocated with
+ *       \c pcmk__sched_alloc() have been freed with \c pcmk__sched_free().
+ */
+void
+pcmk__reset_scheduler_private(pcmk_scheduler_t *scheduler)
+{
+    pcmk__scheduler_private_t *priv = NULL;
+
+    if ((scheduler == NULL) || (scheduler->internal == NULL)) {
+        return;
+    }
+    priv = scheduler->internal;
+
+    g_clear_pointer(&priv->main_digests, g_hash_table_destroy);
+    g_clear_pointer(&priv->graph_notify_data, g_hash_table_destroy);
+    g_hash_table_remove_all(priv->next_instances);
+    g_hash_table_remove_all(priv->current_instances);
+    g_hash_table_remove_all(priv->rsc_names);
+    g_hash_table_remove_all(priv->node_names);
+    g_hash_table_remove_all(priv->node_ids);
+
+    crm_trace("Releasing %u interned strings",
+              g_hash_table_size(priv->strings));
+    g_hash_table_remove_all(priv->folded);
+    g_hash_table_remove_all(priv->strings);
+
+    if (priv->arena != NULL) {
+        crm_trace("Releasing %zu bytes of scheduler objects (peak %zu)",
+                  pcmk__arena_used(priv->arena),
+                  pcmk__arena_peak(priv->arena));
+        pcmk__arena_reset(priv->arena);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Discard private scheduler data that depends on node assignments
+ *
+ * \param[in,out] scheduler  Scheduler data
+ *
+ * \note This must be called whenever a resource's assigned node changes.
+ */
+void
+pcmk__sched_assignment_changed(pcmk_scheduler_t *scheduler)
+{
+    if ((scheduler != NULL) && (scheduler->internal != NULL)) {
+        g_hash_table_remove_all(scheduler->internal->next_instances);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Allocate an object that lives as long as current scheduler data
+ *
+ * \param[in,out] scheduler  Scheduler data
+ * \param[in]     size       Number of bytes to allocate
+ *
+ * \return Newly allocated, zero-initialized memory (guaranteed not \c NULL)
+ * \note The result must be freed with \c pcmk__sched_free() (which may be a
+ *       no-op if the memory will be released when the scheduler data is
+ *       reset), never with \c free().
+ */
+void *
+pcmk__sched_alloc(pcmk_scheduler_t *scheduler, size_t size)
+{
+    if ((scheduler != NULL) && (scheduler->internal != NULL)
+        && (scheduler->internal->arena != NULL)) {
+        return pcmk__arena_alloc(scheduler->internal->arena, size);
+    }
+    return pcmk__assert_alloc(1, size);
+}
+
+/*!
+ * \internal
+ * \brief Copy a string that lives as long as current scheduler data
+ *
+ * \param[in,out] scheduler  Scheduler data
+ * \param[in]     str        String to copy
+ *
+ * \return Copy of \p str, or \c NULL if \p str is \c NULL
+ * \note The result must be freed with \c pcmk__sched_free(), never with
+ *       \c free().
+ */
+char *
+pcmk__sched_strdup(pcmk_scheduler_t *scheduler, const char *str)
+{
+    if ((scheduler != NULL) && (scheduler->internal != NULL)
+        && (scheduler->internal->arena != NULL)) {
+        return pcmk__arena_strdup(scheduler->internal->arena, str);
+    }
+    return pcmk__str_copy(str);
+}
+
+/*!
+ * \internal
+ * \brief Free an object allocated with \c pcmk__sched_alloc()
+ *
+ * \param[in,out] scheduler  Scheduler data that object was allocated for
+ * \param[in,out] ptr        Object to free
+ */
+void
+pcmk__sched_free(pcmk_scheduler_t *scheduler, void *ptr)
+{
+    if ((scheduler == NULL) || (scheduler->internal == NULL)
+        || (scheduler->internal->arena == NULL)) {
+        free(ptr);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Check whether scheduler data can intern strings
+ *
+ * \param[in] scheduler  Scheduler data to check
+ *
+ * \return true if \c pcmk__sched_intern() returns interned copies for
+ *         \p scheduler, otherwise false
+ */
+bool
+pcmk__sched_interning(const pcmk_scheduler_t *scheduler)
+{
+    return (scheduler != NULL) && (scheduler->internal != NULL);
+}
+
+/*!
+ * \internal
+ * \brief Intern a string for the current scheduler run
+ *
+ * \param[in,out] scheduler  Scheduler data
+ * \param[in]     str        String to intern
+ *
+ * \return Interned copy of \p str, or \p str itself if \p scheduler does not
+ *         support interning (see \c pcmk__sched_interning())
+ * \note An interned copy is shared by all callers interning an identical
+ *       string, is valid until the scheduler data is reset, and must never be
+ *       modified or freed by the caller.
+ */
+const char *
+pcmk__sched_intern(pcmk_scheduler_t *scheduler, const char *str)
+{
+    pcmk__scheduler_private_t *priv = NULL;
+    pcmk__interned_t *entry = NULL;
+    size_t len = 0;
+
+    if ((str == NULL) || !pcmk__sched_interning(scheduler)) {
+        return str;
+    }
+    priv = scheduler->internal;
+
+    entry = g_hash_table_lookup(priv->strings, str);
+    if (entry != NULL) {
+        return entry->str;
+    }
+
+    len = strlen(str) + 1;
+    if (priv->arena != NULL) {
+        entry = pcmk__arena_alloc(priv->arena, sizeof(pcmk__interned_t) + len);
+    } else {
+        entry = pcmk__assert_alloc(1, sizeof(pcmk__interned_t) + len);
+    }
+    memcpy(entry->str, str, len);
+
+    entry->fold = g_hash_table_lookup(priv->folded, str);
+    if (entry->fold == NULL) {
+        entry->fold = entry->str;
+        g_hash_table_add(priv->folded, entry->str);
+    }
+    g_hash_table_insert(priv->strings, entry->str, entry);
+    return entry->str;
+}
+
+/*!
+ * \internal
+ * \brief Get the case-folded handle for a string, if it has been interned
+ *
+ * \param[in] scheduler  Scheduler data
+ * \param[in] str        String to check
+ *
+ * \return First string interned for \p scheduler that is equal to \p str
+ *         ignoring case, or \c NULL if there is none (in which case no
+ *         interned string can match \p str)
+ */
+const char *
+pcmk__sched_fold(const pcmk_scheduler_t *scheduler, const char *str)
+{
+    if ((str == NULL) || !pcmk__sched_interning(scheduler)) {
+        return NULL;
+    }
+    return g_hash_table_lookup(scheduler->internal->folded, str);
+}
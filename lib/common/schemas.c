@@ -38,6 +38,9 @@ typedef struct {
     xmlRelaxNGParserCtxtPtr parser;
 } relaxng_ctx_cache_t;
 
+// XSL transform name -> parsed stylesheet (xsltStylesheet *)
+static GHashTable *xslt_cache = NULL;
+
 static GList *known_schemas = NULL;
 static bool initialized = false;
 static bool silent_logging = FALSE;
@@ -646,6 +649,10 @@ crm_schema_cleanup(void)
         g_list_free_full(known_schemas, free_schema);
         known_schemas = NULL;
     }
+    if (xslt_cache != NULL) {
+        g_hash_table_destroy(xslt_cache);
+        xslt_cache = NULL;
+    }
     initialized = false;
 
     wrap_libxslt(true);
@@ -951,6 +958,48 @@ cib_upgrade_err(void *ctx, const char *fmt, ...)
     va_end(ap);
 }
 
+static void
+free_xslt(gpointer data)
+{
+    xsltFreeStylesheet((xsltStylesheet *) data);
+}
+
+/*!
+ * \internal
+ * \brief Get a parsed XSL stylesheet, parsing and caching it if needed
+ *
+ * \param[in] transform  XSL name
+ *
+ * \return Parsed stylesheet on success, otherwise NULL
+ * \note The result is owned by the cache and will be freed by
+ *       crm_schema_cleanup().
+ */
+static xsltStylesheet *
+get_xslt(const char *transform)
+{
+    char *xform = NULL;
+    xsltStylesheet *xslt = NULL;
+
+    if (xslt_cache == NULL) {
+        xslt_cache = pcmk__strkey_table(free, free_xslt);
+    } else {
+        xslt = g_hash_table_lookup(xslt_cache, transform);
+        if (xslt != NULL) {
+            return xslt;
+        }
+    }
+
+    xform = pcmk__xml_artefact_path(pcmk__xml_artefact_ns_legacy_xslt,
+                                    transform);
+    xslt = xsltParseStylesheetFile((pcmkXmlStr) xform);
+    free(xform);
+
+    if (xslt != NULL) {
+        g_hash_table_insert(xslt_cache, pcmk__str_copy(transform), xslt);
+    }
+    return xslt;
+}
+
 /*!
  * \internal
  * \brief Apply a single XSL transformation to given XML
@@ -966,14 +1015,10 @@ static xmlNode *
 apply_transformation(const xmlNode *xml, const char *transform,
                      gboolean to_logs)
 {
-    char *xform = NULL;
     xmlNode *out = NULL;
     xmlDocPtr res = NULL;
     xsltStylesheet *xslt = NULL;
 
-    xform = pcmk__xml_artefact_path(pcmk__xml_artefact_ns_legacy_xslt,
-                                    transform);
-
     /* for capturing, e.g., what's emitted via <xsl:message> */
     if (to_logs) {
         xsltSetGenericErrorFunc(NULL, cib_upgrade_err);
@@ -981,23 +1026,16 @@ apply_transformation(const xmlNode *xml, const char *transform,
         xsltSetGenericErrorFunc(&crm_log_level, cib_upgrade_err);
     }
 
-    xslt = xsltParseStylesheetFile((pcmkXmlStr) xform);
-    CRM_CHECK(xslt != NULL, goto cleanup);
+    // Stylesheets are parsed once and reused for all later upgrades
+    xslt = get_xslt(transform);
+    CRM_CHECK(xslt != NULL, return NULL);
 
     res = xsltApplyStylesheet(xslt, xml->doc, NULL);
-    CRM_CHECK(res != NULL, goto cleanup);
+    CRM_CHECK(res != NULL, return NULL);
 
     xsltSetGenericErrorFunc(NULL, NULL);  /* restore default one */
 
     out = xmlDocGetRootElement(res);
-
-  cleanup:
-    if (xslt) {
-        xsltFreeStylesheet(xslt);
-    }
-
-    free(xform);
-
     return out;
 }
 
@@ -839,7 +839,6 @@ pcmk__compress(const char *data, unsigned int length, unsigned int max,
 {
     int rc;
     char *compressed = NULL;
-    char *uncompressed = strdup(data);
 #ifdef CLOCK_MONOTONIC
     struct timespec after_t;
     struct timespec before_t;
@@ -856,12 +855,11 @@ pcmk__compress(const char *data, unsigned int length, unsigned int max,
     compressed = pcmk__assert_alloc((size_t) max, sizeof(char));
 
     *result_len = max;
-    rc = BZ2_bzBuffToBuffCompress(compressed, result_len, uncompressed, length,
-                                  CRM_BZ2_BLOCKS, 0, CRM_BZ2_WORK);
+    // bzip2 doesn't modify its input, despite the lack of const
+    rc = BZ2_bzBuffToBuffCompress(compressed, result_len, (char *) data,
+                                  length, CRM_BZ2_BLOCKS, 0, CRM_BZ2_WORK);
     rc = pcmk__bzlib2rc(rc);
 
-    free(uncompressed);
-
     if (rc != pcmk_rc_ok) {
         crm_err("Compression of %d bytes failed: %s " CRM_XS " rc=%d",
                 length, pcmk_rc_str(rc), rc);
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <errno.h>
+
+#include <crm/common/unittest_internal.h>
+#include <crm/common/agents.h>
+
+static void
+null_output(void **state)
+{
+    assert_int_equal(pcmk__cached_agent_metadata("ocf", "heartbeat", "Dummy",
+                                                 "/bin/true", NULL),
+                     EINVAL);
+}
+
+static void
+invalid_agent(void **state)
+{
+    char *output = NULL;
+
+    assert_int_equal(pcmk__cached_agent_metadata("ocf", "heartbeat", NULL,
+                                                 "/bin/true", &output),
+                     ENOENT);
+    assert_null(output);
+
+    // Keys that could escape the cache directory are never used
+    assert_int_equal(pcmk__cached_agent_metadata("ocf", "heartbeat",
+                                                 "../Dummy", "/bin/true",
+                                                 &output),
+                     ENOENT);
+    assert_null(output);
+}
+
+static void
+missing_agent(void **state)
+{
+    char *output = NULL;
+
+    assert_int_equal(pcmk__cached_agent_metadata("ocf", "heartbeat", "Dummy",
+                                                 "/nonexistent/Dummy",
+                                                 &output),
+                     ENOENT);
+    assert_null(output);
+}
+
+PCMK__UNIT_TEST(NULL, NULL,
+                cmocka_unit_test(null_output),
+                cmocka_unit_test(invalid_agent),
+                cmocka_unit_test(missing_agent))
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <stdint.h>
+
+#include <crm/common/unittest_internal.h>
+#include <crm/common/arena_internal.h>
+
+static void
+null_arena(void **state)
+{
+    pcmk__assert_asserts(pcmk__arena_alloc(NULL, 10));
+}
+
+static void
+zero_initialized(void **state)
+{
+    pcmk__arena_t *arena = pcmk__arena_new(0);
+    char *ptr = pcmk__arena_alloc(arena, 64);
+
+    for (int i = 0; i < 64; i++) {
+        assert_int_equal(ptr[i], 0);
+    }
+    pcmk__arena_free(arena);
+}
+
+static void
+aligned(void **state)
+{
+    pcmk__arena_t *arena = pcmk__arena_new(0);
+
+    for (size_t size = 0; size < 100; size++) {
+        void *ptr = pcmk__arena_alloc(arena, size);
+
+        assert_int_equal(((uintptr_t) ptr) % (2 * sizeof(size_t)), 0);
+    }
+    pcmk__arena_free(arena);
+}
+
+static void
+distinct(void **state)
+{
+    pcmk__arena_t *arena = pcmk__arena_new(128);
+    int *first = pcmk__arena_alloc(arena, sizeof(int));
+    int *second = pcmk__arena_alloc(arena, sizeof(int));
+
+    assert_ptr_not_equal(first, second);
+    *first = 1;
+    *second = 2;
+    assert_int_equal(*first, 1);
+    assert_int_equal(*second, 2);
+    pcmk__arena_free(arena);
+}
+
+static void
+spans_chunks(void **state)
+{
+    // Allocate far more than one chunk holds, then check earlier contents
+    pcmk__arena_t *arena = pcmk__arena_new(128);
+    int *ptrs[200];
+
+    for (int i = 0; i < 200; i++) {
+        ptrs[i] = pcmk__arena_alloc(arena, sizeof(int));
+        *ptrs[i] = i;
+    }
+    for (int i = 0; i < 200; i++) {
+        assert_int_equal(*ptrs[i], i);
+    }
+    assert_true(pcmk__arena_used(arena) >= 200 * sizeof(int));
+    pcmk__arena_free(arena);
+}
+
+static void
+large_allocation(void **state)
+{
+    pcmk__arena_t *arena = pcmk__arena_new(128);
+    int *small = pcmk__arena_alloc(arena, sizeof(int));
+    char *large = pcmk__arena_alloc(arena, 4096);
+
+    *small = 42;
+    memset(large, 'x', 4096);
+    assert_int_equal(*small, 42);
+    assert_int_equal(large[4095], 'x');
+    pcmk__arena_free(arena);
+}
+
+PCMK__UNIT_TEST(NULL, NULL,
+                cmocka_unit_test(null_arena),
+                cmocka_unit_test(zero_initialized),
+                cmocka_unit_test(aligned),
+                cmocka_unit_test(distinct),
+                cmocka_unit_test(spans_chunks),
+                cmocka_unit_test(large_allocation))
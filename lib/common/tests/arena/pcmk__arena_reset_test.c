@@ -0,0 +1,63 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/unittest_internal.h>
+#include <crm/common/arena_internal.h>
+
+static void
+null_arena(void **state)
+{
+    // Shouldn't crash
+    pcmk__arena_reset(NULL);
+    assert_int_equal(pcmk__arena_used(NULL), 0);
+    assert_int_equal(pcmk__arena_peak(NULL), 0);
+}
+
+static void
+empty_arena(void **state)
+{
+    pcmk__arena_t *arena = pcmk__arena_new(0);
+
+    pcmk__arena_reset(arena);
+    assert_int_equal(pcmk__arena_used(arena), 0);
+    pcmk__arena_free(arena);
+}
+
+static void
+reuse_after_reset(void **state)
+{
+    pcmk__arena_t *arena = pcmk__arena_new(128);
+    size_t peak = 0;
+    char *ptr = NULL;
+
+    for (int i = 0; i < 50; i++) {
+        ptr = pcmk__arena_alloc(arena, 16);
+        memset(ptr, 'x', 16);
+    }
+    pcmk__arena_alloc(arena, 1024);
+    peak = pcmk__arena_used(arena);
+
+    pcmk__arena_reset(arena);
+    assert_int_equal(pcmk__arena_used(arena), 0);
+    assert_int_equal(pcmk__arena_peak(arena), peak);
+
+    // Memory handed out again must be zeroed even if a chunk was reused
+    ptr = pcmk__arena_alloc(arena, 16);
+    for (int i = 0; i < 16; i++) {
+        assert_int_equal(ptr[i], 0);
+    }
+    pcmk__arena_free(arena);
+}
+
+PCMK__UNIT_TEST(NULL, NULL,
+                cmocka_unit_test(null_arena),
+                cmocka_unit_test(empty_arena),
+                cmocka_unit_test(reuse_after_reset))
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/unittest_internal.h>
+#include <crm/common/arena_internal.h>
+
+static void
+null_string(void **state)
+{
+    pcmk__arena_t *arena = pcmk__arena_new(0);
+
+    assert_null(pcmk__arena_strdup(arena, NULL));
+    pcmk__arena_free(arena);
+}
+
+static void
+copies_string(void **state)
+{
+    pcmk__arena_t *arena = pcmk__arena_new(0);
+    const char *str = "abc";
+    char *copy = pcmk__arena_strdup(arena, str);
+
+    assert_string_equal(copy, "abc");
+    assert_ptr_not_equal(copy, str);
+
+    copy = pcmk__arena_strdup(arena, "");
+    assert_string_equal(copy, "");
+    pcmk__arena_free(arena);
+}
+
+PCMK__UNIT_TEST(NULL, NULL,
+                cmocka_unit_test(null_string),
+                cmocka_unit_test(copies_string))
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/unittest_internal.h>
+
+#include <crm/common/iso8601.h>
+
+static void
+assert_parsed(const char *date_time, uint32_t year, uint32_t month,
+              uint32_t day, uint32_t hour, uint32_t minute, uint32_t second)
+{
+    crm_time_t *dt = crm_time_new(date_time);
+    uint32_t y = 0;
+    uint32_t mo = 0;
+    uint32_t d = 0;
+    uint32_t h = 0;
+    uint32_t mi = 0;
+    uint32_t s = 0;
+
+    assert_non_null(dt);
+    crm_time_get_gregorian(dt, &y, &mo, &d);
+    crm_time_get_timeofday(dt, &h, &mi, &s);
+    assert_int_equal(y, year);
+    assert_int_equal(mo, month);
+    assert_int_equal(d, day);
+    assert_int_equal(h, hour);
+    assert_int_equal(mi, minute);
+    assert_int_equal(s, second);
+    crm_time_free(dt);
+}
+
+static void
+extended_format(void **state)
+{
+    assert_parsed("2024-02-29 23:59:58Z", 2024, 2, 29, 23, 59, 58);
+    assert_parsed("2024-02-29T00:00:01Z", 2024, 2, 29, 0, 0, 1);
+    assert_parsed("1999-12-31 12:34:56 +00:00", 1999, 12, 31, 12, 34, 56);
+    assert_parsed("2024-01-01", 2024, 1, 1, 0, 0, 0);
+}
+
+static void
+other_formats(void **state)
+{
+    // Forms that are not handled by the fixed-width fast paths
+    assert_parsed("20240229T235958Z", 2024, 2, 29, 23, 59, 58);
+    assert_parsed("2024-2-9 1:2:3Z", 2024, 2, 9, 1, 2, 3);
+    assert_parsed("2024-060 12:00:00Z", 2024, 2, 29, 12, 0, 0);
+    assert_parsed("2024-W09-4 12:00:00Z", 2024, 2, 29, 12, 0, 0);
+}
+
+static void
+next_day(void **state)
+{
+    assert_parsed("2024-02-28 24:00:00Z", 2024, 2, 29, 0, 0, 0);
+}
+
+static void
+invalid(void **state)
+{
+    assert_null(crm_time_new("2024-13-01 00:00:00Z"));
+    assert_null(crm_time_new("2023-02-29 00:00:00Z"));
+    assert_null(crm_time_new("2024-02-29 25:00:00Z"));
+    assert_null(crm_time_new("2024-02-29 23:60:00Z"));
+    assert_null(crm_time_new("2024-02-29 23:59:60Z"));
+}
+
+PCMK__UNIT_TEST(NULL, NULL,
+                cmocka_unit_test(extended_format),
+                cmocka_unit_test(other_formats),
+                cmocka_unit_test(next_day),
+                cmocka_unit_test(invalid))
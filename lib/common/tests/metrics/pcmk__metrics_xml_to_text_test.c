@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/metrics_internal.h>
+#include <crm/common/unittest_internal.h>
+
+#define LABELS "{daemon=\"pacemaker-test\""
+
+// Render all metrics as text, then free them
+static char *
+render(void)
+{
+    xmlNode *xml = pcmk__metrics_xml(NULL);
+    GString *buffer = g_string_new(NULL);
+
+    pcmk__metrics_xml_to_text(xml, buffer);
+    free_xml(xml);
+    pcmk__metrics_cleanup();
+    return g_string_free(buffer, FALSE);
+}
+
+static void
+no_metrics(void **state)
+{
+    char *text = NULL;
+
+    pcmk__metrics_init("pacemaker-test");
+    text = render();
+
+    assert_string_equal(text, "# EOF\n");
+    g_free(text);
+}
+
+static void
+lookup_reuses_metric(void **state)
+{
+    pcmk__metric_t *metric = pcmk__metric_counter("c", "C");
+
+    assert_ptr_equal(pcmk__metric_counter("c", "C"), metric);
+    assert_ptr_equal(pcmk__metric(pcmk__metric_counter, "c", "C", "op", "x"),
+                     pcmk__metric(pcmk__metric_counter, "c", "C", "op", "x"));
+    assert_ptr_not_equal(pcmk__metric(pcmk__metric_counter, "c", "C", "op",
+                                      "x"),
+                         metric);
+    pcmk__metrics_cleanup();
+}
+
+static void
+counter_and_gauge(void **state)
+{
+    char *text = NULL;
+
+    pcmk__metrics_init("pacemaker-test");
+
+    pcmk__metric_add(pcmk__metric_counter("c", "C help"), 2);
+    pcmk__metric_add(pcmk__metric_counter("c", "C help"), 1);
+    pcmk__metric_set(pcmk__metric_gauge("g", "G help"), 5);
+    pcmk__metric_set(pcmk__metric_gauge("g", "G help"), 3);
+
+    // Wrong kind of update for the metric type is ignored
+    pcmk__metric_observe(pcmk__metric_counter("c", "C help"), 10);
+    pcmk__metric_set(pcmk__metric_counter("c", "C help"), 10);
+
+    text = render();
+    assert_string_equal(text,
+                        "# TYPE c counter\n"
+                        "# HELP c C help\n"
+                        "c_total" LABELS "} 3\n"
+                        "# TYPE g gauge\n"
+                        "# HELP g G help\n"
+                        "g" LABELS "} 3\n"
+                        "# EOF\n");
+    g_free(text);
+}
+
+static void
+histogram(void **state)
+{
+    pcmk__metric_t *metric = pcmk__metric(pcmk__metric_sizes, "h", "H help",
+                                          NULL, NULL);
+    char *text = NULL;
+
+    pcmk__metrics_init("pacemaker-test");
+
+    pcmk__metric_observe(metric, 1);
+    pcmk__metric_observe(metric, 3);
+    pcmk__metric_observe(metric, 20000);
+
+    text = render();
+    assert_non_null(strstr(text, "# TYPE h histogram\n# HELP h H help\n"));
+    assert_non_null(strstr(text, "h_bucket" LABELS ",le=\"1\"} 1\n"));
+    assert_non_null(strstr(text, "h_bucket" LABELS ",le=\"2\"} 1\n"));
+    assert_non_null(strstr(text, "h_bucket" LABELS ",le=\"5\"} 2\n"));
+    assert_non_null(strstr(text, "h_bucket" LABELS ",le=\"10000\"} 2\n"));
+    assert_non_null(strstr(text, "h_bucket" LABELS ",le=\"+Inf\"} 3\n"));
+    assert_non_null(strstr(text, "h_count" LABELS "} 3\n"));
+    assert_non_null(strstr(text, "h_sum" LABELS "} 20004\n"));
+    g_free(text);
+}
+
+static void
+labels_escaped(void **state)
+{
+    char *text = NULL;
+
+    pcmk__metrics_init("pacemaker-test");
+
+    pcmk__metric_add(pcmk__metric(pcmk__metric_counter, "l",
+                                  "Back\\slash\nnewline", "op", "b\"c"),
+                     1);
+    pcmk__metric_add(pcmk__metric(pcmk__metric_counter, "l",
+                                  "Back\\slash\nnewline", "op", "a"),
+                     2);
+
+    text = render();
+
+    // One TYPE and HELP per family, with samples sorted by label
+    assert_string_equal(text,
+                        "# TYPE l counter\n"
+                        "# HELP l Back\\\\slash\\nnewline\n"
+                        "l_total" LABELS ",op=\"a\"} 2\n"
+                        "l_total" LABELS ",op=\"b\\\"c\"} 1\n"
+                        "# EOF\n");
+    g_free(text);
+}
+
+PCMK__UNIT_TEST(NULL, NULL,
+                cmocka_unit_test(no_metrics),
+                cmocka_unit_test(lookup_reuses_metric),
+                cmocka_unit_test(counter_and_gauge),
+                cmocka_unit_test(histogram),
+                cmocka_unit_test(labels_escaped))
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/unittest_internal.h>
+
+#include "mock_private.h"
+
+#include <errno.h>
+
+static void
+null_args(void **state)
+{
+    double some = 1.0;
+
+    assert_int_equal(pcmk__procfs_pressure(NULL, &some, NULL), EINVAL);
+    assert_int_equal(pcmk__procfs_pressure("cpu", NULL, NULL), EINVAL);
+}
+
+static void
+psi_unavailable(void **state)
+{
+    double some = 1.0;
+    double full = 1.0;
+
+    pcmk__mock_fopen = true;
+
+#if defined(HAVE_FOPEN64) && defined(_FILE_OFFSET_BITS) && (_FILE_OFFSET_BITS == 64) && (SIZEOF_LONG < 8)
+    expect_string(__wrap_fopen64, pathname, "/proc/pressure/memory");
+    expect_string(__wrap_fopen64, mode, "r");
+    will_return(__wrap_fopen64, ENOENT);
+#else
+    expect_string(__wrap_fopen, pathname, "/proc/pressure/memory");
+    expect_string(__wrap_fopen, mode, "r");
+    will_return(__wrap_fopen, ENOENT);
+#endif
+
+    assert_int_equal(pcmk__procfs_pressure("memory", &some, &full), ENOENT);
+    assert_true(some == 0.0);
+    assert_true(full == 0.0);
+
+    pcmk__mock_fopen = false;
+}
+
+PCMK__UNIT_TEST(NULL, NULL,
+                cmocka_unit_test(null_args),
+                cmocka_unit_test(psi_unavailable))
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/scheduler.h>
+#include <crm/common/unittest_internal.h>
+
+static void
+no_private_data(void **state)
+{
+    pcmk_scheduler_t scheduler = { 0, };
+    const char *str = "rsc1_start_0";
+
+    assert_false(pcmk__sched_interning(NULL));
+    assert_false(pcmk__sched_interning(&scheduler));
+
+    assert_ptr_equal(pcmk__sched_intern(NULL, str), str);
+    assert_ptr_equal(pcmk__sched_intern(&scheduler, str), str);
+    assert_null(pcmk__sched_fold(&scheduler, str));
+}
+
+static void
+null_string(void **state)
+{
+    pcmk_scheduler_t scheduler = { 0, };
+
+    scheduler.internal = pcmk__new_scheduler_private();
+    assert_null(pcmk__sched_intern(&scheduler, NULL));
+    assert_null(pcmk__sched_fold(&scheduler, NULL));
+    pcmk__free_scheduler_private(scheduler.internal);
+}
+
+static void
+shared_storage(void **state)
+{
+    pcmk_scheduler_t scheduler = { 0, };
+    char buf[] = "rsc1_start_0";
+    const char *interned = NULL;
+
+    scheduler.internal = pcmk__new_scheduler_private();
+    assert_true(pcmk__sched_interning(&scheduler));
+
+    interned = pcmk__sched_intern(&scheduler, buf);
+    assert_non_null(interned);
+    assert_ptr_not_equal(interned, buf);
+    assert_string_equal(interned, "rsc1_start_0");
+    assert_ptr_equal(pcmk__sched_intern(&scheduler, "rsc1_start_0"), interned);
+
+    // Changing the original must not affect the interned copy
+    buf[0] = 'X';
+    assert_string_equal(interned, "rsc1_start_0");
+    assert_ptr_not_equal(pcmk__sched_intern(&scheduler, buf), interned);
+
+    pcmk__free_scheduler_private(scheduler.internal);
+}
+
+static void
+case_folding(void **state)
+{
+    pcmk_scheduler_t scheduler = { 0, };
+    const char *lower = NULL;
+    const char *upper = NULL;
+    const char *other = NULL;
+
+    scheduler.internal = pcmk__new_scheduler_private();
+
+    assert_null(pcmk__sched_fold(&scheduler, "node1"));
+
+    upper = pcmk__sched_intern(&scheduler, "NODE1");
+    lower = pcmk__sched_intern(&scheduler, "node1");
+    other = pcmk__sched_intern(&scheduler, "node2");
+
+    // Spelling is preserved, but strings equal ignoring case share a fold
+    assert_ptr_not_equal(lower, upper);
+    assert_string_equal(lower, "node1");
+    assert_ptr_equal(pcmk__interned_fold(lower), upper);
+    assert_ptr_equal(pcmk__interned_fold(upper), upper);
+    assert_ptr_equal(pcmk__interned_fold(other), other);
+
+    assert_ptr_equal(pcmk__sched_fold(&scheduler, "Node1"), upper);
+    assert_ptr_equal(pcmk__sched_fold(&scheduler, "node2"), other);
+    assert_null(pcmk__sched_fold(&scheduler, "node3"));
+
+    pcmk__free_scheduler_private(scheduler.internal);
+}
+
+static void
+reset(void **state)
+{
+    pcmk_scheduler_t scheduler = { 0, };
+
+    scheduler.internal = pcmk__new_scheduler_private();
+
+    assert_non_null(pcmk__sched_intern(&scheduler, "node1"));
+    assert_non_null(pcmk__sched_fold(&scheduler, "node1"));
+
+    pcmk__reset_scheduler_private(&scheduler);
+    assert_null(pcmk__sched_fold(&scheduler, "node1"));
+    assert_string_equal(pcmk__sched_intern(&scheduler, "node1"), "node1");
+
+    pcmk__free_scheduler_private(scheduler.internal);
+}
+
+PCMK__UNIT_TEST(NULL, NULL,
+                cmocka_unit_test(no_private_data),
+                cmocka_unit_test(null_string),
+                cmocka_unit_test(shared_storage),
+                cmocka_unit_test(case_folding),
+                cmocka_unit_test(reset))
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/xml.h>
+#include <crm/common/unittest_internal.h>
+#include <crm/common/xml_internal.h>
+
+#include "crmcommon_private.h"
+
+#define TEST_XML "<test id=\"a\"><!-- comment --><child id=\"b\"/></test>"
+
+static void
+assert_private_data(const xmlNode *xml, bool expected)
+{
+    xmlNode *child = pcmk__xe_first_child(xml, NULL, NULL, NULL);
+    xmlNode *comment = pcmk__xml_first_child(xml);
+
+    assert_non_null(xml->doc->_private);
+
+    if (expected) {
+        assert_non_null(xml->_private);
+        assert_non_null(xml->properties->_private);
+        assert_non_null(comment->_private);
+        assert_non_null(child->_private);
+        assert_non_null(child->properties->_private);
+
+    } else {
+        assert_null(xml->_private);
+        assert_null(xml->properties->_private);
+        assert_null(comment->_private);
+        assert_null(child->_private);
+        assert_null(child->properties->_private);
+    }
+}
+
+static void
+parsed_xml_has_none(void **state)
+{
+    xmlNode *xml = pcmk__xml_parse(TEST_XML);
+
+    assert_non_null(xml);
+    assert_private_data(xml, false);
+    free_xml(xml);
+}
+
+static void
+copy_has_none(void **state)
+{
+    xmlNode *xml = pcmk__xml_parse(TEST_XML);
+    xmlNode *copy = pcmk__xml_copy(NULL, xml);
+
+    assert_private_data(copy, false);
+    free_xml(copy);
+    free_xml(xml);
+}
+
+static void
+created_xml_has_some(void **state)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "test");
+
+    crm_xml_add(xml, PCMK_XA_ID, "a");
+    assert_non_null(xml->_private);
+    assert_non_null(xml->properties->_private);
+    free_xml(xml);
+}
+
+static void
+tracking_adds_it(void **state)
+{
+    xmlNode *xml = pcmk__xml_parse(TEST_XML);
+    xml_node_private_t *nodepriv = NULL;
+
+    xml_track_changes(xml, NULL, NULL, false);
+    assert_private_data(xml, true);
+
+    // Existing nodes are not new
+    nodepriv = xml->_private;
+    assert_int_equal(nodepriv->flags, pcmk__xf_none);
+    assert_false(xml_document_dirty(xml));
+
+    free_xml(xml);
+}
+
+static void
+add_is_idempotent(void **state)
+{
+    xmlNode *xml = pcmk__xml_parse(TEST_XML);
+    void *nodepriv = NULL;
+
+    pcmk__xml_new_private_data(xml);
+    assert_private_data(xml, true);
+
+    nodepriv = xml->_private;
+    pcmk__xml_new_private_data(xml);
+    assert_ptr_equal(xml->_private, nodepriv);
+
+    free_xml(xml);
+}
+
+static void
+replace_in_untracked_document(void **state)
+{
+    xmlNode *xml = pcmk__xml_parse(TEST_XML);
+    xmlNode *update = pcmk__xml_parse("<child id=\"b\" attr=\"x\">"
+                                      "<grandchild id=\"c\"/></child>");
+    xmlNode *child = NULL;
+
+    assert_false(xml_tracking_changes(xml));
+
+    /* The replaced child and its attributes were parsed without private data,
+     * and must get it before changes to them are marked
+     */
+    assert_int_equal(pcmk__xe_replace_match(xml, update), pcmk_rc_ok);
+
+    child = pcmk__xe_first_child(xml, "child", NULL, NULL);
+    assert_non_null(child);
+    assert_string_equal(crm_element_value(child, "attr"), "x");
+    assert_non_null(child->_private);
+    assert_non_null(pcmk__xe_first_child(child, "grandchild", NULL, NULL));
+
+    free_xml(update);
+    free_xml(xml);
+}
+
+PCMK__UNIT_TEST(pcmk__xml_test_setup_group, NULL,
+                cmocka_unit_test(parsed_xml_has_none),
+                cmocka_unit_test(copy_has_none),
+                cmocka_unit_test(created_xml_has_some),
+                cmocka_unit_test(tracking_adds_it),
+                cmocka_unit_test(add_is_idempotent),
+                cmocka_unit_test(replace_in_untracked_document))
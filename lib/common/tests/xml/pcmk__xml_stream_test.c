@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/unittest_internal.h>
+
+#include <glib.h>
+
+struct chunks {
+    GString *text;
+    int count;
+    int fail_after;
+};
+
+static int
+collect(const char *text, size_t length, void *user_data)
+{
+    struct chunks *chunks = user_data;
+
+    if (chunks->count++ == chunks->fail_after) {
+        return EIO;
+    }
+    g_string_append_len(chunks->text, text, length);
+    return pcmk_rc_ok;
+}
+
+static xmlNode *
+big_xml(void)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "test");
+
+    // Enough text to need several chunks
+    for (int i = 0; i < 10000; i++) {
+        xmlNode *child = pcmk__xe_create(xml, "child");
+
+        crm_xml_set_id(child, "child-with-a-fairly-long-name-%d", i);
+        crm_xml_add(child, "value", "<escaped & \"quoted\">");
+    }
+    return xml;
+}
+
+static void
+null_args(void **state)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "test");
+    struct chunks chunks = { NULL, 0, -1 };
+
+    assert_int_equal(pcmk__xml_stream(NULL, 0, collect, &chunks), EINVAL);
+    assert_int_equal(pcmk__xml_stream(xml, 0, NULL, &chunks), EINVAL);
+    assert_int_equal(chunks.count, 0);
+
+    free_xml(xml);
+}
+
+static void
+small_xml(void **state)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "test");
+    struct chunks chunks = { g_string_new(NULL), 0, -1 };
+
+    crm_xml_add(xml, "name", "value");
+    assert_int_equal(pcmk__xml_stream(xml, 0, collect, &chunks), pcmk_rc_ok);
+    assert_int_equal(chunks.count, 1);
+    assert_string_equal(chunks.text->str, "<test name=\"value\"/>");
+
+    g_string_free(chunks.text, TRUE);
+    free_xml(xml);
+}
+
+static void
+matches_string(void **state)
+{
+    xmlNode *xml = big_xml();
+    GString *expected = g_string_new(NULL);
+
+    for (int i = 0; i < 2; i++) {
+        uint32_t options = (i == 0)? 0 : pcmk__xml_fmt_pretty;
+        struct chunks chunks = { g_string_new(NULL), 0, -1 };
+
+        g_string_truncate(expected, 0);
+        pcmk__xml_string(xml, options, expected, 0);
+
+        assert_int_equal(pcmk__xml_stream(xml, options, collect, &chunks),
+                         pcmk_rc_ok);
+        assert_true(chunks.count > 1);
+        assert_string_equal(chunks.text->str, expected->str);
+        g_string_free(chunks.text, TRUE);
+    }
+
+    g_string_free(expected, TRUE);
+    free_xml(xml);
+}
+
+static void
+write_error(void **state)
+{
+    xmlNode *xml = big_xml();
+    struct chunks chunks = { g_string_new(NULL), 0, 1 };
+
+    // Serialization stops at the first error
+    assert_int_equal(pcmk__xml_stream(xml, 0, collect, &chunks), EIO);
+    assert_int_equal(chunks.count, 2);
+
+    g_string_free(chunks.text, TRUE);
+    free_xml(xml);
+}
+
+PCMK__UNIT_TEST(pcmk__xml_test_setup_group, NULL,
+                cmocka_unit_test(null_args),
+                cmocka_unit_test(small_xml),
+                cmocka_unit_test(matches_string),
+                cmocka_unit_test(write_error))
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU General Public License version 2
+ * or later (GPLv2+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <crm/common/unittest_internal.h>
+
+#include <glib.h>
+
+static xmlNode *
+round_trip(const xmlNode *xml)
+{
+    GString *buffer = g_string_new(NULL);
+    xmlNode *copy = NULL;
+
+    pcmk__xml_pack(xml, buffer);
+    copy = pcmk__xml_unpack(buffer->str, buffer->len);
+    g_string_free(buffer, TRUE);
+    return copy;
+}
+
+static void
+assert_same_text(const xmlNode *expected, const xmlNode *actual)
+{
+    GString *expected_s = g_string_new(NULL);
+    GString *actual_s = g_string_new(NULL);
+
+    pcmk__xml_string(expected, 0, expected_s, 0);
+    pcmk__xml_string(actual, 0, actual_s, 0);
+    assert_string_equal(actual_s->str, expected_s->str);
+
+    g_string_free(expected_s, TRUE);
+    g_string_free(actual_s, TRUE);
+}
+
+static void
+single_element(void **state)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "test");
+    xmlNode *copy = round_trip(xml);
+
+    assert_non_null(copy);
+    assert_same_text(xml, copy);
+
+    free_xml(copy);
+    free_xml(xml);
+}
+
+static void
+nested(void **state)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "test");
+    xmlNode *child = pcmk__xe_create(xml, "child");
+    xmlNode *copy = NULL;
+
+    crm_xml_add(xml, "name", "value with <special> & \"chars\"");
+    crm_xml_add(xml, "empty", "");
+    crm_xml_add(child, "long", "0123456789012345678901234567890123456789"
+                               "0123456789012345678901234567890123456789"
+                               "0123456789012345678901234567890123456789");
+    pcmk__xe_create(child, "grandchild");
+    xmlAddChild(xml, xmlNewDocComment(xml->doc, (pcmkXmlStr) "a comment"));
+    pcmk__xe_create(xml, "sibling");
+
+    copy = round_trip(xml);
+    assert_non_null(copy);
+    assert_same_text(xml, copy);
+
+    free_xml(copy);
+    free_xml(xml);
+}
+
+static void
+malformed(void **state)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "test");
+    GString *buffer = g_string_new(NULL);
+
+    crm_xml_add(xml, "name", "value");
+    pcmk__xe_create(xml, "child");
+    pcmk__xml_pack(xml, buffer);
+
+    // Every truncation is rejected
+    for (size_t len = 0; len < buffer->len; len++) {
+        assert_null(pcmk__xml_unpack(buffer->str, len));
+    }
+
+    // As is trailing garbage
+    g_string_append_c(buffer, 'x');
+    assert_null(pcmk__xml_unpack(buffer->str, buffer->len));
+    g_string_truncate(buffer, buffer->len - 1);
+
+    // And an unknown version
+    buffer->str[3]++;
+    assert_null(pcmk__xml_unpack(buffer->str, buffer->len));
+    buffer->str[3]--;
+
+    // And text that isn't packed
+    assert_null(pcmk__xml_unpack("<test/>", 7));
+
+    g_string_free(buffer, TRUE);
+    free_xml(xml);
+}
+
+static void
+too_deep(void **state)
+{
+    xmlNode *xml = pcmk__xe_create(NULL, "test");
+    xmlNode *copy = NULL;
+    xmlNode *parent = xml;
+
+    for (int i = 0; i < 300; i++) {
+        parent = pcmk__xe_create(parent, "child");
+    }
+
+    copy = round_trip(xml);
+    assert_null(copy);
+    free_xml(xml);
+}
+
+PCMK__UNIT_TEST(pcmk__xml_test_setup_group, NULL,
+                cmocka_unit_test(single_element),
+                cmocka_unit_test(nested),
+                cmocka_unit_test(malformed),
+                cmocka_unit_test(too_deep))
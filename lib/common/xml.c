@@ -254,6 +254,45 @@ free_private_data(xmlNode *node)
     }
 }
 
+/* Whether to skip allocating private data for new XML nodes other than
+ * documents (see pcmk__xml_defer_private_data())
+ */
+static bool defer_private_data = false;
+
+/*!
+ * \internal
+ * \brief Set whether private data is allocated when XML nodes are created
+ *
+ * Private data is needed only for change tracking and ACLs. Code that creates
+ * many nodes in a document that will not (yet) use either, such as a parser,
+ * can defer allocation until \c pcmk__xml_new_private_data() is called.
+ *
+ * \param[in] defer  If \c true, do not allocate private data for new XML
+ *                   nodes other than documents
+ *
+ * \return Previous setting (which the caller should restore when done)
+ */
+bool
+pcmk__xml_defer_private_data(bool defer)
+{
+    bool previous = defer_private_data;
+
+    defer_private_data = defer;
+    return previous;
+}
+
+// Allocate private data for an XML element, attribute, or comment
+static xml_node_private_t *
+alloc_node_private_data(xmlNode *node)
+{
+    xml_node_private_t *nodepriv =
+        pcmk__assert_alloc(1, sizeof(xml_node_private_t));
+
+    nodepriv->check = XML_NODE_PRIVATE_MAGIC;
+    node->_private = nodepriv;
+    return nodepriv;
+}
+
 // Allocate and initialize private data for an XML node
 static void
 new_private_data(xmlNode *node)
@@ -272,13 +311,15 @@ new_private_data(xmlNode *node)
         case XML_ELEMENT_NODE:
         case XML_ATTRIBUTE_NODE:
         case XML_COMMENT_NODE: {
-            xml_node_private_t *nodepriv =
-                pcmk__assert_alloc(1, sizeof(xml_node_private_t));
+            xml_node_private_t *nodepriv = NULL;
 
-            nodepriv->check = XML_NODE_PRIVATE_MAGIC;
+            if (defer_private_data) {
+                break;
+            }
+
+            nodepriv = alloc_node_private_data(node);
             /* Flags will be reset if necessary when tracking is enabled */
             pcmk__set_xml_flags(nodepriv, pcmk__xf_dirty|pcmk__xf_created);
-            node->_private = nodepriv;
             if (pcmk__tracking_xml_changes(node, FALSE)) {
                 /* XML_ELEMENT_NODE doesn't get picked up here, node->doc is
                  * not hooked up at the point we are called
@@ -299,9 +340,83 @@ new_private_data(xmlNode *node)
     }
 }
 
+/*!
+ * \internal
+ * \brief Add private data to any XML nodes in a tree that lack it
+ *
+ * \param[in,out] xml        XML node to check
+ * \param[in]     user_data  Ignored
+ *
+ * \return \c true (to continue traversing the tree)
+ *
+ * \note This is compatible with \c pcmk__xml_tree_foreach().
+ */
+static bool
+add_missing_private_data(xmlNode *xml, void *user_data)
+{
+    if ((xml->type != XML_ELEMENT_NODE) && (xml->type != XML_COMMENT_NODE)) {
+        return true;
+    }
+
+    if (xml->_private == NULL) {
+        alloc_node_private_data(xml);
+    }
+
+    // Attributes are not visited by pcmk__xml_tree_foreach()
+    for (xmlAttr *attr = pcmk__xe_first_attr(xml); attr != NULL;
+         attr = attr->next) {
+
+        if (attr->_private == NULL) {
+            alloc_node_private_data((xmlNode *) attr);
+        }
+    }
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Ensure that every node in an XML document has private data
+ *
+ * Nodes created while private data allocation was deferred get private data
+ * with no flags set, as if changes to them had already been accepted.
+ *
+ * \param[in,out] xml  Any node in the XML document to check
+ *
+ * \note This must be called before change tracking or ACLs are enabled for
+ *       a document.
+ * \note If \p xml has been unlinked from its document (for example, by
+ *       \c xmlReplaceNode()), the subtree it belongs to is checked as well.
+ */
+void
+pcmk__xml_new_private_data(xmlNode *xml)
+{
+    xmlNode *top = xml;
+    xmlNode *root = NULL;
+
+    if (xml == NULL) {
+        return;
+    }
+
+    // Find the top of the subtree containing xml
+    while ((top->parent != NULL) && (top->parent->type != XML_DOCUMENT_NODE)) {
+        top = top->parent;
+    }
+
+    if (xml->doc != NULL) {
+        root = xmlDocGetRootElement(xml->doc);
+        if (root != NULL) {
+            pcmk__xml_tree_foreach(root, add_missing_private_data, NULL);
+        }
+    }
+    if ((top != root) && (top->type == XML_ELEMENT_NODE)) {
+        pcmk__xml_tree_foreach(top, add_missing_private_data, NULL);
+    }
+}
+
 void
 xml_track_changes(xmlNode * xml, const char *user, xmlNode *acl_source, bool enforce_acls) 
 {
+    pcmk__xml_new_private_data(xml);
     xml_accept_changes(xml);
     crm_trace("Tracking changes%s to %p", enforce_acls?" with ACLs":"", xml);
     pcmk__set_xml_doc_flag(xml, pcmk__xf_tracking);
@@ -346,7 +461,8 @@ pcmk__xml_position(const xmlNode *xml, enum xml_private_flags ignore_if_set)
     for (const xmlNode *cIter = xml; cIter->prev; cIter = cIter->prev) {
         xml_node_private_t *nodepriv = ((xmlNode*)cIter->prev)->_private;
 
-        if (!pcmk_is_set(nodepriv->flags, ignore_if_set)) {
+        if ((nodepriv == NULL)
+            || !pcmk_is_set(nodepriv->flags, ignore_if_set)) {
             position++;
         }
     }
@@ -883,11 +999,20 @@ xmlNode *
 pcmk__xml_copy(xmlNode *parent, xmlNode *src)
 {
     xmlNode *copy = NULL;
+    bool needs_private = false;
+    bool deferred = false;
 
     if (src == NULL) {
         return NULL;
     }
 
+    /* Private data is needed only if the copy's document is tracking changes
+     * or enforcing ACLs. Otherwise, it will be added if and when needed.
+     */
+    needs_private = pcmk__tracking_xml_changes(parent, false)
+                    || xml_acl_enabled(parent);
+    deferred = pcmk__xml_defer_private_data(!needs_private);
+
     if (parent == NULL) {
         xmlDoc *doc = NULL;
 
@@ -908,6 +1033,7 @@ pcmk__xml_copy(xmlNode *parent, xmlNode *src)
 
         xmlAddChild(parent, copy);
     }
+    pcmk__xml_defer_private_data(deferred);
 
     pcmk__xml_mark_created(copy);
     return copy;
@@ -1558,6 +1684,9 @@ xml_calculate_changes(xmlNode *old_xml, xmlNode *new_xml)
         xml_track_changes(new_xml, NULL, NULL, FALSE);
     }
 
+    // Flags may be set on old_xml, so it needs private data too
+    pcmk__xml_new_private_data(old_xml);
+
     mark_xml_changes(old_xml, new_xml, FALSE);
 }
 
@@ -1590,7 +1719,8 @@ pcmk__xc_match(const xmlNode *root, const xmlNode *search_comment, bool exact)
                 return NULL;
             }
 
-            if (pcmk_is_set(nodepriv->flags, pcmk__xf_skip)) {
+            if ((nodepriv != NULL)
+                && pcmk_is_set(nodepriv->flags, pcmk__xf_skip)) {
                 continue;
             }
         }
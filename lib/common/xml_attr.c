@@ -44,6 +44,10 @@ pcmk__marked_as_deleted(xmlAttrPtr a, void *user_data)
 {
     xml_node_private_t *nodepriv = a->_private;
 
+    if (nodepriv == NULL) {
+        // Change tracking has never been enabled for this attribute
+        return false;
+    }
     if (pcmk_is_set(nodepriv->flags, pcmk__xf_deleted)) {
         return true;
     }
@@ -111,7 +111,8 @@ show_xml_element(pcmk__output_t *out, GString *buffer, const char *prefix,
             const char *p_value = pcmk__xml_attr_value(attr);
             gchar *p_copy = NULL;
 
-            if (pcmk_is_set(nodepriv->flags, pcmk__xf_deleted)) {
+            if ((nodepriv != NULL)
+                && pcmk_is_set(nodepriv->flags, pcmk__xf_deleted)) {
                 continue;
             }
 
@@ -273,6 +274,11 @@ show_xml_changes_recursive(pcmk__output_t *out, const xmlNode *data, int depth,
     int rc = pcmk_rc_no_output;
     int temp_rc = pcmk_rc_no_output;
 
+    if (nodepriv == NULL) {
+        // Change tracking has never been enabled for this node
+        return rc;
+    }
+
     if (pcmk_all_flags_set(nodepriv->flags, pcmk__xf_dirty|pcmk__xf_created)) {
         // Newly created
         return pcmk__xml_show(out, PCMK__XML_PREFIX_CREATED, data, depth,
@@ -303,7 +309,10 @@ show_xml_changes_recursive(pcmk__output_t *out, const xmlNode *data, int depth,
 
             nodepriv = attr->_private;
 
-            if (pcmk_is_set(nodepriv->flags, pcmk__xf_deleted)) {
+            if (nodepriv == NULL) {
+                continue;
+
+            } else if (pcmk_is_set(nodepriv->flags, pcmk__xf_deleted)) {
                 const char *value = pcmk__xml_attr_value(attr);
 
                 temp_rc = out->info(out, "%s %*s @%s=%s",
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
+#include <unistd.h>                     // ftruncate()
 
 #include <bzlib.h>
 #include <libxml/parser.h>
@@ -170,6 +171,7 @@ pcmk__xml_read(const char *filename)
     xmlDoc *output = NULL;
     xmlParserCtxt *ctxt = NULL;
     const xmlError *last_error = NULL;
+    bool deferred = false;
 
     // Create a parser context
     ctxt = xmlNewParserCtxt();
@@ -178,6 +180,9 @@ pcmk__xml_read(const char *filename)
     xmlCtxtResetLastError(ctxt);
     xmlSetGenericErrorFunc(ctxt, pcmk__log_xmllib_err);
 
+    // Most parsed XML is only read, so add private data only when needed
+    deferred = pcmk__xml_defer_private_data(true);
+
     if (use_stdin) {
         /* @COMPAT After dropping XML_PARSE_RECOVER, we can avoid capturing
          * stdin into a buffer and instead call
@@ -206,6 +211,8 @@ pcmk__xml_read(const char *filename)
         parse_xml_recover(&output, xmlCtxtReadFile, ctxt, filename, NULL);
     }
 
+    pcmk__xml_defer_private_data(deferred);
+
     if (output != NULL) {
         xml = xmlDocGetRootElement(output);
         if (xml != NULL) {
@@ -247,6 +254,7 @@ pcmk__xml_parse(const char *input)
     xmlDoc *output = NULL;
     xmlParserCtxt *ctxt = NULL;
     const xmlError *last_error = NULL;
+    bool deferred = false;
 
     if (input == NULL) {
         return NULL;
@@ -260,8 +268,11 @@ pcmk__xml_parse(const char *input)
     xmlCtxtResetLastError(ctxt);
     xmlSetGenericErrorFunc(ctxt, pcmk__log_xmllib_err);
 
+    // Most parsed XML is only read, so add private data only when needed
+    deferred = pcmk__xml_defer_private_data(true);
     parse_xml_recover(&output, xmlCtxtReadDoc, ctxt, (pcmkXmlStr) input, NULL,
                       NULL);
+    pcmk__xml_defer_private_data(deferred);
 
     if (output != NULL) {
         xml = xmlDocGetRootElement(output);
@@ -279,22 +290,57 @@ pcmk__xml_parse(const char *input)
     return xml;
 }
 
+// Amount of text to buffer before handing it to a stream's writer
+#define XML_STREAM_CHUNK_SIZE (64 * 1024)
+
+// Destination for XML text
+struct xml_output {
+    GString *buffer;                // Text not yet written
+    pcmk__xml_write_fn write_fn;    // If NULL, keep all text in buffer
+    void *user_data;                // Argument for write_fn
+    int rc;                         // Result of last write
+};
+
+/*!
+ * \internal
+ * \brief Hand buffered XML text to a stream's writer, if appropriate
+ *
+ * \param[in,out] out    XML output
+ * \param[in]     force  If \c false, write only once a full chunk is buffered
+ */
+static void
+flush_xml_output(struct xml_output *out, bool force)
+{
+    if ((out->write_fn == NULL) || (out->rc != pcmk_rc_ok)
+        || (out->buffer->len == 0)
+        || (!force && (out->buffer->len < XML_STREAM_CHUNK_SIZE))) {
+        return;
+    }
+    out->rc = out->write_fn(out->buffer->str, out->buffer->len,
+                            out->user_data);
+    g_string_truncate(out->buffer, 0);
+}
+
+static void dump_xml(const xmlNode *data, uint32_t options,
+                     struct xml_output *out, int depth);
+
 /*!
  * \internal
- * \brief Append a string representation of an XML element to a buffer
+ * \brief Append a string representation of an XML element to an output
  *
  * \param[in]     data     XML whose representation to append
  * \param[in]     options  Group of \p pcmk__xml_fmt_options flags
- * \param[in,out] buffer   Where to append the content (must not be \p NULL)
+ * \param[in,out] out      Where to append the content
  * \param[in]     depth    Current indentation level
  */
 static void
-dump_xml_element(const xmlNode *data, uint32_t options, GString *buffer,
+dump_xml_element(const xmlNode *data, uint32_t options, struct xml_output *out,
                  int depth)
 {
     bool pretty = pcmk_is_set(options, pcmk__xml_fmt_pretty);
     bool filtered = pcmk_is_set(options, pcmk__xml_fmt_filtered);
     int spaces = pretty? (2 * depth) : 0;
+    GString *buffer = out->buffer;
 
     for (int lpc = 0; lpc < spaces; lpc++) {
         g_string_append_c(buffer, ' ');
@@ -322,9 +368,11 @@ dump_xml_element(const xmlNode *data, uint32_t options, GString *buffer,
     }
 
     if (data->children) {
-        for (const xmlNode *child = data->children; child != NULL;
+        for (const xmlNode *child = data->children;
+             (child != NULL) && (out->rc == pcmk_rc_ok);
              child = child->next) {
-            pcmk__xml_string(child, options, buffer, depth + 1);
+            dump_xml(child, options, out, depth + 1);
+            flush_xml_output(out, false);
         }
 
         for (int lpc = 0; lpc < spaces; lpc++) {
@@ -469,6 +517,42 @@ xml_element_type_text(xmlElementType type)
     return element_type_names[type];
 }
 
+/*!
+ * \internal
+ * \brief Append a string representation of an XML object to an output
+ *
+ * \param[in]     data     XML to convert
+ * \param[in]     options  Group of \p pcmk__xml_fmt_options flags
+ * \param[in,out] out      Where to append the text
+ * \param[in]     depth    Current indentation level
+ */
+static void
+dump_xml(const xmlNode *data, uint32_t options, struct xml_output *out,
+         int depth)
+{
+    switch(data->type) {
+        case XML_ELEMENT_NODE:
+            /* Handle below */
+            dump_xml_element(data, options, out, depth);
+            break;
+        case XML_TEXT_NODE:
+            if (pcmk_is_set(options, pcmk__xml_fmt_text)) {
+                dump_xml_text(data, options, out->buffer, depth);
+            }
+            break;
+        case XML_COMMENT_NODE:
+            dump_xml_comment(data, options, out->buffer, depth);
+            break;
+        case XML_CDATA_SECTION_NODE:
+            dump_xml_cdata(data, options, out->buffer, depth);
+            break;
+        default:
+            crm_warn("Cannot convert XML %s node to text " CRM_XS " type=%d",
+                     xml_element_type_text(data->type), data->type);
+            break;
+    }
+}
+
 /*!
  * \internal
  * \brief Create a string representation of an XML object
@@ -488,6 +572,8 @@ void
 pcmk__xml_string(const xmlNode *data, uint32_t options, GString *buffer,
                  int depth)
 {
+    struct xml_output out = { buffer, NULL, NULL, pcmk_rc_ok };
+
     if (data == NULL) {
         crm_trace("Nothing to dump");
         return;
@@ -496,83 +582,148 @@ pcmk__xml_string(const xmlNode *data, uint32_t options, GString *buffer,
     CRM_ASSERT(buffer != NULL);
     CRM_CHECK(depth >= 0, depth = 0);
 
-    switch(data->type) {
-        case XML_ELEMENT_NODE:
-            /* Handle below */
-            dump_xml_element(data, options, buffer, depth);
-            break;
-        case XML_TEXT_NODE:
-            if (pcmk_is_set(options, pcmk__xml_fmt_text)) {
-                dump_xml_text(data, options, buffer, depth);
-            }
-            break;
-        case XML_COMMENT_NODE:
-            dump_xml_comment(data, options, buffer, depth);
-            break;
-        case XML_CDATA_SECTION_NODE:
-            dump_xml_cdata(data, options, buffer, depth);
-            break;
-        default:
-            crm_warn("Cannot convert XML %s node to text " CRM_XS " type=%d",
-                     xml_element_type_text(data->type), data->type);
-            break;
+    dump_xml(data, options, &out, depth);
+}
+
+/*!
+ * \internal
+ * \brief Serialize XML a piece at a time
+ *
+ * This produces the same text as \c pcmk__xml_string(), but instead of building
+ * the whole document in memory, it passes the text to a caller-supplied
+ * function in chunks of roughly \c XML_STREAM_CHUNK_SIZE bytes as it goes.
+ * The chunks are not nul-terminated and are valid only during the call.
+ *
+ * \param[in]     xml        XML to serialize
+ * \param[in]     options    Group of \p pcmk__xml_fmt_options flags
+ * \param[in]     write_fn   Function to call with each chunk of text, which
+ *                           should return a standard Pacemaker return code
+ * \param[in,out] user_data  Argument to pass to \p write_fn
+ *
+ * \return Standard Pacemaker return code (the first error returned by
+ *         \p write_fn, which stops serialization)
+ */
+int
+pcmk__xml_stream(const xmlNode *xml, uint32_t options,
+                 pcmk__xml_write_fn write_fn, void *user_data)
+{
+    struct xml_output out = { NULL, write_fn, user_data, pcmk_rc_ok };
+
+    CRM_CHECK((xml != NULL) && (write_fn != NULL), return EINVAL);
+
+    out.buffer = g_string_sized_new(XML_STREAM_CHUNK_SIZE + 1024);
+    dump_xml(xml, options, &out, 0);
+    flush_xml_output(&out, true);
+    g_string_free(out.buffer, TRUE);
+    return out.rc;
+}
+
+// XML file being written a chunk at a time
+struct xml_file {
+    const char *filename;   // For logging only
+    FILE *stream;           // Open file stream
+    BZFILE *bz_file;        // Compressor on stream (or NULL if uncompressed)
+    unsigned int bytes_in;  // Uncompressed bytes written so far
+};
+
+/*!
+ * \internal
+ * \brief Write a chunk of XML text to a file (\c pcmk__xml_write_fn)
+ *
+ * \param[in]     text       Text to write
+ * \param[in]     length     Number of bytes of \p text to write
+ * \param[in,out] user_data  File to write to (<tt>struct xml_file *</tt>)
+ *
+ * \return Standard Pacemaker return code
+ */
+static int
+write_xml_chunk(const char *text, size_t length, void *user_data)
+{
+    struct xml_file *file = user_data;
+
+    if (file->bz_file != NULL) {
+        int rc = BZ_OK;
+
+        // bzip2 doesn't modify its input, despite the lack of const
+        BZ2_bzWrite(&rc, file->bz_file, (void *) text, (int) length);
+        rc = pcmk__bzlib2rc(rc);
+        if (rc != pcmk_rc_ok) {
+            crm_warn("Could not compress data for %s: %s "
+                     CRM_XS " rc=%d errno=%d",
+                     file->filename, pcmk_rc_str(rc), rc, errno);
+            return rc;
+        }
+
+    } else if (fwrite(text, 1, length, file->stream) < length) {
+        return (errno != 0)? errno : EIO;
     }
+    file->bytes_in += (unsigned int) length;
+    return pcmk_rc_ok;
 }
 
 /*!
  * \internal
- * \brief Write a string to a file stream, compressed using \c bzip2
+ * \brief Write XML to a file stream, compressed using \c bzip2
  *
- * \param[in]     text       String to write
- * \param[in]     filename   Name of file being written (for logging only)
- * \param[in,out] stream     Open file stream to write to
+ * \param[in]     xml        XML to write
+ * \param[in,out] file       File to write to
  * \param[out]    bytes_out  Number of bytes written (valid only on success)
  *
  * \return Standard Pacemaker return code
+ *
+ * \note On error, nothing has been written to the stream, or the stream has
+ *       been truncated back to empty, so the caller can write it uncompressed.
  */
 static int
-write_compressed_stream(char *text, const char *filename, FILE *stream,
+write_compressed_stream(const xmlNode *xml, struct xml_file *file,
                         unsigned int *bytes_out)
 {
-    unsigned int bytes_in = 0;
     int rc = pcmk_rc_ok;
 
     // (5, 0, 0): (intermediate block size, silent, default workFactor)
-    BZFILE *bz_file = BZ2_bzWriteOpen(&rc, stream, 5, 0, 0);
+    file->bz_file = BZ2_bzWriteOpen(&rc, file->stream, 5, 0, 0);
 
     rc = pcmk__bzlib2rc(rc);
     if (rc != pcmk_rc_ok) {
         crm_warn("Not compressing %s: could not prepare file stream: %s "
                  CRM_XS " rc=%d",
-                 filename, pcmk_rc_str(rc), rc);
-        goto done;
+                 file->filename, pcmk_rc_str(rc), rc);
+        file->bz_file = NULL;
+        return rc;
     }
 
-    BZ2_bzWrite(&rc, bz_file, text, strlen(text));
-    rc = pcmk__bzlib2rc(rc);
+    rc = pcmk__xml_stream(xml, pcmk__xml_fmt_pretty, write_xml_chunk, file);
     if (rc != pcmk_rc_ok) {
-        crm_warn("Not compressing %s: could not compress data: %s "
-                 CRM_XS " rc=%d errno=%d",
-                 filename, pcmk_rc_str(rc), rc, errno);
         goto done;
     }
 
-    BZ2_bzWriteClose(&rc, bz_file, 0, &bytes_in, bytes_out);
-    bz_file = NULL;
+    BZ2_bzWriteClose(&rc, file->bz_file, 0, NULL, bytes_out);
+    file->bz_file = NULL;
     rc = pcmk__bzlib2rc(rc);
     if (rc != pcmk_rc_ok) {
         crm_warn("Not compressing %s: could not write compressed data: %s "
                  CRM_XS " rc=%d errno=%d",
-                 filename, pcmk_rc_str(rc), rc, errno);
+                 file->filename, pcmk_rc_str(rc), rc, errno);
         goto done;
     }
 
     crm_trace("Compressed XML for %s from %u bytes to %u",
-              filename, bytes_in, *bytes_out);
+              file->filename, file->bytes_in, *bytes_out);
 
 done:
-    if (bz_file != NULL) {
-        BZ2_bzWriteClose(&rc, bz_file, 0, NULL, NULL);
+    if (file->bz_file != NULL) {
+        int close_rc = BZ_OK;
+
+        BZ2_bzWriteClose(&close_rc, file->bz_file, 1, NULL, NULL);
+        file->bz_file = NULL;
+    }
+    if (rc != pcmk_rc_ok) {
+        // Discard any partial output so the caller can start over
+        rewind(file->stream);
+        if (ftruncate(fileno(file->stream), 0) < 0) {
+            crm_perror(LOG_ERR, "truncating %s", file->filename);
+        }
+        file->bytes_in = 0;
     }
     return rc;
 }
@@ -581,6 +732,9 @@ done:
  * \internal
  * \brief Write XML to a file stream
  *
+ * The XML is serialized a chunk at a time straight into the stream (or its
+ * compressor), so the full text is never held in memory.
+ *
  * \param[in]     xml       XML to write
  * \param[in]     filename  Name of file being written (for logging only)
  * \param[in,out] stream    Open file stream corresponding to filename (closed
@@ -595,32 +749,27 @@ write_xml_stream(const xmlNode *xml, const char *filename, FILE *stream,
                  bool compress, unsigned int *nbytes)
 {
     // @COMPAT Drop nbytes as arg when we drop write_xml_fd()/write_xml_file()
-    GString *buffer = g_string_sized_new(1024);
+    struct xml_file file = { filename, stream, NULL, 0 };
     unsigned int bytes_out = 0;
     int rc = pcmk_rc_ok;
 
-    pcmk__xml_string(xml, pcmk__xml_fmt_pretty, buffer, 0);
-    CRM_CHECK(!pcmk__str_empty(buffer->str),
-              crm_log_xml_info(xml, "dump-failed");
-              rc = pcmk_rc_error;
-              goto done);
-
     crm_log_xml_trace(xml, "writing");
 
     if (compress
-        && (write_compressed_stream(buffer->str, filename, stream,
-                                    &bytes_out) == pcmk_rc_ok)) {
+        && (write_compressed_stream(xml, &file, &bytes_out) == pcmk_rc_ok)) {
         goto done;
     }
 
-    rc = fprintf(stream, "%s", buffer->str);
-    if (rc < 0) {
-        rc = EIO;
-        crm_perror(LOG_ERR, "writing %s", filename);
+    rc = pcmk__xml_stream(xml, pcmk__xml_fmt_pretty, write_xml_chunk, &file);
+    if (rc != pcmk_rc_ok) {
+        crm_err("Could not write %s: %s", filename, pcmk_rc_str(rc));
         goto done;
     }
-    bytes_out = (unsigned int) rc;
-    rc = pcmk_rc_ok;
+    CRM_CHECK(file.bytes_in > 0,
+              crm_log_xml_info(xml, "dump-failed");
+              rc = pcmk_rc_error;
+              goto done);
+    bytes_out = file.bytes_in;
 
 done:
     if (fflush(stream) != 0) {
@@ -640,7 +789,6 @@ done:
     if (nbytes != NULL) {
         *nbytes = bytes_out;
     }
-    g_string_free(buffer, TRUE);
     return rc;
 }
 
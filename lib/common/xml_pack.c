@@ -0,0 +1,322 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU Lesser General Public License
+ * version 2.1 or later (LGPLv2.1+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <glib.h>
+#include <libxml/tree.h>
+
+#include <crm/crm.h>
+#include <crm/common/xml.h>
+#include "crmcommon_private.h"
+
+/* Compact XML encoding for messages between Pacemaker processes
+ *
+ * The encoding mirrors the in-memory tree, so it can be rebuilt without any
+ * text parsing or entity handling:
+ *
+ *     message   = magic node
+ *     magic     = "PXB" version-byte
+ *     node      = 'e' string attribute* end node* end    ; element
+ *               | 'c' string                             ; comment
+ *               | 'd' string                             ; CDATA section
+ *     attribute = string string                          ; name, value
+ *     string    = length bytes NUL                       ; length excludes NUL
+ *     end       = 0x00
+ *
+ * Lengths are unsigned LEB128 varints. An attribute list ends with a
+ * zero-length name. Strings are NUL-terminated in the encoding so that the
+ * decoder can hand them to libxml2 in place, without copying.
+ *
+ * As with pcmk__xml_string() without pcmk__xml_fmt_text, text nodes are not
+ * encoded.
+ */
+
+#define PACK_MAGIC      "PXB"
+#define PACK_VERSION    1
+
+// Same as libxml2's default maximum nesting depth
+#define PACK_MAX_DEPTH  256
+
+#define PACK_ELEMENT    'e'
+#define PACK_COMMENT    'c'
+#define PACK_CDATA      'd'
+#define PACK_END        '\0'
+
+static void
+pack_length(size_t length, GString *buffer)
+{
+    do {
+        guchar byte = length & 0x7F;
+
+        length >>= 7;
+        if (length > 0) {
+            byte |= 0x80;
+        }
+        g_string_append_c(buffer, (gchar) byte);
+    } while (length > 0);
+}
+
+static void
+pack_string(const char *s, GString *buffer)
+{
+    size_t length = strlen(s);
+
+    pack_length(length, buffer);
+    g_string_append_len(buffer, s, length + 1); // Including terminator
+}
+
+static void
+pack_node(const xmlNode *xml, GString *buffer)
+{
+    switch (xml->type) {
+        case XML_ELEMENT_NODE:
+            g_string_append_c(buffer, PACK_ELEMENT);
+            pack_string((const char *) xml->name, buffer);
+
+            for (const xmlAttr *attr = pcmk__xe_first_attr(xml); attr != NULL;
+                 attr = attr->next) {
+
+                pack_string((const char *) attr->name, buffer);
+                pack_string(pcmk__xml_attr_value(attr), buffer);
+            }
+            pack_length(0, buffer);
+            g_string_append_c(buffer, PACK_END);
+
+            for (const xmlNode *child = xml->children; child != NULL;
+                 child = child->next) {
+                pack_node(child, buffer);
+            }
+            g_string_append_c(buffer, PACK_END);
+            break;
+
+        case XML_COMMENT_NODE:
+            g_string_append_c(buffer, PACK_COMMENT);
+            pack_string((const char *) xml->content, buffer);
+            break;
+
+        case XML_CDATA_SECTION_NODE:
+            g_string_append_c(buffer, PACK_CDATA);
+            pack_string((const char *) xml->content, buffer);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Append the compact encoding of XML to a buffer
+ *
+ * \param[in]     xml     XML to encode
+ * \param[in,out] buffer  Where to append the encoding
+ *
+ * \note The encoding is meant only for messages between Pacemaker processes on
+ *       the same host that have agreed to use it. Use \c pcmk__xml_unpack() to
+ *       decode it.
+ */
+void
+pcmk__xml_pack(const xmlNode *xml, GString *buffer)
+{
+    CRM_CHECK((xml != NULL) && (buffer != NULL), return);
+
+    g_string_append(buffer, PACK_MAGIC);
+    g_string_append_c(buffer, PACK_VERSION);
+    pack_node(xml, buffer);
+}
+
+// Position in an encoded message being decoded
+struct unpack_input {
+    const char *data;
+    size_t length;
+    size_t pos;
+};
+
+static bool
+unpack_byte(struct unpack_input *in, char *byte)
+{
+    if (in->pos >= in->length) {
+        return false;
+    }
+    *byte = in->data[in->pos++];
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Get the next string from an encoded message
+ *
+ * \param[in,out] in  Encoded message
+ *
+ * \return Pointer to string within message, or NULL if malformed
+ */
+static const char *
+unpack_string(struct unpack_input *in)
+{
+    size_t length = 0;
+    const char *s = NULL;
+
+    for (int shift = 0; ; shift += 7) {
+        char byte = 0;
+
+        if ((shift > 28) || !unpack_byte(in, &byte)) {
+            return NULL;
+        }
+        length |= ((size_t) (byte & 0x7F)) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+    }
+
+    // The string must fit, be terminated, and not contain a terminator
+    if ((length >= (in->length - in->pos))
+        || (in->data[in->pos + length] != '\0')
+        || (memchr(in->data + in->pos, '\0', length) != NULL)) {
+        return NULL;
+    }
+    s = in->data + in->pos;
+    in->pos += length + 1;
+    return s;
+}
+
+static bool
+unpack_node(struct unpack_input *in, xmlNode *parent, xmlNode **result,
+            int depth)
+{
+    char type = PACK_END;
+    const char *s = NULL;
+    xmlNode *node = NULL;
+
+    if ((depth > PACK_MAX_DEPTH) || !unpack_byte(in, &type)) {
+        return false;
+    }
+
+    switch (type) {
+        case PACK_ELEMENT:
+            s = unpack_string(in);
+            if (pcmk__str_empty(s)) {
+                return false;
+            }
+            node = pcmk__xe_create(parent, s);
+
+            while (true) {
+                const char *name = unpack_string(in);
+                const char *value = NULL;
+
+                if (name == NULL) {
+                    goto error;
+                }
+                if (*name == '\0') {
+                    break;
+                }
+                value = unpack_string(in);
+                if (value == NULL) {
+                    goto error;
+                }
+                crm_xml_add(node, name, value);
+            }
+            if (!unpack_byte(in, &type) || (type != PACK_END)) {
+                goto error;
+            }
+
+            while (true) {
+                if (in->pos >= in->length) {
+                    goto error;
+                }
+                if (in->data[in->pos] == PACK_END) {
+                    in->pos++;
+                    break;
+                }
+                if (!unpack_node(in, node, NULL, depth + 1)) {
+                    goto error;
+                }
+            }
+            break;
+
+        case PACK_COMMENT:
+        case PACK_CDATA:
+            s = unpack_string(in);
+            if ((s == NULL) || (parent == NULL)) {
+                return false;
+            }
+            if (type == PACK_COMMENT) {
+                node = xmlNewDocComment(parent->doc, (pcmkXmlStr) s);
+            } else {
+                node = xmlNewCDataBlock(parent->doc, (pcmkXmlStr) s,
+                                        (int) strlen(s));
+            }
+            pcmk__mem_assert(node);
+            xmlAddChild(parent, node);
+            break;
+
+        default:
+            return false;
+    }
+
+    if (result != NULL) {
+        *result = node;
+    }
+    return true;
+
+error:
+    if (parent == NULL) {
+        free_xml(node);
+    }
+    // Otherwise, the caller will free the partial tree via the root
+    return false;
+}
+
+/*!
+ * \internal
+ * \brief Rebuild XML from its compact encoding
+ *
+ * \param[in] data    Encoded XML (as created by \c pcmk__xml_pack())
+ * \param[in] length  Number of bytes in \p data
+ *
+ * \return Newly allocated XML (or NULL if \p data is not a valid encoding)
+ *
+ * \note The caller is responsible for freeing the result using \c free_xml().
+ */
+xmlNode *
+pcmk__xml_unpack(const char *data, size_t length)
+{
+    struct unpack_input in = { data, length, 0 };
+    xmlNode *xml = NULL;
+    bool deferred = false;
+    bool ok = false;
+
+    CRM_CHECK(data != NULL, return NULL);
+
+    if ((length < sizeof(PACK_MAGIC))
+        || (memcmp(data, PACK_MAGIC, sizeof(PACK_MAGIC) - 1) != 0)
+        || (data[sizeof(PACK_MAGIC) - 1] != PACK_VERSION)) {
+        crm_err("Ignoring message with unrecognized compact XML encoding");
+        return NULL;
+    }
+    in.pos = sizeof(PACK_MAGIC);
+
+    // As when parsing text, add private data only when needed
+    deferred = pcmk__xml_defer_private_data(true);
+    ok = unpack_node(&in, NULL, &xml, 0);
+    pcmk__xml_defer_private_data(deferred);
+
+    if (!ok || (in.pos != in.length)
+        || (xml == NULL) || (xml->type != XML_ELEMENT_NODE)) {
+
+        crm_err("Ignoring malformed compactly encoded XML message "
+                CRM_XS " offset=%llu", (unsigned long long) in.pos);
+        free_xml(xml);
+        return NULL;
+    }
+    return xml;
+}
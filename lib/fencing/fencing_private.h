@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2021 the Pacemaker project contributors
+ * Copyright 2018-2024 the Pacemaker project contributors
  *
  * The version control history for this file may have further details.
  *
@@ -18,6 +18,9 @@ int stonith__execute(stonith_action_t *action);
 G_GNUC_INTERNAL
 int stonith__list_rhcs_agents(stonith_key_value_t **devices);
 
+G_GNUC_INTERNAL
+char *stonith__rhcs_agent_path(const char *agent);
+
 G_GNUC_INTERNAL
 int stonith__rhcs_metadata(const char *agent, int timeout, char **output);
 
@@ -2440,6 +2440,45 @@ stonith__device_parameter_flags(uint32_t *device_flags, const char *device_name,
     freeXpathObject(xpath);
 }
 
+struct metadata_async_data {
+    char *agent;
+    char *agent_path;
+    void (*callback)(int pid, const pcmk__action_result_t *result,
+                     void *user_data);
+    void *user_data;
+};
+
+static void
+free_metadata_async_data(struct metadata_async_data *data)
+{
+    free(data->agent);
+    free(data->agent_path);
+    free(data);
+}
+
+/*!
+ * \internal
+ * \brief Cache fence agent meta-data, then pass it to the original callback
+ *
+ * \param[in]     pid        Process ID of agent
+ * \param[in]     result     Result of meta-data action
+ * \param[in,out] user_data  Asynchronous meta-data request data
+ */
+static void
+metadata_async_done(int pid, const pcmk__action_result_t *result,
+                    void *user_data)
+{
+    struct metadata_async_data *data = user_data;
+
+    if (pcmk__result_ok(result)) {
+        pcmk__cache_agent_metadata(PCMK_RESOURCE_CLASS_STONITH, NULL,
+                                   data->agent, data->agent_path,
+                                   result->action_stdout);
+    }
+    data->callback(pid, result, data->user_data);
+    free_metadata_async_data(data);
+}
+
 /*!
  * \internal
  * \brief Retrieve fence agent meta-data asynchronously
@@ -2470,16 +2509,42 @@ stonith__metadata_async(const char *agent, int timeout_sec,
         case st_namespace_rhcs:
             {
                 stonith_action_t *action = NULL;
+                struct metadata_async_data *data = NULL;
+                pcmk__action_result_t result = PCMK__UNKNOWN_RESULT;
+                char *agent_path = stonith__rhcs_agent_path(agent);
+                char *output = NULL;
                 int rc = pcmk_ok;
 
+                // Like LHA meta-data, a cached copy is returned immediately
+                if (pcmk__cached_agent_metadata(PCMK_RESOURCE_CLASS_STONITH,
+                                                NULL, agent, agent_path,
+                                                &output) == pcmk_rc_ok) {
+                    pcmk__set_result(&result, CRM_EX_OK, PCMK_EXEC_DONE,
+                                     NULL);
+                    pcmk__set_result_output(&result, output, NULL);
+                    callback(0, &result, user_data);
+                    pcmk__reset_result(&result);
+                    free(agent_path);
+                    return pcmk_rc_ok;
+                }
+
+                data = pcmk__assert_alloc(1,
+                                          sizeof(struct metadata_async_data));
+                data->agent = pcmk__str_copy(agent);
+                data->agent_path = agent_path;
+                data->callback = callback;
+                data->user_data = user_data;
+
                 action = stonith__action_create(agent, PCMK_ACTION_METADATA,
                                                 NULL, 0, timeout_sec, NULL,
                                                 NULL, NULL);
 
-                rc = stonith__execute_async(action, user_data, callback, NULL);
+                rc = stonith__execute_async(action, data, metadata_async_done,
+                                            NULL);
                 if (rc != pcmk_ok) {
                     callback(0, stonith__action_result(action), user_data);
                     stonith__destroy_action(action);
+                    free_metadata_async_data(data);
                 }
                 return pcmk_legacy2rc(rc);
             }
@@ -114,59 +114,103 @@ stonith_rhcs_parameter_not_required(xmlNode *metadata, const char *parameter)
 }
 
 /*!
- * \brief Execute RHCS-compatible agent's metadata action
+ * \internal
+ * \brief Get the full path of an RHCS-compatible fence agent
+ *
+ * \param[in] agent  Agent name
+ *
+ * \return Newly allocated path to agent executable
+ */
+char *
+stonith__rhcs_agent_path(const char *agent)
+{
+    return crm_strdup_printf(PCMK__FENCE_BINDIR "/%s", agent);
+}
+
+/*!
+ * \internal
+ * \brief Get RHCS-compatible agent's raw meta-data, from cache if possible
  *
  * \param[in]  agent        Agent to execute
  * \param[in]  timeout_sec  Action timeout
- * \param[out] metadata     Where to store output xmlNode (or NULL to ignore)
+ * \param[out] output       Where to store agent output (on success)
+ *
+ * \return Legacy Pacemaker return code
  */
 static int
-stonith__rhcs_get_metadata(const char *agent, int timeout_sec,
-                           xmlNode **metadata)
+rhcs_metadata_output(const char *agent, int timeout_sec, char **output)
 {
-    xmlNode *xml = NULL;
-    xmlNode *actions = NULL;
-    xmlXPathObject *xpathObj = NULL;
-    stonith_action_t *action = stonith__action_create(agent,
-                                                      PCMK_ACTION_METADATA,
-                                                      NULL, 0, timeout_sec,
-                                                      NULL, NULL, NULL);
-    int rc = stonith__execute(action);
-    pcmk__action_result_t *result = stonith__action_result(action);
+    char *agent_path = stonith__rhcs_agent_path(agent);
+    stonith_action_t *action = NULL;
+    pcmk__action_result_t *result = NULL;
+    int rc = pcmk_ok;
+
+    if (pcmk__cached_agent_metadata(PCMK_RESOURCE_CLASS_STONITH, NULL, agent,
+                                    agent_path, output) == pcmk_rc_ok) {
+        free(agent_path);
+        return pcmk_ok;
+    }
+
+    action = stonith__action_create(agent, PCMK_ACTION_METADATA, NULL, 0,
+                                    timeout_sec, NULL, NULL, NULL);
+    rc = stonith__execute(action);
+    result = stonith__action_result(action);
 
     if (result == NULL) {
         if (rc < 0) {
             crm_warn("Could not execute metadata action for %s: %s "
                      CRM_XS " rc=%d", agent, pcmk_strerror(rc), rc);
         }
-        stonith__destroy_action(action);
-        return rc;
-    }
 
-    if (result->execution_status != PCMK_EXEC_DONE) {
+    } else if (result->execution_status != PCMK_EXEC_DONE) {
         crm_warn("Could not execute metadata action for %s: %s",
                  agent, pcmk_exec_status_str(result->execution_status));
         rc = pcmk_rc2legacy(stonith__result2rc(result));
-        stonith__destroy_action(action);
-        return rc;
-    }
 
-    if (!pcmk__result_ok(result)) {
+    } else if (!pcmk__result_ok(result)) {
         crm_warn("Metadata action for %s returned error code %d",
                  agent, result->exit_status);
         rc = pcmk_rc2legacy(stonith__result2rc(result));
-        stonith__destroy_action(action);
-        return rc;
-    }
 
-    if (result->action_stdout == NULL) {
+    } else if (result->action_stdout == NULL) {
         crm_warn("Metadata action for %s returned no data", agent);
-        stonith__destroy_action(action);
-        return -ENODATA;
+        rc = -ENODATA;
+
+    } else {
+        *output = pcmk__str_copy(result->action_stdout);
+        pcmk__cache_agent_metadata(PCMK_RESOURCE_CLASS_STONITH, NULL, agent,
+                                   agent_path, *output);
+        rc = pcmk_ok;
     }
 
-    xml = pcmk__xml_parse(result->action_stdout);
     stonith__destroy_action(action);
+    free(agent_path);
+    return rc;
+}
+
+/*!
+ * \brief Execute RHCS-compatible agent's metadata action
+ *
+ * \param[in]  agent        Agent to execute
+ * \param[in]  timeout_sec  Action timeout
+ * \param[out] metadata     Where to store output xmlNode (or NULL to ignore)
+ */
+static int
+stonith__rhcs_get_metadata(const char *agent, int timeout_sec,
+                           xmlNode **metadata)
+{
+    xmlNode *xml = NULL;
+    xmlNode *actions = NULL;
+    xmlXPathObject *xpathObj = NULL;
+    char *output = NULL;
+    int rc = rhcs_metadata_output(agent, timeout_sec, &output);
+
+    if (rc != pcmk_ok) {
+        return rc;
+    }
+
+    xml = pcmk__xml_parse(output);
+    free(output);
 
     if (xml == NULL) {
         crm_warn("Metadata for %s is invalid", agent);
@@ -257,7 +301,7 @@ bool
 stonith__agent_is_rhcs(const char *agent)
 {
     struct stat prop;
-    char *buffer = crm_strdup_printf(PCMK__FENCE_BINDIR "/%s", agent);
+    char *buffer = stonith__rhcs_agent_path(agent);
     int rc = stat(buffer, &prop);
 
     free(buffer);
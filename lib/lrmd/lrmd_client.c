@@ -31,6 +31,7 @@
 #include <crm/services_internal.h>
 #include <crm/common/mainloop.h>
 #include <crm/common/ipc_internal.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/remote_internal.h>
 #include <crm/common/xml.h>
 
@@ -96,8 +97,35 @@ typedef struct lrmd_private_s {
     void (*proxy_callback)(lrmd_t *lrmd, void *userdata, xmlNode *msg);
     void *proxy_callback_userdata;
     char *peer_version;
+
+    /* Asynchronous requests to Pacemaker Remote that are awaiting a reply
+     * (remote message ID -> struct async_request_s *)
+     */
+    GHashTable *async_requests;
+
+    lrmd__remote_stats_t stats;
+
+    // Metrics labeled with remote_nodename (looked up once, when created)
+    pcmk__metric_t *request_duration;   // Round-trip time histogram
+    pcmk__metric_t *requests_in_flight; // Asynchronous requests awaiting reply
 } lrmd_private_t;
 
+// Asynchronous request to Pacemaker Remote that is awaiting a reply
+struct async_request_s {
+    lrmd_t *lrmd;
+    int msg_id;
+    guint timer;        // Reply timeout
+    gint64 sent;        // When request was sent (monotonic microseconds)
+    void (*callback)(int rc, void *user_data);
+    void *user_data;
+};
+
+/* Session data from the most recent TLS session with each Pacemaker Remote
+ * server ("server:port" -> gnutls_datum_t *), so reconnections can resume the
+ * session rather than redo a full handshake
+ */
+static GHashTable *tls_session_cache = NULL;
+
 static lrmd_list_t *
 lrmd_list_add(lrmd_list_t * head, const char *value)
 {
@@ -272,6 +300,17 @@ lrmd_dispatch_internal(lrmd_t * lrmd, xmlNode * msg)
         return;
     }
 
+    if (pcmk__xe_is(msg, PCMK__XE_LRMD_NOTIFY_BATCH)) {
+        // Completions coalesced by the server, in the order they happened
+        for (xmlNode *child = pcmk__xe_first_child(msg, PCMK__XE_LRMD_NOTIFY,
+                                                   NULL, NULL);
+             child != NULL; child = pcmk__xe_next_same(child)) {
+
+            lrmd_dispatch_internal(lrmd, child);
+        }
+        return;
+    }
+
     event.remote_nodename = native->remote_nodename;
     type = crm_element_value(msg, PCMK__XA_LRMD_OP);
     crm_element_value_int(msg, PCMK__XA_LRMD_CALLID, &event.call_id);
@@ -365,6 +404,132 @@ lrmd_free_xml(gpointer userdata)
     free_xml((xmlNode *) userdata);
 }
 
+/*!
+ * \internal
+ * \brief Add a request's round trip time to a connection's statistics
+ *
+ * \param[in,out] native  Executor connection private data
+ * \param[in]     sent    When request was sent (monotonic microseconds)
+ */
+static void
+record_round_trip(lrmd_private_t *native, gint64 sent)
+{
+    guint64 elapsed = (guint64) (g_get_monotonic_time() - sent);
+
+    native->stats.replies++;
+    native->stats.total_us += elapsed;
+    native->stats.last_us = elapsed;
+    native->stats.max_us = QB_MAX(native->stats.max_us, elapsed);
+    pcmk__metric_observe(native->request_duration, elapsed / 1e6);
+}
+
+static void
+free_async_request(struct async_request_s *request)
+{
+    if (request->timer != 0) {
+        g_source_remove(request->timer);
+    }
+    free(request);
+}
+
+/*!
+ * \internal
+ * \brief Pass a reply to the asynchronous request it is for, if any
+ *
+ * \param[in,out] lrmd   Executor connection that reply was received on
+ * \param[in]     reply  Reply received
+ *
+ * \return true if \p reply was for an asynchronous request, otherwise false
+ */
+static bool
+complete_async_request(lrmd_t *lrmd, const xmlNode *reply)
+{
+    lrmd_private_t *native = lrmd->lrmd_private;
+    struct async_request_s *request = NULL;
+    int msg_id = 0;
+    int rc = -ENOMSG;
+
+    if (native->async_requests == NULL) {
+        return false;
+    }
+    crm_element_value_int(reply, PCMK__XA_LRMD_REMOTE_MSG_ID, &msg_id);
+    request = g_hash_table_lookup(native->async_requests,
+                                  GINT_TO_POINTER(msg_id));
+    if (request == NULL) {
+        return false;
+    }
+    g_hash_table_steal(native->async_requests, GINT_TO_POINTER(msg_id));
+    native->stats.outstanding--;
+    pcmk__metric_add(native->requests_in_flight, -1);
+    record_round_trip(native, request->sent);
+
+    crm_element_value_int(reply, PCMK__XA_LRMD_RC, &rc);
+    crm_trace("Asynchronous request %d to Pacemaker Remote on %s completed "
+              "(%d still outstanding)", msg_id, native->remote_nodename,
+              native->stats.outstanding);
+    request->callback(rc, request->user_data);
+    free_async_request(request);
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Fail all asynchronous requests awaiting a reply
+ *
+ * \param[in,out] lrmd  Executor connection that was lost
+ */
+static void
+fail_async_requests(lrmd_t *lrmd)
+{
+    lrmd_private_t *native = lrmd->lrmd_private;
+    GHashTable *requests = native->async_requests;
+    GHashTableIter iter;
+    struct async_request_s *request = NULL;
+
+    if (requests == NULL) {
+        return;
+    }
+
+    // Callbacks might send new requests, so those need a fresh table
+    native->async_requests = NULL;
+    pcmk__metric_add(native->requests_in_flight, -native->stats.outstanding);
+    native->stats.outstanding = 0;
+
+    if (g_hash_table_size(requests) > 0) {
+        crm_info("Failing %u request%s to Pacemaker Remote on %s that were "
+                 "awaiting a reply",
+                 g_hash_table_size(requests),
+                 pcmk__plural_s(g_hash_table_size(requests)),
+                 native->remote_nodename);
+    }
+    g_hash_table_iter_init(&iter, requests);
+    while (g_hash_table_iter_next(&iter, NULL, (gpointer *) &request)) {
+        request->callback(-ENOTCONN, request->user_data);
+        free_async_request(request);
+    }
+    g_hash_table_destroy(requests);
+}
+
+/*!
+ * \internal
+ * \brief Disconnect when an asynchronous request's reply does not arrive
+ *
+ * \param[in,out] data  Request that timed out
+ *
+ * \return FALSE (to not repeat timer)
+ */
+static gboolean
+async_request_timeout(gpointer data)
+{
+    struct async_request_s *request = data;
+
+    request->timer = 0;
+    crm_err("Disconnecting remote after request %d reply not received "
+            CRM_XS " timeout", request->msg_id);
+    lrmd_tls_disconnect(request->lrmd); // This fails the request
+    return FALSE;
+}
+
 static bool
 remote_executor_connected(lrmd_t * lrmd)
 {
@@ -399,17 +564,26 @@ lrmd_tls_dispatch(gpointer userdata)
 
     crm_trace("TLS dispatch triggered");
 
-    /* First check if there are any pending notifies to process that came
-     * while we were waiting for replies earlier. */
+    /* First check if there are any pending notifies (or replies to
+     * asynchronous requests) to process that came while we were waiting for
+     * replies earlier.
+     */
     if (native->pending_notify) {
-        GList *iter = NULL;
+        GList *pending = native->pending_notify;
 
+        native->pending_notify = NULL;
         crm_trace("Processing pending notifies");
-        for (iter = native->pending_notify; iter; iter = iter->next) {
-            lrmd_dispatch_internal(lrmd, iter->data);
+        for (GList *iter = pending; iter; iter = iter->next) {
+            const char *msg_type =
+                crm_element_value(iter->data, PCMK__XA_LRMD_REMOTE_MSG_TYPE);
+
+            if (pcmk__str_eq(msg_type, "reply", pcmk__str_casei)) {
+                complete_async_request(lrmd, iter->data);
+            } else {
+                lrmd_dispatch_internal(lrmd, iter->data);
+            }
         }
-        g_list_free_full(native->pending_notify, lrmd_free_xml);
-        native->pending_notify = NULL;
+        g_list_free_full(pending, lrmd_free_xml);
     }
 
     /* Next read the current buffer and see if there are any messages to handle. */
@@ -432,7 +606,10 @@ lrmd_tls_dispatch(gpointer userdata)
         if (pcmk__str_eq(msg_type, "notify", pcmk__str_casei)) {
             lrmd_dispatch_internal(lrmd, xml);
         } else if (pcmk__str_eq(msg_type, "reply", pcmk__str_casei)) {
-            if (native->expected_late_replies > 0) {
+            if (complete_async_request(lrmd, xml)) {
+                // Reply was for an asynchronous request
+
+            } else if (native->expected_late_replies > 0) {
                 native->expected_late_replies--;
             } else {
                 int reply_id = 0;
@@ -698,6 +875,20 @@ read_remote_reply(lrmd_t *lrmd, int total_timeout, int expected_reply_id,
             crm_err("Expected a reply, got %s", msg_type);
             free_xml(*reply);
             *reply = NULL;
+        } else if ((reply_id != expected_reply_id)
+                   && (native->async_requests != NULL)
+                   && (g_hash_table_lookup(native->async_requests,
+                                           GINT_TO_POINTER(reply_id))
+                       != NULL)) {
+            /* Got a reply to an asynchronous request, so process it later (in
+             * order with any notifies)
+             */
+            native->pending_notify = g_list_append(native->pending_notify,
+                                                   *reply);
+            if (native->process_notify) {
+                mainloop_set_trigger(native->process_notify);
+            }
+            *reply = NULL;
         } else if (reply_id != expected_reply_id) {
             if (native->expected_late_replies > 0) {
                 native->expected_late_replies--;
@@ -742,12 +933,14 @@ static int
 lrmd_tls_send_recv(lrmd_t * lrmd, xmlNode * msg, int timeout, xmlNode ** reply)
 {
     int rc = 0;
+    gint64 sent = 0;
     xmlNode *xml = NULL;
 
     if (!remote_executor_connected(lrmd)) {
         return -ENOTCONN;
     }
 
+    sent = g_get_monotonic_time();
     rc = send_remote_message(lrmd, msg);
     if (rc != pcmk_rc_ok) {
         return pcmk_rc2legacy(rc);
@@ -759,6 +952,8 @@ lrmd_tls_send_recv(lrmd_t * lrmd, xmlNode * msg, int timeout, xmlNode ** reply)
                 CRM_XS " rc=%d timeout=%dms",
                 global_remote_msg_id, pcmk_rc_str(rc), rc, timeout);
         lrmd_tls_disconnect(lrmd);
+    } else {
+        record_round_trip(lrmd->lrmd_private, sent);
     }
 
     if (reply) {
@@ -976,6 +1171,9 @@ lrmd_handshake(lrmd_t * lrmd, const char *name)
     crm_xml_add(hello, PCMK__XA_LRMD_CLIENTNAME, name);
     crm_xml_add(hello, PCMK__XA_LRMD_PROTOCOL_VERSION, LRMD_PROTOCOL_VERSION);
 
+    // We can handle batched resource operation completion notifications
+    pcmk__xe_set_bool_attr(hello, PCMK__XA_LRMD_BATCH_NOTIFY, true);
+
     /* advertise that we are a proxy provider */
     if (native->proxy_callback) {
         pcmk__xe_set_bool_attr(hello, PCMK__XA_LRMD_IS_IPC_PROVIDER, true);
@@ -1152,7 +1350,7 @@ read_gnutls_key(const char *location, gnutls_datum_t *key)
 struct key_cache_s {
     time_t updated;         // When cached key was read (valid for 1 minute)
     const char *location;   // Where cached key was read from
-    gnutls_datum_t key;     // Cached key
+    gnutls_datum_t key;     // Cached key (kept after expiring, but not used)
 };
 
 static bool
@@ -1167,17 +1365,6 @@ key_cache_expired(struct key_cache_s *key_cache)
     return (time(NULL) - key_cache->updated) >= 60;
 }
 
-static void
-clear_key_cache(struct key_cache_s *key_cache)
-{
-    clear_gnutls_datum(&(key_cache->key));
-    if ((key_cache->updated != 0) || (key_cache->location != NULL)) {
-        key_cache->updated = 0;
-        key_cache->location = NULL;
-        crm_debug("Cleared Pacemaker Remote key cache");
-    }
-}
-
 static void
 get_cached_key(struct key_cache_s *key_cache, gnutls_datum_t *key)
 {
@@ -1186,10 +1373,37 @@ get_cached_key(struct key_cache_s *key_cache, gnutls_datum_t *key)
               pcmk__s(key_cache->location, "unknown location"));
 }
 
+/*!
+ * \internal
+ * \brief Forget all saved TLS sessions with Pacemaker Remote servers
+ *
+ * A resumed session does not use the authentication key at all, so sessions
+ * established with a previous key must not outlive it.
+ */
+static void
+forget_tls_sessions(void)
+{
+    if (tls_session_cache != NULL) {
+        crm_debug("Forgetting %u saved Pacemaker Remote TLS session%s because "
+                  "the authentication key changed",
+                  g_hash_table_size(tls_session_cache),
+                  pcmk__plural_s(g_hash_table_size(tls_session_cache)));
+        g_hash_table_destroy(tls_session_cache);
+        tls_session_cache = NULL;
+    }
+}
+
 static void
 cache_key(struct key_cache_s *key_cache, gnutls_datum_t *key,
           const char *location)
 {
+    if ((key_cache->key.data != NULL)
+        && ((key_cache->key.size != key->size)
+            || (memcmp(key_cache->key.data, key->data, key->size) != 0))) {
+        forget_tls_sessions();
+    }
+    clear_gnutls_datum(&(key_cache->key));
+
     key_cache->updated = time(NULL);
     key_cache->location = location;
     copy_gnutls_datum(&(key_cache->key), key);
@@ -1217,15 +1431,14 @@ get_remote_key(const char *location, gnutls_datum_t *key)
         return EINVAL;
     }
 
-    if (key_is_cached(&key_cache)) {
-        if (key_cache_expired(&key_cache)) {
-            clear_key_cache(&key_cache);
-        } else {
-            get_cached_key(&key_cache, key);
-            return pcmk_rc_ok;
-        }
+    if (key_is_cached(&key_cache) && !key_cache_expired(&key_cache)) {
+        get_cached_key(&key_cache, key);
+        return pcmk_rc_ok;
     }
 
+    /* An expired key is kept (though never used) until a key is read again,
+     * so that cache_key() can tell whether the key has changed
+     */
     rc = read_gnutls_key(location, key);
     if (rc != pcmk_rc_ok) {
         return rc;
@@ -1375,10 +1588,106 @@ report_async_connection_result(lrmd_t * lrmd, int rc)
     }
 }
 
-static inline int
-lrmd__tls_client_handshake(pcmk__remote_t *remote)
+static void
+free_tls_session_data(gpointer data)
+{
+    gnutls_datum_t *datum = data;
+
+    gnutls_free(datum->data);
+    free(datum);
+}
+
+static char *
+tls_session_key(const lrmd_private_t *native)
+{
+    return crm_strdup_printf("%s:%d", native->server, native->port);
+}
+
+/*!
+ * \internal
+ * \brief Remember a TLS session so that a later connection can resume it
+ *
+ * \param[in] native  Executor connection private data with TLS session
+ */
+static void
+save_tls_session(const lrmd_private_t *native)
 {
-    return pcmk__tls_client_handshake(remote, LRMD_CLIENT_HANDSHAKE_TIMEOUT);
+    gnutls_session_t session = *(native->remote->tls_session);
+    gnutls_datum_t *datum = NULL;
+
+#if GNUTLS_VERSION_NUMBER >= 0x030603
+    /* With TLS 1.3, the session can be resumed only once the server has sent
+     * a ticket (after the handshake)
+     */
+    if ((gnutls_protocol_get_version(session) == GNUTLS_TLS1_3)
+        && !pcmk_is_set(gnutls_session_get_flags(session),
+                        GNUTLS_SFLAGS_SESS_TICKET)) {
+        return;
+    }
+#endif
+
+    datum = pcmk__assert_alloc(1, sizeof(gnutls_datum_t));
+    if (gnutls_session_get_data2(session, datum) != GNUTLS_E_SUCCESS) {
+        free(datum);
+        return;
+    }
+    if (tls_session_cache == NULL) {
+        tls_session_cache = pcmk__strkey_table(free, free_tls_session_data);
+    }
+    g_hash_table_replace(tls_session_cache, tls_session_key(native), datum);
+}
+
+/*!
+ * \internal
+ * \brief Offer to resume any saved TLS session with a Pacemaker Remote server
+ *
+ * \param[in,out] native  Executor connection private data with new (not yet
+ *                        handshaked) TLS session
+ */
+static void
+resume_tls_session(lrmd_private_t *native)
+{
+    char *key = NULL;
+    const gnutls_datum_t *datum = NULL;
+
+    if (tls_session_cache == NULL) {
+        return;
+    }
+    key = tls_session_key(native);
+    datum = g_hash_table_lookup(tls_session_cache, key);
+    if ((datum != NULL)
+        && (gnutls_session_set_data(*(native->remote->tls_session),
+                                    datum->data, datum->size)
+            != GNUTLS_E_SUCCESS)) {
+        g_hash_table_remove(tls_session_cache, key);
+    }
+    free(key);
+}
+
+static int
+lrmd__tls_client_handshake(lrmd_private_t *native)
+{
+    int rc = pcmk_rc_ok;
+
+    resume_tls_session(native);
+    rc = pcmk__tls_client_handshake(native->remote,
+                                    LRMD_CLIENT_HANDSHAKE_TIMEOUT);
+    if (rc == pcmk_rc_ok) {
+        native->stats.handshakes++;
+        if (gnutls_session_is_resumed(*(native->remote->tls_session))) {
+            native->stats.resumed++;
+            crm_debug("Resumed TLS session with Pacemaker Remote server "
+                      "%s:%d", native->server, native->port);
+        }
+
+    } else if (tls_session_cache != NULL) {
+        // Don't offer the same session again
+        char *key = tls_session_key(native);
+
+        g_hash_table_remove(tls_session_cache, key);
+        free(key);
+    }
+    return rc;
 }
 
 /*!
@@ -1418,6 +1727,9 @@ add_tls_to_mainloop(lrmd_t *lrmd, bool do_handshake)
     if (do_handshake) {
         rc = lrmd_handshake(lrmd, name);
         rc = pcmk_legacy2rc(rc);
+        if ((rc == pcmk_rc_ok) && remote_executor_connected(lrmd)) {
+            save_tls_session(native);
+        }
     }
     free(name);
     return rc;
@@ -1470,7 +1782,7 @@ lrmd_tcp_connect_cb(void *userdata, int rc, int sock)
         return;
     }
 
-    if (lrmd__tls_client_handshake(native->remote) != pcmk_rc_ok) {
+    if (lrmd__tls_client_handshake(native) != pcmk_rc_ok) {
         crm_warn("Disconnecting after TLS handshake with Pacemaker Remote server %s:%d failed",
                  native->server, native->port);
         gnutls_deinit(*native->remote->tls_session);
@@ -1547,7 +1859,7 @@ lrmd_tls_connect(lrmd_t * lrmd, int *fd)
         return -EPROTO;
     }
 
-    if (lrmd__tls_client_handshake(native->remote) != pcmk_rc_ok) {
+    if (lrmd__tls_client_handshake(native) != pcmk_rc_ok) {
         crm_err("Session creation for %s:%d failed", native->server, native->port);
         gnutls_deinit(*native->remote->tls_session);
         gnutls_free(native->remote->tls_session);
@@ -1653,6 +1965,7 @@ lrmd_tls_disconnect(lrmd_t * lrmd)
     lrmd_private_t *native = lrmd->lrmd_private;
 
     if (native->remote->tls_session) {
+        save_tls_session(native);
         gnutls_bye(*native->remote->tls_session, GNUTLS_SHUT_RDWR);
         gnutls_deinit(*native->remote->tls_session);
         gnutls_free(native->remote->tls_session);
@@ -1678,6 +1991,8 @@ lrmd_tls_disconnect(lrmd_t * lrmd)
         g_list_free_full(native->pending_notify, lrmd_free_xml);
         native->pending_notify = NULL;
     }
+
+    fail_async_requests(lrmd);
 }
 
 static int
@@ -2028,19 +2343,15 @@ lrmd_api_get_metadata_params(lrmd_t *lrmd, const char *standard,
     return pcmk_ok;
 }
 
-static int
-lrmd_api_exec(lrmd_t *lrmd, const char *rsc_id, const char *action,
-              const char *userdata, guint interval_ms,
-              int timeout,      /* ms */
-              int start_delay,  /* ms */
-              enum lrmd_call_options options, lrmd_key_value_t * params)
+static xmlNode *
+create_exec_xml(const char *origin, const char *rsc_id, const char *action,
+                const char *userdata, guint interval_ms, int timeout,
+                int start_delay, const lrmd_key_value_t *params)
 {
-    int rc = pcmk_ok;
     xmlNode *data = pcmk__xe_create(NULL, PCMK__XE_LRMD_RSC);
     xmlNode *args = pcmk__xe_create(data, PCMK__XE_ATTRIBUTES);
-    lrmd_key_value_t *tmp = NULL;
 
-    crm_xml_add(data, PCMK__XA_LRMD_ORIGIN, __func__);
+    crm_xml_add(data, PCMK__XA_LRMD_ORIGIN, origin);
     crm_xml_add(data, PCMK__XA_LRMD_RSC_ID, rsc_id);
     crm_xml_add(data, PCMK__XA_LRMD_RSC_ACTION, action);
     crm_xml_add(data, PCMK__XA_LRMD_RSC_USERDATA_STR, userdata);
@@ -2048,9 +2359,22 @@ lrmd_api_exec(lrmd_t *lrmd, const char *rsc_id, const char *action,
     crm_xml_add_int(data, PCMK__XA_LRMD_TIMEOUT, timeout);
     crm_xml_add_int(data, PCMK__XA_LRMD_RSC_START_DELAY, start_delay);
 
-    for (tmp = params; tmp; tmp = tmp->next) {
+    for (const lrmd_key_value_t *tmp = params; tmp; tmp = tmp->next) {
         hash2smartfield((gpointer) tmp->key, (gpointer) tmp->value, args);
     }
+    return data;
+}
+
+static int
+lrmd_api_exec(lrmd_t *lrmd, const char *rsc_id, const char *action,
+              const char *userdata, guint interval_ms,
+              int timeout,      /* ms */
+              int start_delay,  /* ms */
+              enum lrmd_call_options options, lrmd_key_value_t * params)
+{
+    int rc = pcmk_ok;
+    xmlNode *data = create_exec_xml(__func__, rsc_id, action, userdata,
+                                    interval_ms, timeout, start_delay, params);
 
     rc = lrmd_send_command(lrmd, LRMD_OP_RSC_EXEC, data, NULL, timeout, options, TRUE);
     free_xml(data);
@@ -2059,6 +2383,188 @@ lrmd_api_exec(lrmd_t *lrmd, const char *rsc_id, const char *action,
     return rc;
 }
 
+/*!
+ * \internal
+ * \brief Request execution of a resource action without waiting for a reply
+ *
+ * This is equivalent to the \c exec() API method, except that for Pacemaker
+ * Remote connections, the caller does not block while the request makes a
+ * round trip. Any number of such requests may be outstanding on a connection
+ * at once. The executor's reply is passed to a callback instead.
+ *
+ * \param[in,out] lrmd         Executor connection
+ * \param[in]     rsc_id       ID of resource to execute action for
+ * \param[in]     action       Action to execute
+ * \param[in]     userdata     String to pass back with action result
+ * \param[in]     interval_ms  Action interval (in milliseconds)
+ * \param[in]     timeout      Action timeout (in milliseconds)
+ * \param[in]     start_delay  Delay before executing action (in milliseconds)
+ * \param[in]     options      Call options
+ * \param[in,out] params       Action parameters (will be freed)
+ * \param[in]     callback     Function to call with the executor's reply (the
+ *                             action's call ID, or a negative errno if the
+ *                             action could not be initiated)
+ * \param[in]     user_data    Caller data to pass to \p callback
+ *
+ * \return Standard Pacemaker return code (if not \c pcmk_rc_ok, \p callback
+ *         will not be called)
+ * \note For local executor connections, the request is synchronous, and
+ *       \p callback is called before this function returns.
+ */
+int
+lrmd__exec_async(lrmd_t *lrmd, const char *rsc_id, const char *action,
+                 const char *userdata, guint interval_ms, int timeout,
+                 int start_delay, enum lrmd_call_options options,
+                 lrmd_key_value_t *params,
+                 void (*callback)(int rc, void *user_data), void *user_data)
+{
+    int rc = pcmk_rc_ok;
+    lrmd_private_t *native = lrmd->lrmd_private;
+    xmlNode *data = NULL;
+    xmlNode *op_msg = NULL;
+    struct async_request_s *request = NULL;
+
+    CRM_CHECK(callback != NULL, return EINVAL);
+
+    if (native->type != pcmk__client_tls) {
+        callback(lrmd_api_exec(lrmd, rsc_id, action, userdata, interval_ms,
+                               timeout, start_delay, options, params),
+                 user_data);
+        return pcmk_rc_ok;
+    }
+
+    if (!remote_executor_connected(lrmd) || (native->token == NULL)) {
+        lrmd_key_value_freeall(params);
+        return ENOTCONN;
+    }
+
+    data = create_exec_xml(__func__, rsc_id, action, userdata, interval_ms,
+                           timeout, start_delay, params);
+    lrmd_key_value_freeall(params);
+    op_msg = lrmd_create_op(native->token, LRMD_OP_RSC_EXEC, data, timeout,
+                            options);
+    free_xml(data);
+
+    request = pcmk__assert_alloc(1, sizeof(struct async_request_s));
+    request->lrmd = lrmd;
+    request->callback = callback;
+    request->user_data = user_data;
+    request->sent = g_get_monotonic_time();
+
+    rc = send_remote_message(lrmd, op_msg);
+    free_xml(op_msg);
+    if (rc != pcmk_rc_ok) {
+        free(request);
+        return rc;
+    }
+
+    request->msg_id = global_remote_msg_id;
+    if ((timeout <= 0) || (timeout > MAX_TLS_RECV_WAIT)) {
+        timeout = MAX_TLS_RECV_WAIT;
+    }
+    request->timer = g_timeout_add(timeout, async_request_timeout, request);
+
+    if (native->async_requests == NULL) {
+        native->async_requests = g_hash_table_new(NULL, NULL);
+    }
+    g_hash_table_insert(native->async_requests,
+                        GINT_TO_POINTER(request->msg_id), request);
+    native->stats.requests_async++;
+    native->stats.outstanding++;
+    native->stats.max_outstanding = QB_MAX(native->stats.max_outstanding,
+                                           native->stats.outstanding);
+    pcmk__metric_add(native->requests_in_flight, 1);
+    return pcmk_rc_ok;
+}
+
+/*!
+ * \internal
+ * \brief Request execution of several resource actions at once
+ *
+ * The executor assigns each action its own call ID and reports each one's
+ * result separately, as with \c lrmd_api_exec(), but runs non-recurring
+ * actions with limited parallelism.
+ *
+ * \param[in,out] lrmd        Executor connection
+ * \param[in,out] requests    Actions to execute (each request's \c call_id
+ *                            will be set to the action's call ID if it was
+ *                            accepted, otherwise a negative errno)
+ * \param[in]     n_requests  Number of entries in \p requests
+ * \param[in]     options     Call options to use for all actions
+ *
+ * \return Standard Pacemaker return code (in particular, \c EOPNOTSUPP if the
+ *         executor does not support batches, in which case the actions should
+ *         be executed individually)
+ */
+int
+lrmd__exec_batch(lrmd_t *lrmd, lrmd__exec_request_t *requests, int n_requests,
+                 enum lrmd_call_options options)
+{
+    int rc = pcmk_ok;
+    int i = 0;
+    lrmd_private_t *native = lrmd->lrmd_private;
+    xmlNode *data = NULL;
+    xmlNode *reply = NULL;
+
+    CRM_CHECK((requests != NULL) && (n_requests > 0), return EINVAL);
+
+    if (!LRMD_SUPPORTS_EXEC_BATCH(native->peer_version)) {
+        return EOPNOTSUPP;
+    }
+
+    data = pcmk__xe_create(NULL, PCMK__XE_LRMD_EXEC_BATCH);
+    crm_xml_add(data, PCMK__XA_LRMD_ORIGIN, __func__);
+
+    for (i = 0; i < n_requests; i++) {
+        xmlNode *rsc_xml = pcmk__xe_create(data, PCMK__XE_LRMD_RSC);
+        xmlNode *args = pcmk__xe_create(rsc_xml, PCMK__XE_ATTRIBUTES);
+
+        crm_xml_add(rsc_xml, PCMK__XA_LRMD_ORIGIN, __func__);
+        crm_xml_add(rsc_xml, PCMK__XA_LRMD_RSC_ID, requests[i].rsc_id);
+        crm_xml_add(rsc_xml, PCMK__XA_LRMD_RSC_ACTION, requests[i].action);
+        crm_xml_add(rsc_xml, PCMK__XA_LRMD_RSC_USERDATA_STR,
+                    requests[i].userdata);
+        crm_xml_add_ms(rsc_xml, PCMK__XA_LRMD_RSC_INTERVAL,
+                       requests[i].interval_ms);
+        crm_xml_add_int(rsc_xml, PCMK__XA_LRMD_TIMEOUT, requests[i].timeout);
+        crm_xml_add_int(rsc_xml, PCMK__XA_LRMD_RSC_START_DELAY,
+                        requests[i].start_delay);
+        if (requests[i].params != NULL) {
+            g_hash_table_foreach(requests[i].params, hash2smartfield, args);
+        }
+        requests[i].call_id = -ECOMM;
+    }
+
+    rc = lrmd_send_command(lrmd, LRMD_OP_RSC_EXEC_BATCH, data, &reply, 0,
+                           options, TRUE);
+    free_xml(data);
+    if (rc < 0) {
+        free_xml(reply);
+        return pcmk_legacy2rc(rc);
+    }
+
+    // Results are in the same order as the requests
+    i = 0;
+    for (const xmlNode *result = pcmk__xe_first_child(reply, PCMK__XE_LRMD_RSC,
+                                                      NULL, NULL);
+         (result != NULL) && (i < n_requests);
+         result = pcmk__xe_next_same(result), i++) {
+
+        int result_rc = -ENOMSG;
+
+        crm_element_value_int(result, PCMK__XA_LRMD_RC, &result_rc);
+        if (result_rc < 0) {
+            requests[i].call_id = result_rc;
+        } else if ((crm_element_value_int(result, PCMK__XA_LRMD_CALLID,
+                                          &(requests[i].call_id)) != 0)
+                   || (requests[i].call_id <= 0)) {
+            requests[i].call_id = -ENOMSG;
+        }
+    }
+    free_xml(reply);
+    return pcmk_rc_ok;
+}
+
 /* timeout is in ms */
 static int
 lrmd_api_exec_alert(lrmd_t *lrmd, const char *alert_id, const char *alert_path,
@@ -2326,6 +2832,21 @@ lrmd__new(lrmd_t **api, const char *nodename, const char *server, int port)
         if (pvt->port == 0) {
             pvt->port = crm_default_remote_port();
         }
+
+        /* Several connections to the same node (unusual, but possible) share
+         * these, which is why the in-flight gauge is adjusted rather than set
+         */
+        pvt->request_duration =
+            pcmk__metric(pcmk__metric_seconds,
+                         "pacemaker_remote_request_duration_seconds",
+                         "Round-trip time of requests to Pacemaker Remote "
+                         "nodes",
+                         "node", pvt->remote_nodename);
+        pvt->requests_in_flight =
+            pcmk__metric(pcmk__metric_gauge,
+                         "pacemaker_remote_requests_in_flight",
+                         "Requests to Pacemaker Remote nodes awaiting a reply",
+                         "node", pvt->remote_nodename);
     }
     return pcmk_rc_ok;
 }
@@ -2391,6 +2912,8 @@ metadata_complete(svc_action_t *action)
     struct metadata_cb *metadata_cb = (struct metadata_cb *) action->cb_data;
     pcmk__action_result_t result = PCMK__UNKNOWN_RESULT;
 
+    services__metadata_to_cache(action);
+
     pcmk__set_result(&result, action->rc, action->status,
                      services__exit_reason(action));
     pcmk__set_result_output(&result, action->stdout_data, action->stderr_data);
@@ -2468,6 +2991,16 @@ lrmd__metadata_async(const lrmd_rsc_info_t *rsc,
         return EINVAL;
     }
 
+    // As with fence agents, a cached copy is returned immediately
+    if (services__metadata_from_cache(action)) {
+        pcmk__set_result(&result, action->rc, action->status, NULL);
+        pcmk__set_result_output(&result, services__grab_stdout(action), NULL);
+        callback(0, &result, user_data);
+        pcmk__reset_result(&result);
+        services_action_free(action);
+        return pcmk_rc_ok;
+    }
+
     action->cb_data = calloc(1, sizeof(struct metadata_cb));
     if (action->cb_data == NULL) {
         services_action_free(action);
@@ -2556,6 +3089,26 @@ lrmd__uptime(lrmd_t *lrmd)
     }
 }
 
+/*!
+ * \internal
+ * \brief Get round-trip statistics for a Pacemaker Remote connection
+ *
+ * \param[in] lrmd  Executor connection
+ *
+ * \return Statistics since \p lrmd was created (or NULL if \p lrmd is not a
+ *         Pacemaker Remote connection)
+ */
+const lrmd__remote_stats_t *
+lrmd__remote_stats(const lrmd_t *lrmd)
+{
+    const lrmd_private_t *native = lrmd->lrmd_private;
+
+    if (native->type != pcmk__client_tls) {
+        return NULL;
+    }
+    return &(native->stats);
+}
+
 const char *
 lrmd__node_start_state(lrmd_t *lrmd)
 {
@@ -14,6 +14,8 @@
  * declared with G_GNUC_INTERNAL for efficiency.
  */
 
+#include <time.h>                 // clock_t
+
 #include <crm/lrmd_events.h>      // lrmd_event_data_t
 #include <crm/common/scheduler.h> // pcmk_action_t, pcmk_node_t, etc.
 #include <crm/pengine/internal.h> // pcmk__location_t
@@ -1076,10 +1078,6 @@ G_GNUC_INTERNAL
 bool pcmk__rsc_agent_changed(pcmk_resource_t *rsc, pcmk_node_t *node,
                              const xmlNode *rsc_entry, bool active_on_node);
 
-G_GNUC_INTERNAL
-GList *pcmk__rscs_matching_id(const char *id,
-                              const pcmk_scheduler_t *scheduler);
-
 G_GNUC_INTERNAL
 GList *pcmk__colocated_resources(const pcmk_resource_t *rsc,
                                  const pcmk_resource_t *orig_rsc,
@@ -1167,11 +1165,44 @@ void pcmk__show_node_capacities(const char *desc, pcmk_scheduler_t *scheduler);
 
 // Functions related to the scheduler (pcmk_scheduler.c)
 
+// Processor time used by each phase of a scheduler run
+typedef struct {
+    clock_t unpack;     // Unpacking the CIB into scheduler data
+    clock_t schedule;   // Constraints, assignment, and action creation
+    clock_t graph;      // Transition graph creation
+} pcmk__sched_timings_t;
+
+G_GNUC_INTERNAL
+void pcmk__schedule_actions_timed(xmlNode *cib, unsigned long long flags,
+                                  pcmk_scheduler_t *scheduler,
+                                  pcmk__sched_timings_t *timings);
+
 G_GNUC_INTERNAL
 int pcmk__init_scheduler(pcmk__output_t *out, xmlNodePtr input, const crm_time_t *date,
                          pcmk_scheduler_t **scheduler);
 
 
+// Functions related to replaying scheduler inputs (pcmk_replay.c)
+
+// Outcome of replaying a scheduler input
+enum pcmk__replay_flags {
+    pcmk__replay_none           = 0,
+    pcmk__replay_error          = (1 << 0), // Input could not be replayed
+    pcmk__replay_missing        = (1 << 1), // No expected graph
+    pcmk__replay_graph_changed  = (1 << 2), // Graph differs from expected
+    pcmk__replay_scores_changed = (1 << 3), // Scores differ from expected
+    pcmk__replay_updated        = (1 << 4), // Expected results were updated
+};
+
+// Result of replaying a scheduler input
+typedef struct {
+    char *name;                     // Input file name without extensions
+    uint32_t flags;                 // Group of enum pcmk__replay_flags
+    guint64 duration;               // Wall time (in microseconds)
+    pcmk__sched_timings_t timings;  // Processor time of each phase
+} pcmk__replay_result_t;
+
+
 // General setup functions (pcmk_setup.c)
 
 G_GNUC_INTERNAL
@@ -238,6 +238,83 @@ designated_controller_event_cb(pcmk_ipc_api_t *controld_api,
     data->rc = pcmk_rc_ok;
 }
 
+/*!
+ * \internal
+ * \brief Process a controller metrics IPC event
+ *
+ * \param[in,out] controld_api  Controller connection
+ * \param[in]     event_type    Type of event that occurred
+ * \param[in]     status        Event status
+ * \param[in,out] event_data    \p pcmk_controld_api_reply_t object containing
+ *                              event-specific data
+ * \param[in,out] user_data     \p data_t object for API results and options
+ */
+static void
+controller_metrics_event_cb(pcmk_ipc_api_t *controld_api,
+                            enum pcmk_ipc_event event_type, crm_exit_t status,
+                            void *event_data, void *user_data)
+{
+    data_t *data = (data_t *) user_data;
+    pcmk__output_t *out = data->out;
+    const pcmk_controld_api_reply_t *reply = NULL;
+
+    int rc = validate_controld_reply(data, controld_api, event_type, status,
+                                     event_data, pcmk_controld_reply_metrics);
+
+    if (rc != pcmk_rc_ok) {
+        return;
+    }
+
+    reply = (const pcmk_controld_api_reply_t *) event_data;
+    if (reply->data.metrics == NULL) {
+        out->err(out, "error: Controller reply did not contain metrics");
+        data->rc = EBADMSG;
+        return;
+    }
+
+    out->message(out, "metrics", reply->data.metrics);
+    data->rc = pcmk_rc_ok;
+}
+
+/*!
+ * \internal
+ * \brief Process a controller trace change IPC event
+ *
+ * \param[in,out] controld_api  Controller connection
+ * \param[in]     event_type    Type of event that occurred
+ * \param[in]     status        Event status
+ * \param[in,out] event_data    \p pcmk_controld_api_reply_t object containing
+ *                              event-specific data
+ * \param[in,out] user_data     \p data_t object for API results and options
+ */
+static void
+controller_set_trace_event_cb(pcmk_ipc_api_t *controld_api,
+                              enum pcmk_ipc_event event_type,
+                              crm_exit_t status, void *event_data,
+                              void *user_data)
+{
+    data_t *data = (data_t *) user_data;
+    pcmk__output_t *out = data->out;
+    int rc = pcmk_rc_ok;
+
+    // The reply status is the result of the change itself
+    if ((event_type == pcmk_ipc_event_reply) && (status != CRM_EX_OK)) {
+        out->err(out, "error: Controller did not change tracing: %s",
+                 crm_exit_str(status));
+        data->rc = (status == CRM_EX_INSUFFICIENT_PRIV)? EACCES : EINVAL;
+        return;
+    }
+
+    rc = validate_controld_reply(data, controld_api, event_type, status,
+                                 event_data, pcmk_controld_reply_set_trace);
+    if (rc != pcmk_rc_ok) {
+        return;
+    }
+
+    out->info(out, "Controller tracing updated");
+    data->rc = pcmk_rc_ok;
+}
+
 /*!
  * \internal
  * \brief Process a node info IPC event
@@ -580,6 +657,113 @@ pcmk_designated_controller(xmlNodePtr *xml, unsigned int message_timeout_ms)
     return rc;
 }
 
+/*!
+ * \internal
+ * \brief Get and output the local controller's metrics
+ *
+ * \param[in,out] out                 Output object
+ * \param[in]     message_timeout_ms  How long to wait for a reply from the
+ *                                    \p pacemaker-controld API. If 0,
+ *                                    \p pcmk_ipc_dispatch_sync will be used.
+ *                                    Otherwise, \p pcmk_ipc_dispatch_poll will
+ *                                    be used.
+ *
+ * \return Standard Pacemaker return code
+ */
+int
+pcmk__controller_metrics(pcmk__output_t *out, unsigned int message_timeout_ms)
+{
+    data_t data = {
+        .out = out,
+        .rc = EAGAIN,
+        .message_timeout_ms = message_timeout_ms,
+    };
+    enum pcmk_ipc_dispatch dispatch_type = pcmk_ipc_dispatch_poll;
+    pcmk_ipc_api_t *controld_api = NULL;
+
+    if (message_timeout_ms == 0) {
+        dispatch_type = pcmk_ipc_dispatch_sync;
+    }
+    controld_api = ipc_connect(&data, pcmk_ipc_controld,
+                               controller_metrics_event_cb, dispatch_type,
+                               false);
+
+    if (controld_api != NULL) {
+        int rc = pcmk_controld_api_metrics(controld_api);
+        if (rc != pcmk_rc_ok) {
+            out->err(out, "error: Could not get metrics from controller: %s",
+                     pcmk_rc_str(rc));
+            data.rc = rc;
+        }
+
+        if (dispatch_type == pcmk_ipc_dispatch_poll) {
+            poll_until_reply(&data, controld_api, NULL);
+        }
+        pcmk_free_ipc_api(controld_api);
+    }
+
+    return data.rc;
+}
+
+/*!
+ * \internal
+ * \brief Change which log callsites the local controller traces
+ *
+ * Each trace argument has the same meaning as the corresponding
+ * \c PCMK_trace_* environment variable. A \c NULL argument clears that
+ * setting.
+ *
+ * \param[in,out] out                 Output object
+ * \param[in]     files               Source files to trace
+ * \param[in]     functions           Functions to trace
+ * \param[in]     formats             Log message formats to trace
+ * \param[in]     tags                Log tags to trace
+ * \param[in]     message_timeout_ms  How long to wait for a reply from the
+ *                                    \p pacemaker-controld API. If 0,
+ *                                    \p pcmk_ipc_dispatch_sync will be used.
+ *                                    Otherwise, \p pcmk_ipc_dispatch_poll will
+ *                                    be used.
+ *
+ * \return Standard Pacemaker return code
+ */
+int
+pcmk__controller_set_trace(pcmk__output_t *out, const char *files,
+                           const char *functions, const char *formats,
+                           const char *tags, unsigned int message_timeout_ms)
+{
+    data_t data = {
+        .out = out,
+        .rc = EAGAIN,
+        .message_timeout_ms = message_timeout_ms,
+    };
+    enum pcmk_ipc_dispatch dispatch_type = pcmk_ipc_dispatch_poll;
+    pcmk_ipc_api_t *controld_api = NULL;
+
+    if (message_timeout_ms == 0) {
+        dispatch_type = pcmk_ipc_dispatch_sync;
+    }
+    controld_api = ipc_connect(&data, pcmk_ipc_controld,
+                               controller_set_trace_event_cb, dispatch_type,
+                               false);
+
+    if (controld_api != NULL) {
+        int rc = pcmk__controld_api_set_trace(controld_api, files, functions,
+                                              formats, tags);
+        if (rc != pcmk_rc_ok) {
+            out->err(out, "error: Could not change controller tracing: %s",
+                     pcmk_rc_str(rc));
+            data.rc = rc;
+        }
+
+        if (dispatch_type == pcmk_ipc_dispatch_poll) {
+            poll_until_reply(&data, controld_api, NULL);
+        }
+        pcmk_free_ipc_api(controld_api);
+    }
+
+    return data.rc;
+}
+
 /*!
  * \internal
  * \brief Get and optionally output node info corresponding to a node ID from
@@ -75,6 +75,9 @@ pcmk__free_graph(pcmk__graph_t *graph)
         free(graph->source);
         free(graph->failed_stop_offset);
         free(graph->failed_start_offset);
+        if (graph->notify_data != NULL) {
+            g_hash_table_destroy(graph->notify_data);
+        }
         free(graph);
     }
 }
@@ -713,6 +716,39 @@ unpack_synapse(pcmk__graph_t *new_graph, const xmlNode *xml_synapse)
     return new_synapse;
 }
 
+/*!
+ * \internal
+ * \brief Unpack the clone notification data shared by a graph's notify actions
+ *
+ * \param[in,out] graph      Transition graph being unpacked
+ * \param[in]     xml_graph  Transition graph XML
+ */
+static void
+unpack_notify_data(pcmk__graph_t *graph, const xmlNode *xml_graph)
+{
+    for (xmlNode *data_xml = pcmk__xe_first_child(xml_graph,
+                                                  PCMK__XE_NOTIFY_DATA, NULL,
+                                                  NULL);
+         data_xml != NULL; data_xml = pcmk__xe_next_same(data_xml)) {
+
+        const char *id = pcmk__xe_id(data_xml);
+        xmlNode *attrs = pcmk__xe_first_child(data_xml, PCMK__XE_ATTRIBUTES,
+                                              NULL, NULL);
+
+        if ((id == NULL) || (attrs == NULL)) {
+            crm_warn("Ignoring invalid " PCMK__XE_NOTIFY_DATA " in transition "
+                     "%d", graph->id);
+            continue;
+        }
+        if (graph->notify_data == NULL) {
+            graph->notify_data = pcmk__strkey_table(free,
+                                                    (GDestroyNotify) free_xml);
+        }
+        g_hash_table_insert(graph->notify_data, pcmk__str_copy(id),
+                            pcmk__xml_copy(NULL, attrs));
+    }
+}
+
 /*!
  * \internal
  * \brief Unpack transition graph XML
@@ -725,9 +761,13 @@ unpack_synapse(pcmk__graph_t *new_graph, const xmlNode *xml_synapse)
  *       pcmk__free_graph().
  * \note The XML is expected to be structured like:
          <transition_graph ...>
+           <notify_data id="0">
+             <attributes ...>
+           </notify_data>
+           ...
            <synapse id="0">
              <action_set>
-               <rsc_op id="2" ...>
+               <rsc_op id="2" notify_data="0" ...>
                ...
              </action_set>
              <inputs>
@@ -802,6 +842,8 @@ pcmk__unpack_graph(const xmlNode *xml_graph, const char *reference)
         }
     }
 
+    unpack_notify_data(new_graph, xml_graph);
+
     // Unpack each child <synapse> element
     for (const xmlNode *synapse_xml = pcmk__xe_first_child(xml_graph,
                                                            "synapse", NULL,
@@ -824,6 +866,56 @@ pcmk__unpack_graph(const xmlNode *xml_graph, const char *reference)
     return new_graph;
 }
 
+/*!
+ * \internal
+ * \brief Get a graph action's XML with its clone notification data added
+ *
+ * The scheduler writes the notification data that is the same for every action
+ * in a clone notification round once per graph, and has the actions refer to
+ * it. This gets the XML that the action would have had otherwise,
+ * which is what the action's resource agent should be given.
+ *
+ * \param[in] graph   Transition graph that \p action is part of
+ * \param[in] action  Graph action to check
+ *
+ * \return Newly allocated copy of \p action's XML with the notification data
+ *         it refers to added to its attributes, or \c NULL if it does not
+ *         refer to any
+ * \note The caller is responsible for freeing a non-NULL result with
+ *       \c free_xml().
+ */
+xmlNode *
+pcmk__expand_notify_data(const pcmk__graph_t *graph,
+                         const pcmk__graph_action_t *action)
+{
+    const char *id = crm_element_value(action->xml, PCMK__XA_NOTIFY_DATA);
+    const xmlNode *data = NULL;
+    xmlNode *expanded = NULL;
+    xmlNode *attrs = NULL;
+
+    if (id == NULL) {
+        return NULL;
+    }
+    if (graph->notify_data != NULL) {
+        data = g_hash_table_lookup(graph->notify_data, id);
+    }
+    if (data == NULL) {
+        crm_warn("Action %d in transition %d refers to unknown notification "
+                 "data %s", action->id, graph->id, id);
+        return NULL;
+    }
+
+    expanded = pcmk__xml_copy(NULL, action->xml);
+    pcmk__xe_remove_attr(expanded, PCMK__XA_NOTIFY_DATA);
+
+    attrs = pcmk__xe_first_child(expanded, PCMK__XE_ATTRIBUTES, NULL, NULL);
+    if (attrs == NULL) {
+        attrs = pcmk__xe_create(expanded, PCMK__XE_ATTRIBUTES);
+    }
+    pcmk__xe_copy_attrs(attrs, data, pcmk__xaf_none);
+    return expanded;
+}
+
 
 /*
  * Other transition graph utilities
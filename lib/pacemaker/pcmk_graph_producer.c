@@ -318,6 +318,118 @@ add_resource_details(const pcmk_action_t *action, xmlNode *action_xml)
     }
 }
 
+/*!
+ * \internal
+ * \brief Check whether a graph action attribute is shared notification data
+ *
+ * \param[in] name  Name of attribute (as written to graph)
+ *
+ * \return true if \p name is clone notification data that every action in a
+ *         notification round gets, otherwise false
+ */
+static bool
+is_shared_notify_meta(const char *name)
+{
+    if (!pcmk__starts_with(name, CRM_META "_notify_")) {
+        return false;
+    }
+
+    // These vary by action, but all other notify_* values are per round
+    name += strlen(CRM_META "_");
+    return !pcmk__str_any_of(name, "notify_type", "notify_operation",
+                             "notify_key_type", "notify_key_operation", NULL);
+}
+
+/*!
+ * \internal
+ * \brief Write an action's clone notification data once per graph
+ *
+ * Every action in a clone notification round (the notify actions, and the
+ * actions being notified about) gets the same lists of instances and nodes,
+ * which grow with the number of instances. Rather than write them into each
+ * such action (making the graph size quadratic in the number of instances),
+ * write each distinct set once, as a \c PCMK__XE_NOTIFY_DATA element ahead of
+ * the synapses, and have the actions refer to it by ID. The controller adds
+ * the data back to each action when executing it.
+ *
+ * \param[in,out] action      Resource action
+ * \param[in,out] action_xml  Transition graph action XML for \p action
+ * \param[in,out] args_xml    Attributes of \p action_xml
+ */
+static void
+share_notify_data(pcmk_action_t *action, xmlNode *action_xml,
+                  xmlNode *args_xml)
+{
+    pcmk_scheduler_t *scheduler = action->rsc->cluster;
+    pcmk__scheduler_private_t *priv = scheduler->internal;
+    xmlNode *data_xml = NULL;
+    xmlAttr *attr = pcmk__xe_first_attr(args_xml);
+    GString *buffer = NULL;
+    const char *id = NULL;
+
+    if (priv == NULL) {
+        return; // Leave the values in the action
+    }
+    data_xml = pcmk__xe_create(NULL, PCMK__XE_ATTRIBUTES);
+
+    // Move the shared values, which are already sorted, to their own element
+    while (attr != NULL) {
+        xmlAttr *next = attr->next;
+
+        if (is_shared_notify_meta((const char *) attr->name)) {
+            crm_xml_add(data_xml, (const char *) attr->name,
+                        pcmk__xml_attr_value(attr));
+            xmlRemoveProp(attr);
+        }
+        attr = next;
+    }
+
+    if (pcmk__xe_first_attr(data_xml) == NULL) {
+        free_xml(data_xml);
+        return;
+    }
+
+    if (priv->graph_notify_data == NULL) {
+        priv->graph_notify_data = pcmk__strkey_table(free, free);
+    }
+
+    buffer = g_string_sized_new(1024);
+    pcmk__xml_string(data_xml, 0, buffer, 0);
+
+    id = g_hash_table_lookup(priv->graph_notify_data, buffer->str);
+    if (id == NULL) {
+        xmlNode *block = NULL;
+        xmlNode *first_synapse = NULL;
+        char *new_id = NULL;
+
+        new_id = crm_strdup_printf("%u",
+                                   g_hash_table_size(priv->graph_notify_data));
+        block = pcmk__xe_create(scheduler->graph, PCMK__XE_NOTIFY_DATA);
+        crm_xml_add(block, PCMK_XA_ID, new_id);
+        pcmk__xml_copy(block, data_xml);
+
+        /* Keep the data ahead of all synapses, in the order it was created.
+         * There is always a synapse by now (the one for this action).
+         */
+        first_synapse = pcmk__xe_first_child(scheduler->graph, "synapse", NULL,
+                                             NULL);
+        xmlUnlinkNode(block);
+        xmlAddPrevSibling(first_synapse, block);
+
+        g_hash_table_insert(priv->graph_notify_data,
+                            g_string_free(buffer, FALSE), new_id);
+        buffer = NULL;
+        id = new_id;
+    }
+
+    crm_xml_add(action_xml, PCMK__XA_NOTIFY_DATA, id);
+
+    if (buffer != NULL) {
+        g_string_free(buffer, TRUE);
+    }
+    free_xml(data_xml);
+}
+
 /*!
  * \internal
  * \brief Add action attributes to transition graph action XML
@@ -329,6 +441,7 @@ static void
 add_action_attributes(pcmk_action_t *action, xmlNode *action_xml)
 {
     xmlNode *args_xml = NULL;
+    xmlNode *sorted_args = NULL;
 
     /* We create free-standing XML to start, so we can sort the attributes
      * before adding it to action_xml, which keeps the scheduler regression
@@ -357,6 +470,10 @@ add_action_attributes(pcmk_action_t *action, xmlNode *action_xml)
     }
 
     g_hash_table_foreach(action->meta, hash2metafield, args_xml);
+
+    // Clone notification data is shared by all actions in a notification round
+    pe__foreach_notify_meta(action, hash2metafield, args_xml);
+
     if (action->rsc != NULL) {
         pcmk_resource_t *parent = action->rsc;
 
@@ -379,8 +496,12 @@ add_action_attributes(pcmk_action_t *action, xmlNode *action_xml)
                              args_xml);
     }
 
-    sorted_xml(args_xml, action_xml, FALSE);
+    sorted_args = sorted_xml(args_xml, action_xml, FALSE);
     free_xml(args_xml);
+
+    if (action->rsc != NULL) {
+        share_notify_data(action, action_xml, sorted_args);
+    }
 }
 
 /*!
@@ -1009,6 +1130,12 @@ pcmk__create_graph(pcmk_scheduler_t *scheduler)
     transition_id++;
     crm_trace("Creating transition graph %d", transition_id);
 
+    // Any notification data written to an earlier graph is not in this one
+    if (scheduler->internal != NULL) {
+        g_clear_pointer(&(scheduler->internal->graph_notify_data),
+                        g_hash_table_destroy);
+    }
+
     scheduler->graph = pcmk__xe_create(NULL, PCMK__XE_TRANSITION_GRAPH);
 
     value = pcmk__cluster_option(config_hash, PCMK_OPT_CLUSTER_DELAY);
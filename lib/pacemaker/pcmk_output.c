@@ -8,6 +8,7 @@
  */
 
 #include <crm_internal.h>
+#include <crm/common/metrics_internal.h>
 #include <crm/common/output.h>
 #include <crm/common/results.h>
 #include <crm/common/xml.h>
@@ -20,6 +21,8 @@
 #include <inttypes.h>
 #include <stdint.h>
 
+#include "libpacemaker_private.h"
+
 static char *
 colocations_header(pcmk_resource_t *rsc, pcmk__colocation_t *cons,
                    bool dependents) {
@@ -831,34 +834,212 @@ pacemakerd_health_xml(pcmk__output_t *out, va_list args)
     return pcmk_rc_ok;
 }
 
-PCMK__OUTPUT_ARGS("profile", "const char *", "clock_t", "clock_t")
+PCMK__OUTPUT_ARGS("profile", "const char *", "clock_t", "clock_t",
+                  "const pcmk__sched_timings_t *")
 static int
 profile_default(pcmk__output_t *out, va_list args) {
     const char *xml_file = va_arg(args, const char *);
     clock_t start = va_arg(args, clock_t);
     clock_t end = va_arg(args, clock_t);
+    const pcmk__sched_timings_t *timings =
+        va_arg(args, const pcmk__sched_timings_t *);
 
-    out->list_item(out, NULL, "Testing %s ... %.2f secs", xml_file,
-                   (end - start) / (float) CLOCKS_PER_SEC);
+    out->list_item(out, NULL,
+                   "Testing %s ... %.2f secs "
+                   "(unpack %.2f, schedule %.2f, graph %.2f)",
+                   xml_file, (end - start) / (float) CLOCKS_PER_SEC,
+                   timings->unpack / (float) CLOCKS_PER_SEC,
+                   timings->schedule / (float) CLOCKS_PER_SEC,
+                   timings->graph / (float) CLOCKS_PER_SEC);
 
     return pcmk_rc_ok;
 }
 
-PCMK__OUTPUT_ARGS("profile", "const char *", "clock_t", "clock_t")
+PCMK__OUTPUT_ARGS("profile", "const char *", "clock_t", "clock_t",
+                  "const pcmk__sched_timings_t *")
 static int
 profile_xml(pcmk__output_t *out, va_list args) {
     const char *xml_file = va_arg(args, const char *);
     clock_t start = va_arg(args, clock_t);
     clock_t end = va_arg(args, clock_t);
+    const pcmk__sched_timings_t *timings =
+        va_arg(args, const pcmk__sched_timings_t *);
 
     char *duration = pcmk__ftoa((end - start) / (float) CLOCKS_PER_SEC);
+    char *unpack = pcmk__ftoa(timings->unpack / (float) CLOCKS_PER_SEC);
+    char *schedule = pcmk__ftoa(timings->schedule / (float) CLOCKS_PER_SEC);
+    char *graph = pcmk__ftoa(timings->graph / (float) CLOCKS_PER_SEC);
 
     pcmk__output_create_xml_node(out, PCMK_XE_TIMING,
                                  PCMK_XA_FILE, xml_file,
                                  PCMK_XA_DURATION, duration,
+                                 PCMK_XA_UNPACK_DURATION, unpack,
+                                 PCMK_XA_SCHEDULE_DURATION, schedule,
+                                 PCMK_XA_GRAPH_DURATION, graph,
                                  NULL);
 
     free(duration);
+    free(unpack);
+    free(schedule);
+    free(graph);
+    return pcmk_rc_ok;
+}
+
+static const char *
+replay_result_text(uint32_t flags)
+{
+    if (pcmk_is_set(flags, pcmk__replay_error)) {
+        return "error";
+    }
+    if (pcmk_is_set(flags, pcmk__replay_missing)) {
+        return "no expected graph";
+    }
+    if (pcmk_all_flags_set(flags, pcmk__replay_graph_changed
+                                  |pcmk__replay_scores_changed)) {
+        return "graph and scores changed";
+    }
+    if (pcmk_is_set(flags, pcmk__replay_graph_changed)) {
+        return "graph changed";
+    }
+    if (pcmk_is_set(flags, pcmk__replay_scores_changed)) {
+        return "scores changed";
+    }
+    if (pcmk_is_set(flags, pcmk__replay_updated)) {
+        return "updated";
+    }
+    return "passed";
+}
+
+PCMK__OUTPUT_ARGS("replay-result", "const pcmk__replay_result_t *")
+static int
+replay_result_default(pcmk__output_t *out, va_list args)
+{
+    const pcmk__replay_result_t *result =
+        va_arg(args, const pcmk__replay_result_t *);
+
+    out->list_item(out, NULL,
+                   "%s: %s ... %.2f secs "
+                   "(unpack %.2f, schedule %.2f, graph %.2f)",
+                   result->name, replay_result_text(result->flags),
+                   result->duration / (float) G_USEC_PER_SEC,
+                   result->timings.unpack / (float) CLOCKS_PER_SEC,
+                   result->timings.schedule / (float) CLOCKS_PER_SEC,
+                   result->timings.graph / (float) CLOCKS_PER_SEC);
+    return pcmk_rc_ok;
+}
+
+PCMK__OUTPUT_ARGS("replay-result", "const pcmk__replay_result_t *")
+static int
+replay_result_xml(pcmk__output_t *out, va_list args)
+{
+    const pcmk__replay_result_t *result =
+        va_arg(args, const pcmk__replay_result_t *);
+
+    char *duration = pcmk__ftoa(result->duration / (float) G_USEC_PER_SEC);
+    char *unpack = pcmk__ftoa(result->timings.unpack / (float) CLOCKS_PER_SEC);
+    char *schedule = pcmk__ftoa(result->timings.schedule
+                                / (float) CLOCKS_PER_SEC);
+    char *graph = pcmk__ftoa(result->timings.graph / (float) CLOCKS_PER_SEC);
+
+    pcmk__output_create_xml_node(out, PCMK_XE_REPLAY,
+                                 PCMK_XA_FILE, result->name,
+                                 PCMK_XA_RESULT,
+                                 replay_result_text(result->flags),
+                                 PCMK_XA_DURATION, duration,
+                                 PCMK_XA_UNPACK_DURATION, unpack,
+                                 PCMK_XA_SCHEDULE_DURATION, schedule,
+                                 PCMK_XA_GRAPH_DURATION, graph,
+                                 NULL);
+
+    free(duration);
+    free(unpack);
+    free(schedule);
+    free(graph);
+    return pcmk_rc_ok;
+}
+
+// Maximum number of slowest inputs to list in replay summary
+#define REPLAY_SLOWEST 10
+
+static gint
+compare_replay_duration(gconstpointer a, gconstpointer b)
+{
+    const pcmk__replay_result_t *result_a =
+        *(const pcmk__replay_result_t **) a;
+    const pcmk__replay_result_t *result_b =
+        *(const pcmk__replay_result_t **) b;
+
+    if (result_a->duration > result_b->duration) {
+        return -1;
+    }
+    return (result_a->duration < result_b->duration)? 1 : 0;
+}
+
+PCMK__OUTPUT_ARGS("replay-summary", "const pcmk__replay_result_t *", "int",
+                  "int", "int", "guint64")
+static int
+replay_summary_default(pcmk__output_t *out, va_list args)
+{
+    const pcmk__replay_result_t *results =
+        va_arg(args, const pcmk__replay_result_t *);
+    int count = va_arg(args, int);
+    int failed = va_arg(args, int);
+    int jobs = va_arg(args, int);
+    guint64 duration = va_arg(args, guint64);
+
+    GPtrArray *slowest = g_ptr_array_sized_new(count);
+
+    out->info(out, "Replayed %d input%s with up to %d worker%s in %.2f secs: "
+              "%d failed",
+              count, pcmk__plural_s(count), jobs, pcmk__plural_s(jobs),
+              duration / (float) G_USEC_PER_SEC, failed);
+
+    for (int i = 0; i < count; i++) {
+        g_ptr_array_add(slowest, (gpointer) &results[i]);
+    }
+    g_ptr_array_sort(slowest, compare_replay_duration);
+
+    out->begin_list(out, NULL, NULL, "Slowest inputs");
+    for (guint i = 0; (i < slowest->len) && (i < REPLAY_SLOWEST); i++) {
+        const pcmk__replay_result_t *result = g_ptr_array_index(slowest, i);
+
+        out->list_item(out, NULL, "%s: %.2f secs", result->name,
+                       result->duration / (float) G_USEC_PER_SEC);
+    }
+    out->end_list(out);
+
+    g_ptr_array_free(slowest, TRUE);
+    return pcmk_rc_ok;
+}
+
+PCMK__OUTPUT_ARGS("replay-summary", "const pcmk__replay_result_t *", "int",
+                  "int", "int", "guint64")
+static int
+replay_summary_xml(pcmk__output_t *out, va_list args)
+{
+    const pcmk__replay_result_t *results G_GNUC_UNUSED =
+        va_arg(args, const pcmk__replay_result_t *);
+    int count = va_arg(args, int);
+    int failed = va_arg(args, int);
+    int jobs = va_arg(args, int);
+    guint64 duration = va_arg(args, guint64);
+
+    char *count_s = pcmk__itoa(count);
+    char *failed_s = pcmk__itoa(failed);
+    char *jobs_s = pcmk__itoa(jobs);
+    char *duration_s = pcmk__ftoa(duration / (float) G_USEC_PER_SEC);
+
+    pcmk__output_create_xml_node(out, PCMK_XE_REPLAY_SUMMARY,
+                                 PCMK_XA_COUNT, count_s,
+                                 PCMK_XA_FAILED, failed_s,
+                                 PCMK_XA_JOBS, jobs_s,
+                                 PCMK_XA_DURATION, duration_s,
+                                 NULL);
+
+    free(count_s);
+    free(failed_s);
+    free(jobs_s);
+    free(duration_s);
     return pcmk_rc_ok;
 }
 
@@ -902,6 +1083,29 @@ dc_xml(pcmk__output_t *out, va_list args)
     return pcmk_rc_ok;
 }
 
+PCMK__OUTPUT_ARGS("metrics", "const xmlNode *")
+static int
+metrics_text(pcmk__output_t *out, va_list args)
+{
+    const xmlNode *metrics = va_arg(args, const xmlNode *);
+    GString *buf = g_string_sized_new(1024);
+
+    pcmk__metrics_xml_to_text(metrics, buf);
+    pcmk__formatted_printf(out, "%s", buf->str);
+    g_string_free(buf, TRUE);
+    return pcmk_rc_ok;
+}
+
+PCMK__OUTPUT_ARGS("metrics", "const xmlNode *")
+static int
+metrics_xml(pcmk__output_t *out, va_list args)
+{
+    const xmlNode *metrics = va_arg(args, const xmlNode *);
+
+    pcmk__output_xml_add_node_copy(out, (xmlNode *) metrics);
+    return pcmk_rc_ok;
+}
+
 PCMK__OUTPUT_ARGS("crmadmin-node", "const char *", "const char *",
                   "const char *", "bool")
 static int
@@ -2648,6 +2852,8 @@ static pcmk__message_entry_t fmt_functions[] = {
     { "locations-and-colocations", "xml", locations_and_colocations_xml },
     { "locations-list", "default", locations_list },
     { "locations-list", "xml", locations_list_xml },
+    { "metrics", "text", metrics_text },
+    { "metrics", "xml", metrics_xml },
     { "node-action", "default", node_action },
     { "node-action", "xml", node_action_xml },
     { "node-info", "default", node_info_default },
@@ -2658,6 +2864,10 @@ static pcmk__message_entry_t fmt_functions[] = {
     { "pacemakerd-health", "xml", pacemakerd_health_xml },
     { "profile", "default", profile_default, },
     { "profile", "xml", profile_xml },
+    { "replay-result", "default", replay_result_default },
+    { "replay-result", "xml", replay_result_xml },
+    { "replay-summary", "default", replay_summary_default },
+    { "replay-summary", "xml", replay_summary_xml },
     { "result-code", PCMK_VALUE_NONE, result_code_none },
     { "result-code", "text", result_code_text },
     { "result-code", "xml", result_code_xml },
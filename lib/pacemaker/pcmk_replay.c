@@ -0,0 +1,873 @@
+/*
+ * Copyright 2026 the Pacemaker project contributors
+ *
+ * The version control history for this file may have further details.
+ *
+ * This source code is licensed under the GNU Lesser General Public License
+ * version 2.1 or later (LGPLv2.1+) WITHOUT ANY WARRANTY.
+ */
+
+#include <crm_internal.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <glib.h>
+
+#include <crm/crm.h>
+#include <crm/common/xml.h>
+#include <crm/common/scheduler.h>
+#include <pacemaker-internal.h>
+
+#include "libpacemaker_private.h"
+
+/* Replay many saved scheduler inputs and compare the results against expected
+ * transition graphs and assignment scores, as cts-scheduler does, but without
+ * starting a new crm_simulate process (and loading the schemas again) for each
+ * input.
+ *
+ * The first input is replayed in this process, which loads and compiles the
+ * schemas it needs. Any remaining inputs are then handed out one at a time to
+ * a pool of forked workers, which share those schemas with this process
+ * copy-on-write. Processes are used rather than threads because the
+ * scheduler, libxml2 error handling, and logging are not thread-safe. A worker
+ * that crashes fails only the input it was replaying and is replaced.
+ */
+
+// Replay state common to the parent and all workers
+struct replay_context {
+    const char *input_dir;          // Where inputs are
+    const char *expected_dir;       // Where expected results are
+    bool update;                    // Whether to update expected results
+    unsigned long long flags;       // Group of enum pcmk_scheduler_flags
+    const char *use_date;           // Effective date to use (if not NULL)
+    GPtrArray *inputs;              // Input file names within input_dir
+    pcmk__replay_result_t *results; // One per input, in the same order
+};
+
+// Per-process scheduler state
+struct replay_engine {
+    pcmk_scheduler_t *scheduler;
+    pcmk__output_t *out;            // Quiet output that captures scores
+    char *scores_file;              // Where out writes
+};
+
+// Parent's view of a worker process
+struct replay_worker {
+    pid_t pid;
+    int request_fd;                 // Parent writes input indexes here
+    int result_fd;                  // Worker writes results here
+    int input;                      // Input being replayed (or -1 if idle)
+    GString *pending;               // Partial result line read so far
+};
+
+#define REPLAY_FAILED (pcmk__replay_error|pcmk__replay_missing  \
+                       |pcmk__replay_graph_changed              \
+                       |pcmk__replay_scores_changed)
+
+static struct replay_engine *
+engine_new(void)
+{
+    struct replay_engine *engine = NULL;
+    int fd = -1;
+
+    engine = pcmk__assert_alloc(1, sizeof(struct replay_engine));
+    engine->scores_file = crm_strdup_printf("%s/crm_simulate-replay.XXXXXX",
+                                            pcmk__get_tmpdir());
+    fd = mkstemp(engine->scores_file);
+    if (fd < 0) {
+        crm_err("Could not create temporary file %s: %s",
+                engine->scores_file, strerror(errno));
+        free(engine->scores_file);
+        free(engine);
+        return NULL;
+    }
+    close(fd);
+
+    if (pcmk__text_output_new(&engine->out,
+                              engine->scores_file) != pcmk_rc_ok) {
+        unlink(engine->scores_file);
+        free(engine->scores_file);
+        free(engine);
+        return NULL;
+    }
+    pe__register_messages(engine->out);
+    pcmk__register_lib_messages(engine->out);
+    engine->out->quiet = true;
+
+    engine->scheduler = pe_new_working_set();
+    pcmk__mem_assert(engine->scheduler);
+    engine->scheduler->priv = engine->out;
+    return engine;
+}
+
+static void
+engine_free(struct replay_engine *engine)
+{
+    if (engine != NULL) {
+        pe_free_working_set(engine->scheduler);
+        engine->out->finish(engine->out, CRM_EX_OK, false, NULL);
+        pcmk__output_free(engine->out);
+        unlink(engine->scores_file);
+        free(engine->scores_file);
+        free(engine);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Get the path of an expected result for an input
+ *
+ * \param[in] dir   Directory with expected results
+ * \param[in] base  Input's base name
+ * \param[in] ext   Extension of expected result file
+ *
+ * \return Newly allocated path, which is \c dir/ext/base.ext if a \c dir/ext
+ *         subdirectory exists (as in cts/scheduler) or \c dir/base.ext
+ *         otherwise
+ */
+static char *
+expected_file(const char *dir, const char *base, const char *ext)
+{
+    char *subdir = crm_strdup_printf("%s/%s", dir, ext);
+    struct stat sb;
+    char *path = NULL;
+
+    if ((stat(subdir, &sb) == 0) && S_ISDIR(sb.st_mode)) {
+        path = crm_strdup_printf("%s/%s.%s", subdir, base, ext);
+    } else {
+        path = crm_strdup_printf("%s/%s.%s", dir, base, ext);
+    }
+    free(subdir);
+    return path;
+}
+
+// Remove values that legitimately differ between versions, as cts does
+static void
+normalize_graph(xmlNode *graph)
+{
+    pcmk__xml_tree_foreach(graph, pcmk__xe_remove_attr_cb,
+                           (void *) PCMK_XA_CRM_FEATURE_SET);
+    pcmk__xml_tree_foreach(graph, pcmk__xe_remove_attr_cb,
+                           (void *) PCMK_OPT_BATCH_LIMIT);
+}
+
+/*!
+ * \internal
+ * \brief Compare a newly calculated transition graph against an expected one
+ *
+ * \param[in]     path   Path of expected graph
+ * \param[in,out] graph  Newly calculated graph (will be normalized)
+ *
+ * \return Group of enum pcmk__replay_flags for result
+ */
+static uint32_t
+compare_graph(const char *path, xmlNode *graph)
+{
+    xmlNode *expected = NULL;
+    GString *expected_s = NULL;
+    GString *graph_s = NULL;
+    uint32_t flags = pcmk__replay_none;
+
+    if (access(path, F_OK) != 0) {
+        return pcmk__replay_missing;
+    }
+
+    expected = pcmk__xml_read(path);
+    if (expected == NULL) {
+        return pcmk__replay_error;
+    }
+    normalize_graph(expected);
+    normalize_graph(graph);
+
+    expected_s = g_string_sized_new(4096);
+    graph_s = g_string_sized_new(4096);
+    pcmk__xml_string(expected, 0, expected_s, 0);
+    pcmk__xml_string(graph, 0, graph_s, 0);
+    if (!g_string_equal(expected_s, graph_s)) {
+        flags = pcmk__replay_graph_changed;
+    }
+
+    g_string_free(expected_s, TRUE);
+    g_string_free(graph_s, TRUE);
+    free_xml(expected);
+    return flags;
+}
+
+static gint
+compare_lines(gconstpointer a, gconstpointer b)
+{
+    return strcmp(*(const char **) a, *(const char **) b);
+}
+
+/*!
+ * \internal
+ * \brief Read a scores file as a sorted list of its non-empty lines
+ *
+ * \param[in] path  Scores file to read
+ *
+ * \return Newly allocated list of newly allocated lines (or NULL if the file
+ *         could not be read)
+ */
+static GPtrArray *
+read_scores(const char *path)
+{
+    char *contents = NULL;
+    gchar **lines = NULL;
+    GPtrArray *scores = NULL;
+
+    if (!g_file_get_contents(path, &contents, NULL, NULL)) {
+        return NULL;
+    }
+
+    scores = g_ptr_array_new_with_free_func(g_free);
+    lines = g_strsplit(contents, "\n", 0);
+    for (gchar **line = lines; *line != NULL; line++) {
+        if (!pcmk__str_empty(*line)) {
+            g_ptr_array_add(scores, g_strdup(*line));
+        }
+    }
+    g_strfreev(lines);
+    g_free(contents);
+
+    g_ptr_array_sort(scores, compare_lines);
+    return scores;
+}
+
+static int
+write_scores(const char *path, const GPtrArray *scores)
+{
+    FILE *fp = fopen(path, "w");
+    int rc = pcmk_rc_ok;
+
+    if (fp == NULL) {
+        return errno;
+    }
+    for (guint i = 0; i < scores->len; i++) {
+        fprintf(fp, "%s\n", (const char *) g_ptr_array_index(scores, i));
+    }
+    if (fclose(fp) != 0) {
+        rc = errno;
+    }
+    return rc;
+}
+
+static bool
+scores_equal(const GPtrArray *scores1, const GPtrArray *scores2)
+{
+    if (scores1->len != scores2->len) {
+        return false;
+    }
+    for (guint i = 0; i < scores1->len; i++) {
+        if (strcmp(g_ptr_array_index(scores1, i),
+                   g_ptr_array_index(scores2, i)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Replay one input and compare or update its expected results
+ *
+ * \param[in,out] ctx     Replay context
+ * \param[in,out] engine  Scheduler state to use
+ * \param[in]     index   Index of input to replay
+ */
+static void
+replay_input(struct replay_context *ctx, struct replay_engine *engine,
+             int index)
+{
+    pcmk__replay_result_t *result = &(ctx->results[index]);
+    pcmk_scheduler_t *scheduler = engine->scheduler;
+    unsigned long long flags = ctx->flags;
+    gint64 start = g_get_monotonic_time();
+    char *input_file = NULL;
+    char *graph_file = NULL;
+    char *scores_file = NULL;
+    xmlNode *cib = NULL;
+    time_t original_date = 0;
+
+    input_file = crm_strdup_printf("%s/%s", ctx->input_dir,
+                                   (const char *) g_ptr_array_index(ctx->inputs,
+                                                                    index));
+    graph_file = expected_file(ctx->expected_dir, result->name, "exp");
+    scores_file = expected_file(ctx->expected_dir, result->name, "scores");
+
+    cib = pcmk__xml_read(input_file);
+    if (cib == NULL) {
+        result->flags |= pcmk__replay_error;
+        goto done;
+    }
+    if (pcmk_find_cib_element(cib, PCMK_XE_STATUS) == NULL) {
+        pcmk__xe_create(cib, PCMK_XE_STATUS);
+    }
+    if ((pcmk_update_configured_schema(&cib, false) != pcmk_rc_ok)
+        || !pcmk__validate_xml(cib, NULL, NULL, NULL)) {
+        crm_err("Could not replay %s: Invalid configuration", input_file);
+        free_xml(cib);
+        result->flags |= pcmk__replay_error;
+        goto done;
+    }
+
+    scheduler->input = cib;
+    if (ctx->use_date != NULL) {
+        scheduler->now = crm_time_new(ctx->use_date);
+    } else if ((crm_element_value_epoch(cib, PCMK_XA_EXECUTION_DATE,
+                                        &original_date) == pcmk_ok)
+               && (original_date != 0)) {
+        scheduler->now = pcmk__copy_timet(original_date);
+    }
+
+    if (ctx->update || (access(scores_file, F_OK) == 0)) {
+        flags |= pcmk_sched_output_scores;
+    }
+
+    engine->out->reset(engine->out);
+    pcmk__schedule_actions_timed(cib, flags, scheduler, &(result->timings));
+    engine->out->finish(engine->out, CRM_EX_OK, true, NULL);
+
+    if (scheduler->graph == NULL) {
+        result->flags |= pcmk__replay_error;
+
+    } else if (ctx->update) {
+        GPtrArray *scores = read_scores(engine->scores_file);
+
+        normalize_graph(scheduler->graph);
+        if ((pcmk__xml_write_file(scheduler->graph, graph_file, false,
+                                  NULL) != pcmk_rc_ok)
+            || (scores == NULL)
+            || (write_scores(scores_file, scores) != pcmk_rc_ok)) {
+            crm_err("Could not update expected results for %s", input_file);
+            result->flags |= pcmk__replay_error;
+        } else {
+            result->flags |= pcmk__replay_updated;
+        }
+        if (scores != NULL) {
+            g_ptr_array_free(scores, TRUE);
+        }
+
+    } else {
+        result->flags |= compare_graph(graph_file, scheduler->graph);
+
+        if (pcmk_is_set(flags, pcmk_sched_output_scores)) {
+            GPtrArray *expected = read_scores(scores_file);
+            GPtrArray *scores = read_scores(engine->scores_file);
+
+            if ((expected == NULL) || (scores == NULL)) {
+                result->flags |= pcmk__replay_error;
+            } else if (!scores_equal(expected, scores)) {
+                result->flags |= pcmk__replay_scores_changed;
+            }
+            if (expected != NULL) {
+                g_ptr_array_free(expected, TRUE);
+            }
+            if (scores != NULL) {
+                g_ptr_array_free(scores, TRUE);
+            }
+        }
+    }
+
+    // This frees cib, the graph, and the effective date
+    pe_reset_working_set(scheduler);
+
+done:
+    result->duration = (guint64) (g_get_monotonic_time() - start);
+    free(input_file);
+    free(graph_file);
+    free(scores_file);
+}
+
+static bool
+write_all(int fd, const char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t rc = write(fd, buf, len);
+
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        buf += rc;
+        len -= rc;
+    }
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Replay inputs requested by the parent until told to stop
+ *
+ * Each request is an input index on its own line. Each reply is a line with
+ * the index, result flags, and wall and processor times. The worker exits
+ * when the parent closes its end of the request pipe.
+ *
+ * \param[in,out] ctx         Replay context
+ * \param[in]     request_fd  Pipe to read requests from
+ * \param[in]     result_fd   Pipe to write results to
+ */
+static _Noreturn void
+worker_main(struct replay_context *ctx, int request_fd, int result_fd)
+{
+    struct replay_engine *engine = engine_new();
+    FILE *requests = fdopen(request_fd, "r");
+    int index = 0;
+
+    if (requests == NULL) {
+        _exit(CRM_EX_ERROR);
+    }
+
+    while (fscanf(requests, "%d", &index) == 1) {
+        pcmk__replay_result_t *result = NULL;
+        char *line = NULL;
+        bool ok = false;
+
+        if ((index < 0) || (index >= (int) ctx->inputs->len)) {
+            break;
+        }
+        result = &(ctx->results[index]);
+        if (engine == NULL) {
+            result->flags |= pcmk__replay_error;
+        } else {
+            replay_input(ctx, engine, index);
+        }
+
+        line = crm_strdup_printf("%d %" PRIu32 " %" G_GUINT64_FORMAT
+                                 " %lld %lld %lld\n",
+                                 index, result->flags, result->duration,
+                                 (long long) result->timings.unpack,
+                                 (long long) result->timings.schedule,
+                                 (long long) result->timings.graph);
+        ok = write_all(result_fd, line, strlen(line));
+        free(line);
+        if (!ok) {
+            break;
+        }
+    }
+
+    engine_free(engine);
+    fclose(requests);
+    close(result_fd);
+    _exit(CRM_EX_OK);
+}
+
+static void
+worker_close(struct replay_worker *worker)
+{
+    if (worker->request_fd >= 0) {
+        close(worker->request_fd);
+        worker->request_fd = -1;
+    }
+    if (worker->result_fd >= 0) {
+        close(worker->result_fd);
+        worker->result_fd = -1;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Fork a new worker process
+ *
+ * \param[in,out] ctx      Replay context
+ * \param[in,out] workers  All worker slots
+ * \param[in]     jobs     Number of worker slots
+ * \param[in,out] worker   Worker slot to start
+ *
+ * \return \c true if the worker was started, otherwise \c false
+ */
+static bool
+worker_start(struct replay_context *ctx, struct replay_worker *workers,
+             int jobs, struct replay_worker *worker)
+{
+    int request[2] = { -1, -1 };
+    int result[2] = { -1, -1 };
+    pid_t pid = 0;
+
+    if (pipe(request) < 0) {
+        crm_err("Could not create replay worker pipe: %s", strerror(errno));
+        return false;
+    }
+    if (pipe(result) < 0) {
+        crm_err("Could not create replay worker pipe: %s", strerror(errno));
+        close(request[0]);
+        close(request[1]);
+        return false;
+    }
+
+    pid = fork();
+    if (pid < 0) {
+        crm_err("Could not start replay worker: %s", strerror(errno));
+        close(request[0]);
+        close(request[1]);
+        close(result[0]);
+        close(result[1]);
+        return false;
+    }
+
+    if (pid == 0) {
+        close(request[1]);
+        close(result[0]);
+        for (int i = 0; i < jobs; i++) {
+            worker_close(&workers[i]);
+        }
+        worker_main(ctx, request[0], result[1]);
+    }
+
+    close(request[0]);
+    close(result[1]);
+    worker->pid = pid;
+    worker->request_fd = request[1];
+    worker->result_fd = result[0];
+    worker->input = -1;
+    g_string_truncate(worker->pending, 0);
+    return true;
+}
+
+static void
+worker_assign(struct replay_worker *worker, int index)
+{
+    char *line = crm_strdup_printf("%d\n", index);
+
+    worker->input = index;
+
+    /* If this fails, the worker has exited, and the input will be marked
+     * as failed when the end of its result pipe is reached
+     */
+    write_all(worker->request_fd, line, strlen(line));
+    free(line);
+}
+
+/*!
+ * \internal
+ * \brief Record all complete result lines received from a worker
+ *
+ * \param[in,out] ctx     Replay context
+ * \param[in,out] worker  Worker whose pending output to process
+ *
+ * \return \c true if the worker has finished its assigned input, otherwise
+ *         \c false
+ */
+static bool
+worker_process_results(struct replay_context *ctx,
+                       struct replay_worker *worker)
+{
+    bool finished = false;
+    char *end = NULL;
+
+    while ((end = strchr(worker->pending->str, '\n')) != NULL) {
+        int index = -1;
+        uint32_t flags = pcmk__replay_none;
+        guint64 duration = 0;
+        long long unpack = 0;
+        long long schedule = 0;
+        long long graph = 0;
+
+        *end = '\0';
+        if ((sscanf(worker->pending->str,
+                    "%d %" SCNu32 " %" G_GUINT64_FORMAT " %lld %lld %lld",
+                    &index, &flags, &duration, &unpack, &schedule,
+                    &graph) == 6)
+            && (index == worker->input)) {
+
+            pcmk__replay_result_t *result = &(ctx->results[index]);
+
+            result->flags = flags;
+            result->duration = duration;
+            result->timings.unpack = (clock_t) unpack;
+            result->timings.schedule = (clock_t) schedule;
+            result->timings.graph = (clock_t) graph;
+            worker->input = -1;
+            finished = true;
+        }
+        g_string_erase(worker->pending, 0, end - worker->pending->str + 1);
+    }
+    return finished;
+}
+
+/*!
+ * \internal
+ * \brief Replay inputs using a pool of worker processes
+ *
+ * \param[in,out] ctx   Replay context
+ * \param[in]     next  Index of first input to replay
+ * \param[in]     jobs  Maximum number of worker processes
+ *
+ * \return Index of first input that has not been replayed (which will be the
+ *         number of inputs unless workers could not be started)
+ */
+static int
+replay_in_workers(struct replay_context *ctx, int next, int jobs)
+{
+    const int n_inputs = (int) ctx->inputs->len;
+    struct replay_worker *workers = NULL;
+    struct pollfd *fds = NULL;
+    void (*old_sigpipe)(int) = NULL;
+    int active = 0;
+
+    jobs = QB_MIN(jobs, n_inputs - next);
+    workers = pcmk__assert_alloc(jobs, sizeof(struct replay_worker));
+    fds = pcmk__assert_alloc(jobs, sizeof(struct pollfd));
+    for (int i = 0; i < jobs; i++) {
+        workers[i].request_fd = -1;
+        workers[i].result_fd = -1;
+        workers[i].input = -1;
+        workers[i].pending = g_string_sized_new(128);
+    }
+
+    // A worker might exit while we're writing it a request
+    old_sigpipe = signal(SIGPIPE, SIG_IGN);
+
+    // Don't let workers inherit unflushed output
+    fflush(NULL);
+
+    for (int i = 0; i < jobs; i++) {
+        if (!worker_start(ctx, workers, jobs, &workers[i])) {
+            break;
+        }
+        worker_assign(&workers[i], next++);
+        active++;
+    }
+
+    while (active > 0) {
+        int n_fds = 0;
+
+        for (int i = 0; i < jobs; i++) {
+            if (workers[i].result_fd >= 0) {
+                fds[n_fds].fd = workers[i].result_fd;
+                fds[n_fds].events = POLLIN;
+                fds[n_fds].revents = 0;
+                n_fds++;
+            }
+        }
+        if (poll(fds, n_fds, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            crm_err("Could not wait for replay workers: %s", strerror(errno));
+            break;
+        }
+
+        for (int i = 0, f = 0; i < jobs; i++) {
+            struct replay_worker *worker = &workers[i];
+            char buf[1024];
+            ssize_t rc = 0;
+
+            if (worker->result_fd < 0) {
+                continue;
+            }
+            if (fds[f++].revents == 0) {
+                continue;
+            }
+
+            rc = read(worker->result_fd, buf, sizeof(buf));
+            if ((rc < 0) && ((errno == EINTR) || (errno == EAGAIN))) {
+                continue;
+            }
+
+            if (rc > 0) {
+                g_string_append_len(worker->pending, buf, rc);
+                if (!worker_process_results(ctx, worker)) {
+                    continue;
+                }
+                if (next < n_inputs) {
+                    worker_assign(worker, next++);
+                } else {
+                    // Closing the request pipe tells the worker to exit
+                    close(worker->request_fd);
+                    worker->request_fd = -1;
+                }
+                continue;
+            }
+
+            // Worker exited (or its pipe broke)
+            if (worker->input >= 0) {
+                pcmk__replay_result_t *result = &(ctx->results[worker->input]);
+
+                crm_err("Replay worker %lld crashed while replaying %s",
+                        (long long) worker->pid, result->name);
+                result->flags |= pcmk__replay_error;
+                worker->input = -1;
+            }
+            worker_close(worker);
+            waitpid(worker->pid, NULL, 0);
+            active--;
+
+            if ((next < n_inputs) && worker_start(ctx, workers, jobs, worker)) {
+                worker_assign(worker, next++);
+                active++;
+            }
+        }
+    }
+
+    for (int i = 0; i < jobs; i++) {
+        if (workers[i].result_fd >= 0) {
+            worker_close(&workers[i]);
+            waitpid(workers[i].pid, NULL, 0);
+        }
+        g_string_free(workers[i].pending, TRUE);
+    }
+    signal(SIGPIPE, old_sigpipe);
+    free(workers);
+    free(fds);
+    return next;
+}
+
+/*!
+ * \internal
+ * \brief List the scheduler inputs in a directory
+ *
+ * \param[in]  dir     Directory to search
+ * \param[out] inputs  Where to store newly allocated array of input file names
+ *                     (sorted alphabetically)
+ *
+ * \return Standard Pacemaker return code
+ */
+static int
+list_inputs(const char *dir, GPtrArray **inputs)
+{
+    struct dirent **namelist = NULL;
+    int file_num = scandir(dir, &namelist, 0, alphasort);
+
+    if (file_num < 0) {
+        return errno;
+    }
+
+    *inputs = g_ptr_array_new_with_free_func(free);
+    for (int i = 0; i < file_num; i++) {
+        const char *name = namelist[i]->d_name;
+
+        if ((name[0] != '.')
+            && (pcmk__ends_with_ext(name, ".xml")
+                || pcmk__ends_with(name, ".xml.bz2"))) {
+
+            char *path = crm_strdup_printf("%s/%s", dir, name);
+            struct stat sb;
+
+            if ((stat(path, &sb) == 0) && S_ISREG(sb.st_mode)) {
+                g_ptr_array_add(*inputs, pcmk__str_copy(name));
+            }
+            free(path);
+        }
+        free(namelist[i]);
+    }
+    free(namelist);
+    return pcmk_rc_ok;
+}
+
+// Input file name without .xml or .xml.bz2
+static char *
+input_base_name(const char *filename)
+{
+    char *base = pcmk__str_copy(filename);
+    char *ext = NULL;
+
+    if (pcmk__ends_with_ext(base, ".bz2")) {
+        *strrchr(base, '.') = '\0';
+    }
+    ext = strrchr(base, '.');
+    if (ext != NULL) {
+        *ext = '\0';
+    }
+    return base;
+}
+
+int
+pcmk__replay_dir(pcmk__output_t *out, const char *input_dir,
+                 const char *expected_dir, bool update, int jobs,
+                 unsigned long long flags, const char *use_date)
+{
+    struct replay_context ctx = {
+        .input_dir = input_dir,
+        .expected_dir = pcmk__s(expected_dir, input_dir),
+        .update = update,
+        .flags = flags,
+        .use_date = use_date,
+    };
+    struct replay_engine *engine = NULL;
+    gint64 start = g_get_monotonic_time();
+    int n_inputs = 0;
+    int next = 0;
+    int failed = 0;
+    int rc = pcmk_rc_ok;
+
+    CRM_ASSERT((out != NULL) && (input_dir != NULL));
+
+    rc = list_inputs(input_dir, &ctx.inputs);
+    if (rc != pcmk_rc_ok) {
+        out->err(out, "Could not list scheduler inputs in %s: %s",
+                 input_dir, pcmk_rc_str(rc));
+        return rc;
+    }
+    n_inputs = (int) ctx.inputs->len;
+    if (n_inputs == 0) {
+        out->err(out, "No scheduler inputs found in %s", input_dir);
+        g_ptr_array_free(ctx.inputs, TRUE);
+        return pcmk_rc_no_input;
+    }
+
+    if (jobs <= 0) {
+        long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+        jobs = (n_cpus > 0)? (int) n_cpus : 1;
+    }
+
+    engine = engine_new();
+    if (engine == NULL) {
+        out->err(out, "Could not initialize scheduler for replay");
+        g_ptr_array_free(ctx.inputs, TRUE);
+        return pcmk_rc_error;
+    }
+
+    ctx.results = pcmk__assert_alloc(n_inputs, sizeof(pcmk__replay_result_t));
+    for (int i = 0; i < n_inputs; i++) {
+        ctx.results[i].name = input_base_name(g_ptr_array_index(ctx.inputs,
+                                                                i));
+    }
+
+    /* Replay the first input here, so that the schemas it needs are loaded
+     * before any workers are forked
+     */
+    replay_input(&ctx, engine, next++);
+
+    if ((jobs > 1) && (next < n_inputs)) {
+        next = replay_in_workers(&ctx, next, jobs);
+    }
+
+    // Replay anything left over (if workers were not used or not available)
+    while (next < n_inputs) {
+        replay_input(&ctx, engine, next++);
+    }
+    engine_free(engine);
+
+    out->begin_list(out, NULL, NULL, "Replays");
+    for (int i = 0; i < n_inputs; i++) {
+        if (pcmk_any_flags_set(ctx.results[i].flags, REPLAY_FAILED)) {
+            failed++;
+        }
+        out->message(out, "replay-result", &(ctx.results[i]));
+    }
+    out->end_list(out);
+
+    out->message(out, "replay-summary", ctx.results, n_inputs, failed, jobs,
+                 (guint64) (g_get_monotonic_time() - start));
+
+    for (int i = 0; i < n_inputs; i++) {
+        free(ctx.results[i].name);
+    }
+    free(ctx.results);
+    g_ptr_array_free(ctx.inputs, TRUE);
+    return (failed > 0)? pcmk_rc_error : pcmk_rc_ok;
+}
@@ -1378,7 +1378,7 @@ pcmk__deduplicate_action_inputs(pcmk_action_t *action)
                 last_input->state = pe_link_dumped;
             }
 
-            free(item->data);
+            pcmk__sched_free(action->scheduler, item->data);
             action->actions_before = g_list_delete_link(action->actions_before,
                                                         item);
         } else {
@@ -1866,8 +1866,8 @@ process_node_history(pcmk_node_t *node, const xmlNode *lrm_rscs)
          rsc_entry != NULL; rsc_entry = pcmk__xe_next_same(rsc_entry)) {
 
         if (rsc_entry->children != NULL) {
-            GList *result = pcmk__rscs_matching_id(pcmk__xe_id(rsc_entry),
-                                                   node->details->data_set);
+            GList *result = pe__rscs_with_id(node->details->data_set,
+                                             pcmk__xe_id(rsc_entry));
 
             for (GList *iter = result; iter != NULL; iter = iter->next) {
                 pcmk_resource_t *rsc = (pcmk_resource_t *) iter->data;
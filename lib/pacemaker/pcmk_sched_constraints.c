@@ -109,25 +109,20 @@ pcmk__unpack_constraints(pcmk_scheduler_t *scheduler)
 pcmk_resource_t *
 pcmk__find_constraint_resource(GList *rsc_list, const char *id)
 {
+    pcmk_resource_t *match = NULL;
+
     if (id == NULL) {
         return NULL;
     }
-    for (GList *iter = rsc_list; iter != NULL; iter = iter->next) {
-        pcmk_resource_t *parent = iter->data;
-        pcmk_resource_t *match = parent->fns->find_rsc(parent, id, NULL,
-                                                       pcmk_rsc_match_history);
-
-        if (match != NULL) {
-            if (!pcmk__str_eq(match->id, id, pcmk__str_none)) {
-                /* We found an instance of a clone instead */
-                match = uber_parent(match);
-                crm_debug("Found %s for %s", match->id, id);
-            }
-            return match;
-        }
+
+    // This uses the scheduler's resource index when rsc_list is all resources
+    match = pe_find_resource_with_flags(rsc_list, id, pcmk_rsc_match_history);
+    if ((match != NULL) && !pcmk__str_eq(match->id, id, pcmk__str_none)) {
+        /* We found an instance of a clone instead */
+        match = uber_parent(match);
+        crm_debug("Found %s for %s", match->id, id);
     }
-    crm_trace("No match for %s", id);
-    return NULL;
+    return match;
 }
 
 /*!
@@ -1113,6 +1113,70 @@ pcmk__instance_matches(const pcmk_resource_t *instance, const pcmk_node_t *node,
     return true;
 }
 
+/*!
+ * \internal
+ * \brief Get (building if needed) a node index of a collective's instances
+ *
+ * Interleaving looks up instances by node for every pair of instances in an
+ * ordering, so rather than walk all instances for each lookup, index them by
+ * node once. The index of assigned nodes is discarded whenever an assignment
+ * changes, so it is always consistent with the instances' locations.
+ *
+ * \param[in] rsc      Clone or bundle resource
+ * \param[in] current  If true, index instances' current node, otherwise
+ *                     index assigned next node
+ *
+ * \return Table mapping node details to GPtrArray of \p rsc's instances (or
+ *         bundle replica containers) located on that node, in instance order,
+ *         or NULL if the scheduler data cannot hold indexes
+ */
+static GHashTable *
+instances_by_node(const pcmk_resource_t *rsc, bool current)
+{
+    GHashTable *indexes = NULL;
+    GHashTable *index = NULL;
+    GList *instances = NULL;
+
+    if (rsc->cluster->internal == NULL) {
+        return NULL;
+    }
+
+    if (current) {
+        indexes = rsc->cluster->internal->current_instances;
+    } else {
+        indexes = rsc->cluster->internal->next_instances;
+    }
+
+    index = g_hash_table_lookup(indexes, rsc);
+    if (index != NULL) {
+        return index;
+    }
+
+    index = g_hash_table_new_full(NULL, NULL, NULL,
+                                  (GDestroyNotify) g_ptr_array_unref);
+    instances = get_instance_list(rsc);
+    for (GList *iter = instances; iter != NULL; iter = iter->next) {
+        pcmk_resource_t *instance = (pcmk_resource_t *) iter->data;
+        pcmk_node_t *node = instance->fns->location(instance, NULL, current);
+        GPtrArray *on_node = NULL;
+
+        if (node == NULL) {
+            continue; // Can't be compatible with any node
+        }
+
+        on_node = g_hash_table_lookup(index, node->details);
+        if (on_node == NULL) {
+            on_node = g_ptr_array_new();
+            g_hash_table_insert(index, node->details, on_node);
+        }
+        g_ptr_array_add(on_node, instance);
+    }
+    free_instance_list(rsc, instances);
+
+    g_hash_table_insert(indexes, (gpointer) rsc, index);
+    return index;
+}
+
 #define display_role(r) \
     (((r) == pcmk_role_unknown)? "matching" : pcmk_role_text(r))
 
@@ -1135,22 +1199,39 @@ find_compatible_instance_on_node(const pcmk_resource_t *match_rsc,
                                  const pcmk_node_t *node, enum rsc_role_e role,
                                  bool current)
 {
-    GList *instances = NULL;
+    pcmk_resource_t *instance = NULL;
+    GHashTable *index = instances_by_node(rsc, current);
 
-    instances = get_instance_list(rsc);
-    for (GList *iter = instances; iter != NULL; iter = iter->next) {
-        pcmk_resource_t *instance = (pcmk_resource_t *) iter->data;
+    if (index != NULL) {
+        GPtrArray *on_node = g_hash_table_lookup(index, node->details);
+
+        for (guint i = 0; (on_node != NULL) && (i < on_node->len); i++) {
+            if (pcmk__instance_matches(g_ptr_array_index(on_node, i), node,
+                                       role, current)) {
+                instance = g_ptr_array_index(on_node, i);
+                break;
+            }
+        }
+
+    } else {
+        GList *instances = get_instance_list(rsc);
 
-        if (pcmk__instance_matches(instance, node, role, current)) {
-            pcmk__rsc_trace(match_rsc,
-                            "Found %s %s instance %s compatible with %s on %s",
-                            display_role(role), rsc->id, instance->id,
-                            match_rsc->id, pcmk__node_name(node));
-            free_instance_list(rsc, instances); // Only frees list, not contents
-            return instance;
+        for (GList *iter = instances; iter != NULL; iter = iter->next) {
+            if (pcmk__instance_matches(iter->data, node, role, current)) {
+                instance = iter->data;
+                break;
+            }
         }
+        free_instance_list(rsc, instances); // Only frees list, not contents
+    }
+
+    if (instance != NULL) {
+        pcmk__rsc_trace(match_rsc,
+                        "Found %s %s instance %s compatible with %s on %s",
+                        display_role(role), rsc->id, instance->id,
+                        match_rsc->id, pcmk__node_name(node));
+        return instance;
     }
-    free_instance_list(rsc, instances);
 
     pcmk__rsc_trace(match_rsc,
                     "No %s %s instance found compatible with %s on %s",
@@ -1178,6 +1259,7 @@ pcmk__find_compatible_instance(const pcmk_resource_t *match_rsc,
                                bool current)
 {
     pcmk_resource_t *instance = NULL;
+    GHashTable *index = NULL;
     GList *nodes = NULL;
     const pcmk_node_t *node = NULL;
 
@@ -1188,7 +1270,16 @@ pcmk__find_compatible_instance(const pcmk_resource_t *match_rsc,
                                                 current);
     }
 
-    // Otherwise check for an instance matching any of match_rsc's allowed nodes
+    /* Otherwise check for an instance matching any of match_rsc's allowed
+     * nodes (unless no instance is on any node, which is common enough when
+     * nothing is active yet to be worth not sorting the nodes)
+     */
+    index = instances_by_node(rsc, current);
+    if ((index != NULL) && (g_hash_table_size(index) == 0)) {
+        pcmk__rsc_debug(rsc, "No %s instance found compatible with %s",
+                        rsc->id, match_rsc->id);
+        return NULL;
+    }
     nodes = pcmk__sort_nodes(g_hash_table_get_values(match_rsc->allowed_nodes),
                              NULL);
     for (GList *iter = nodes; (iter != NULL) && (instance == NULL);
@@ -143,55 +143,6 @@ pcmk__rsc_agent_changed(pcmk_resource_t *rsc, pcmk_node_t *node,
     return changed;
 }
 
-/*!
- * \internal
- * \brief Add resource (and any matching children) to list if it matches ID
- *
- * \param[in] result  List to add resource to
- * \param[in] rsc     Resource to check
- * \param[in] id      ID to match
- *
- * \return (Possibly new) head of list
- */
-static GList *
-add_rsc_if_matching(GList *result, pcmk_resource_t *rsc, const char *id)
-{
-    if ((strcmp(rsc->id, id) == 0)
-        || ((rsc->clone_name != NULL) && (strcmp(rsc->clone_name, id) == 0))) {
-        result = g_list_prepend(result, rsc);
-    }
-    for (GList *iter = rsc->children; iter != NULL; iter = iter->next) {
-        pcmk_resource_t *child = (pcmk_resource_t *) iter->data;
-
-        result = add_rsc_if_matching(result, child, id);
-    }
-    return result;
-}
-
-/*!
- * \internal
- * \brief Find all resources matching a given ID by either ID or clone name
- *
- * \param[in] id         Resource ID to check
- * \param[in] scheduler  Scheduler data
- *
- * \return List of all resources that match \p id
- * \note The caller is responsible for freeing the return value with
- *       g_list_free().
- */
-GList *
-pcmk__rscs_matching_id(const char *id, const pcmk_scheduler_t *scheduler)
-{
-    GList *result = NULL;
-
-    CRM_CHECK((id != NULL) && (scheduler != NULL), return NULL);
-    for (GList *iter = scheduler->resources; iter != NULL; iter = iter->next) {
-        result = add_rsc_if_matching(result, (pcmk_resource_t *) iter->data,
-                                     id);
-    }
-    return result;
-}
-
 /*!
  * \internal
  * \brief Set the variant-appropriate assignment methods for a resource
@@ -496,6 +447,7 @@ pcmk__assign_resource(pcmk_resource_t *rsc, pcmk_node_t *node, bool force,
 
     pcmk__rsc_debug(rsc, "Assigning %s to %s", rsc->id, pcmk__node_name(node));
     rsc->allocated_to = pe__copy_node(node);
+    pcmk__sched_assignment_changed(rsc->cluster);
 
     add_assigned_resource(node, rsc);
     node->details->num_resources++;
@@ -539,6 +491,7 @@ pcmk__unassign_resource(pcmk_resource_t *rsc)
             return;
         }
         rsc->allocated_to = NULL;
+        pcmk__sched_assignment_changed(rsc->cluster);
 
         /* We're going to free the pcmk_node_t, but its details member is shared
          * and will remain, so update that appropriately first.
@@ -401,7 +401,7 @@ new_load_stopped_op(pcmk_node_t *node)
                                               node->details->data_set);
 
     if (load_stopped->node == NULL) {
-        load_stopped->node = pe__copy_node(node);
+        load_stopped->node = pe__copy_action_node(load_stopped, node);
         pcmk__clear_action_flags(load_stopped, pcmk_action_optional);
     }
     free(load_stopped_task);
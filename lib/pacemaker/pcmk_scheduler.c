@@ -773,22 +773,34 @@ unpack_cib(xmlNode *cib, unsigned long long flags, pcmk_scheduler_t *scheduler)
 
 /*!
  * \internal
- * \brief Run the scheduler for a given CIB
+ * \brief Run the scheduler for a given CIB, recording time spent in each phase
  *
  * \param[in,out] cib        CIB XML to use as scheduler input
  * \param[in]     flags      Scheduler flags to set in addition to defaults
  * \param[in,out] scheduler  Scheduler data
+ * \param[in,out] timings    If not NULL, add processor time used by each
+ *                           scheduler phase to this
  */
 void
-pcmk__schedule_actions(xmlNode *cib, unsigned long long flags,
-                       pcmk_scheduler_t *scheduler)
+pcmk__schedule_actions_timed(xmlNode *cib, unsigned long long flags,
+                             pcmk_scheduler_t *scheduler,
+                             pcmk__sched_timings_t *timings)
 {
+    clock_t start = (timings == NULL)? 0 : clock();
+
     unpack_cib(cib, flags, scheduler);
+    if (timings != NULL) {
+        clock_t now = clock();
+
+        timings->unpack += now - start;
+        start = now;
+    }
+
     pcmk__set_assignment_methods(scheduler);
     pcmk__apply_node_health(scheduler);
     pcmk__unpack_constraints(scheduler);
     if (pcmk_is_set(scheduler->flags, pcmk_sched_validate_only)) {
-        return;
+        goto done;
     }
 
     if (!pcmk_is_set(scheduler->flags, pcmk_sched_location_only)
@@ -799,7 +811,7 @@ pcmk__schedule_actions(xmlNode *cib, unsigned long long flags,
     apply_node_criteria(scheduler);
 
     if (pcmk_is_set(scheduler->flags, pcmk_sched_location_only)) {
-        return;
+        goto done;
     }
 
     pcmk__create_internal_constraints(scheduler);
@@ -815,11 +827,44 @@ pcmk__schedule_actions(xmlNode *cib, unsigned long long flags,
     schedule_fencing_and_shutdowns(scheduler);
     pcmk__apply_orderings(scheduler);
     log_all_actions(scheduler);
+
+    if (timings != NULL) {
+        clock_t now = clock();
+
+        timings->schedule += now - start;
+        start = now;
+    }
+
     pcmk__create_graph(scheduler);
 
+    if (timings != NULL) {
+        timings->graph += clock() - start;
+    }
+
     if (get_crm_log_level() == LOG_TRACE) {
         log_unrunnable_actions(scheduler);
     }
+    return;
+
+done:
+    if (timings != NULL) {
+        timings->schedule += clock() - start;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Run the scheduler for a given CIB
+ *
+ * \param[in,out] cib        CIB XML to use as scheduler input
+ * \param[in]     flags      Scheduler flags to set in addition to defaults
+ * \param[in,out] scheduler  Scheduler data
+ */
+void
+pcmk__schedule_actions(xmlNode *cib, unsigned long long flags,
+                       pcmk_scheduler_t *scheduler)
+{
+    pcmk__schedule_actions_timed(cib, flags, scheduler, NULL);
 }
 
 /*!
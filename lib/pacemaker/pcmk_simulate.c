@@ -334,6 +334,7 @@ profile_file(const char *xml_file, long long repeat,
     xmlNode *cib_object = NULL;
     clock_t start = 0;
     clock_t end;
+    pcmk__sched_timings_t timings = { 0, };
     unsigned long long scheduler_flags = pcmk_sched_no_compat;
 
     CRM_ASSERT(out != NULL);
@@ -370,12 +371,13 @@ profile_file(const char *xml_file, long long repeat,
         }
         scheduler->input = input;
         set_effective_date(scheduler, false, use_date);
-        pcmk__schedule_actions(input, scheduler_flags, scheduler);
+        pcmk__schedule_actions_timed(input, scheduler_flags, scheduler,
+                                     &timings);
         pe_reset_working_set(scheduler);
     }
 
     end = clock();
-    out->message(out, "profile", xml_file, start, end);
+    out->message(out, "profile", xml_file, start, end, &timings);
 }
 
 void
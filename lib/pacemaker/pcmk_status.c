@@ -12,6 +12,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <time.h>
 
 #include <crm/cib/internal.h>
 #include <crm/common/output.h>
@@ -41,6 +42,618 @@ fencing_connect(void)
     }
 }
 
+/*!
+ * \internal
+ * \brief Mark the fencing history in a status cache as out of date
+ *
+ * \param[in,out] cache  Status cache
+ */
+void
+pcmk__status_cache_fencing_changed(pcmk__status_cache_t *cache)
+{
+    if (cache != NULL) {
+        stonith_history_free(cache->fence_history);
+        cache->fence_history = NULL;
+        cache->have_fence_history = false;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Free everything held by a status cache
+ *
+ * \param[in,out] cache  Status cache
+ */
+void
+pcmk__status_cache_clear(pcmk__status_cache_t *cache)
+{
+    if (cache != NULL) {
+        pcmk__status_cache_fencing_changed(cache);
+        pe_free_working_set(cache->scheduler);
+        cache->scheduler = NULL;
+        cache->have_constraints = false;
+        cache->status_changed = false;
+        g_clear_pointer(&(cache->attrs_changed), g_hash_table_destroy);
+        free_xml(cache->cib);
+        cache->cib = NULL;
+    }
+}
+
+/*!
+ * \internal
+ * \brief Check whether a CIB attribute records only who changed what
+ *
+ * \param[in] name  Attribute name
+ *
+ * \return true if \p name is a version or change-tracking attribute of the
+ *         CIB root or a node state entry, otherwise false
+ */
+static bool
+is_bookkeeping_attr(const char *name)
+{
+    return pcmk__str_any_of(name, PCMK_XA_ADMIN_EPOCH, PCMK_XA_EPOCH,
+                            PCMK_XA_NUM_UPDATES, PCMK_XA_CIB_LAST_WRITTEN,
+                            PCMK_XA_UPDATE_ORIGIN, PCMK_XA_UPDATE_CLIENT,
+                            PCMK_XA_UPDATE_USER, PCMK_XA_CRM_DEBUG_ORIGIN,
+                            NULL);
+}
+
+/*!
+ * \internal
+ * \brief Check whether a patchset modification changes only bookkeeping
+ *
+ * \param[in] change  \c PCMK_XE_CHANGE element with \c PCMK_VALUE_MODIFY
+ *
+ * \return true if every attribute that \p change sets or unsets is a version
+ *         or change-tracking attribute, otherwise false
+ */
+static bool
+only_bookkeeping_changed(const xmlNode *change)
+{
+    const xmlNode *list = pcmk__xe_first_child(change, PCMK_XE_CHANGE_LIST,
+                                               NULL, NULL);
+
+    if (list == NULL) {
+        return false;
+    }
+    for (const xmlNode *attr = pcmk__xe_first_child(list, PCMK_XE_CHANGE_ATTR,
+                                                    NULL, NULL);
+         attr != NULL; attr = pcmk__xe_next_same(attr)) {
+
+        if (!is_bookkeeping_attr(crm_element_value(attr, PCMK_XA_NAME))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Note what one change in a CIB patchset means for a status cache
+ *
+ * \param[in,out] cache   Status cache
+ * \param[in]     change  \c PCMK_XE_CHANGE element from a v2 patchset
+ *
+ * \return true if \p change can be applied to the cached CIB, or false if
+ *         it changes anything outside the CIB status section
+ */
+static bool
+note_patchset_change(pcmk__status_cache_t *cache, const xmlNode *change)
+{
+    const char *op = crm_element_value(change, PCMK_XA_OPERATION);
+    const char *path = crm_element_value(change, PCMK_XA_PATH);
+    char *node_id = NULL;
+    char *state_path = NULL;
+    bool transient = false;
+
+    if ((op == NULL) || (path == NULL)) {
+        return false;
+    }
+
+    if (pcmk__str_eq(path, "/" PCMK_XE_CIB, pcmk__str_none)
+        && pcmk__str_eq(op, PCMK_VALUE_MODIFY, pcmk__str_none)) {
+
+        // Quorum and DC changes affect the status, version changes don't
+        if (!only_bookkeeping_changed(change)) {
+            cache->status_changed = true;
+        }
+        return true;
+    }
+
+    if (!pcmk__starts_with(path, "/" PCMK_XE_CIB "/" PCMK_XE_STATUS)) {
+        return false;
+    }
+
+    node_id = pcmk__xpath_node_id(path, PCMK__XE_NODE_STATE);
+    if (node_id == NULL) {
+        cache->status_changed = true;   // For example, ticket state
+        return true;
+    }
+
+    state_path = crm_strdup_printf("/" PCMK_XE_CIB "/" PCMK_XE_STATUS
+                                   "/" PCMK__XE_NODE_STATE
+                                   "[@" PCMK_XA_ID "='%s']", node_id);
+
+    if (pcmk__starts_with(path, state_path)
+        && pcmk__starts_with(path + strlen(state_path),
+                             "/" PCMK__XE_TRANSIENT_ATTRIBUTES)) {
+        transient = true;
+
+    } else if (pcmk__str_eq(path, state_path, pcmk__str_none)) {
+        if (pcmk__str_eq(op, PCMK_VALUE_CREATE, pcmk__str_none)) {
+            const xmlNode *created = pcmk__xe_first_child(change, NULL, NULL,
+                                                          NULL);
+
+            transient = pcmk__xe_is(created, PCMK__XE_TRANSIENT_ATTRIBUTES);
+
+        } else if (pcmk__str_eq(op, PCMK_VALUE_MODIFY, pcmk__str_none)
+                   && only_bookkeeping_changed(change)) {
+            free(state_path);
+            free(node_id);
+            return true;
+        }
+    }
+    free(state_path);
+
+    if (transient) {
+        if (cache->attrs_changed == NULL) {
+            cache->attrs_changed = pcmk__strkey_table(free, NULL);
+        }
+        g_hash_table_add(cache->attrs_changed, node_id);
+    } else {
+        // Node membership or resource history
+        cache->status_changed = true;
+        free(node_id);
+    }
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Apply a CIB patchset to the CIB kept in a status cache
+ *
+ * A patchset that changes only the CIB status section is applied to the kept
+ * CIB, and what it changed is noted so that the next refresh can update the
+ * unpacked status in place where possible. Any other patchset makes the next
+ * refresh copy and upgrade the current CIB.
+ *
+ * \param[in,out] cache     Status cache
+ * \param[in]     patchset  CIB patchset that the caller applied to its CIB
+ */
+void
+pcmk__status_cache_patch(pcmk__status_cache_t *cache, xmlNode *patchset)
+{
+    int format = 1;
+    int rc = pcmk_ok;
+
+    if ((cache == NULL) || (cache->cib == NULL) || (patchset == NULL)) {
+        return;
+    }
+
+    crm_element_value_int(patchset, PCMK_XA_FORMAT, &format);
+    if (format != 2) {
+        goto invalidate;
+    }
+
+    for (const xmlNode *change = pcmk__xe_first_child(patchset, PCMK_XE_CHANGE,
+                                                      NULL, NULL);
+         change != NULL; change = pcmk__xe_next_same(change)) {
+
+        if (!note_patchset_change(cache, change)) {
+            goto invalidate;
+        }
+    }
+
+    rc = xml_apply_patchset(cache->cib, patchset, true);
+    if (rc != pcmk_ok) {
+        crm_debug("Discarding cached CIB: %s", pcmk_strerror(rc));
+        goto invalidate;
+    }
+    cib_version_details(cache->cib, &(cache->admin_epoch), &(cache->epoch),
+                        &(cache->num_updates));
+    return;
+
+invalidate:
+    free_xml(cache->cib);
+    cache->cib = NULL;
+}
+
+/*!
+ * \internal
+ * \brief Check whether a node attribute can affect how status is unpacked
+ *
+ * \param[in] name  Node attribute name
+ *
+ * \return true if unpacking the CIB status interprets \p name (rather than
+ *         just making it available), otherwise false
+ */
+static bool
+attr_affects_unpack(const char *name)
+{
+    if (pcmk__starts_with(name, "#")) {
+        // Built-in attributes, except health, which is evaluated when shown
+        return !pcmk__starts_with(name, "#health");
+    }
+    return pcmk__str_any_of(name, PCMK_NODE_ATTR_STANDBY,
+                            PCMK_NODE_ATTR_MAINTENANCE,
+                            PCMK_NODE_ATTR_TERMINATE,
+                            PCMK__NODE_ATTR_SHUTDOWN,
+                            PCMK__NODE_ATTR_RESOURCE_DISCOVERY_ENABLED,
+                            "site-name", NULL)
+           || pcmk__starts_with(name, PCMK__FAIL_COUNT_PREFIX)
+           || pcmk__starts_with(name, PCMK__LAST_FAILURE_PREFIX);
+}
+
+/*!
+ * \internal
+ * \brief Get the values in a node's transient attributes
+ *
+ * \param[in] state  Node's \c PCMK__XE_NODE_STATE entry (or NULL)
+ *
+ * \return Newly created table of attribute names and values (pointing into
+ *         \p state), or NULL if the attributes are not a single set of plain
+ *         name/value pairs
+ * \note The caller is responsible for freeing a non-NULL result with
+ *       \c g_hash_table_destroy().
+ */
+static GHashTable *
+transient_values(const xmlNode *state)
+{
+    GHashTable *values = pcmk__strkey_table(NULL, NULL);
+    const xmlNode *attrs = pcmk__xe_first_child(state,
+                                                PCMK__XE_TRANSIENT_ATTRIBUTES,
+                                                NULL, NULL);
+    const xmlNode *set = pcmk__xe_first_child(attrs, NULL, NULL, NULL);
+
+    if (set == NULL) {
+        return values;
+    }
+    if (!pcmk__xe_is(set, PCMK_XE_INSTANCE_ATTRIBUTES)
+        || (pcmk__xe_next(set) != NULL)) {
+        goto unsupported;
+    }
+
+    for (const xmlNode *nvpair = pcmk__xe_first_child(set, NULL, NULL, NULL);
+         nvpair != NULL; nvpair = pcmk__xe_next(nvpair)) {
+
+        const char *name = crm_element_value(nvpair, PCMK_XA_NAME);
+        const char *value = crm_element_value(nvpair, PCMK_XA_VALUE);
+
+        if (!pcmk__xe_is(nvpair, PCMK_XE_NVPAIR) || (name == NULL)
+            || (value == NULL) || g_hash_table_contains(values, name)) {
+            goto unsupported;
+        }
+        g_hash_table_insert(values, (gpointer) name, (gpointer) value);
+    }
+    return values;
+
+unsupported:
+    g_hash_table_destroy(values);
+    return NULL;
+}
+
+/*!
+ * \internal
+ * \brief Check whether a node's configuration sets a node attribute
+ *
+ * \param[in] scheduler  Scheduler data
+ * \param[in] node       Node to check
+ * \param[in] name       Node attribute name
+ *
+ * \return true if \p node's entry in the configuration has a name/value pair
+ *         for \p name, otherwise false
+ */
+static bool
+configured_attr(const pcmk_scheduler_t *scheduler, const pcmk_node_t *node,
+                const char *name)
+{
+    const xmlNode *nodes = pcmk_find_cib_element(scheduler->input,
+                                                 PCMK_XE_NODES);
+    const xmlNode *node_xml = pcmk__xe_first_child(nodes, PCMK_XE_NODE,
+                                                   PCMK_XA_ID,
+                                                   node->details->id);
+
+    for (const xmlNode *set = pcmk__xe_first_child(node_xml,
+                                                   PCMK_XE_INSTANCE_ATTRIBUTES,
+                                                   NULL, NULL);
+         set != NULL; set = pcmk__xe_next_same(set)) {
+
+        if (pcmk__xe_first_child(set, PCMK_XE_NVPAIR, PCMK_XA_NAME,
+                                 name) != NULL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+ * \internal
+ * \brief Forget resource parameters evaluated for a node
+ *
+ * \param[in,out] resources  Resources to check (including their children)
+ * \param[in]     node       Node whose parameters should be forgotten
+ */
+static void
+forget_node_params(GList *resources, const pcmk_node_t *node)
+{
+    for (GList *iter = resources; iter != NULL; iter = iter->next) {
+        pcmk_resource_t *rsc = iter->data;
+
+        if (rsc->parameter_cache != NULL) {
+            g_hash_table_remove(rsc->parameter_cache, node->details->uname);
+        }
+        forget_node_params(rsc->children, node);
+    }
+}
+
+/*!
+ * \internal
+ * \brief Update a node's unpacked attributes from its transient attributes
+ *
+ * \param[in,out] scheduler  Unpacked scheduler data
+ * \param[in]     node_id    ID of node whose transient attributes changed
+ * \param[in]     new_cib    CIB with the node's new transient attributes
+ * \param[in]     apply      If false, only check whether the update is possible
+ *
+ * \return true if the node's attributes could be (and, if \p apply is true,
+ *         were) updated in place, or false if the status must be unpacked again
+ */
+static bool
+update_node_attrs(pcmk_scheduler_t *scheduler, const char *node_id,
+                  xmlNode *new_cib, bool apply)
+{
+    xmlNode *old_status = pcmk_find_cib_element(scheduler->input,
+                                                PCMK_XE_STATUS);
+    xmlNode *new_status = pcmk_find_cib_element(new_cib, PCMK_XE_STATUS);
+    xmlNode *old_state = pcmk__xe_first_child(old_status, PCMK__XE_NODE_STATE,
+                                              PCMK_XA_ID, node_id);
+    xmlNode *new_state = pcmk__xe_first_child(new_status, PCMK__XE_NODE_STATE,
+                                              PCMK_XA_ID, node_id);
+    pcmk_node_t *node = NULL;
+    GHashTable *old_values = NULL;
+    GHashTable *new_values = NULL;
+    GHashTableIter iter;
+    const char *name = NULL;
+    const char *value = NULL;
+    bool possible = false;
+
+    if ((old_state == NULL) || (new_state == NULL)) {
+        return false;
+    }
+
+    node = pe_find_node_any(scheduler->nodes, node_id,
+                            crm_element_value(new_state, PCMK_XA_UNAME));
+    if ((node == NULL)
+        || (pcmk__is_pacemaker_remote_node(node) && !node->details->unpacked)) {
+        // Unpacking doesn't use these attributes, so there's nothing to update
+        possible = true;
+        goto done;
+    }
+
+    old_values = transient_values(old_state);
+    new_values = transient_values(new_state);
+    if ((old_values == NULL) || (new_values == NULL)) {
+        goto done;
+    }
+
+    // Removed or changed values
+    g_hash_table_iter_init(&iter, old_values);
+    while (g_hash_table_iter_next(&iter, (gpointer *) &name,
+                                  (gpointer *) &value)) {
+        const char *new_value = g_hash_table_lookup(new_values, name);
+
+        if (pcmk__str_eq(value, new_value, pcmk__str_none)) {
+            continue;
+        }
+        if (attr_affects_unpack(name)
+            || ((new_value == NULL)
+                && configured_attr(scheduler, node, name))) {
+            goto done;
+        }
+        if (apply && (new_value == NULL)) {
+            g_hash_table_remove(node->details->attrs, name);
+        } else if (apply) {
+            pcmk__insert_dup(node->details->attrs, name, new_value);
+        }
+    }
+
+    // Added values
+    g_hash_table_iter_init(&iter, new_values);
+    while (g_hash_table_iter_next(&iter, (gpointer *) &name,
+                                  (gpointer *) &value)) {
+        if (g_hash_table_contains(old_values, name)) {
+            continue;
+        }
+        if (attr_affects_unpack(name)) {
+            goto done;
+        }
+        if (apply) {
+            pcmk__insert_dup(node->details->attrs, name, value);
+        }
+    }
+
+    if (apply) {
+        // Resource parameters and digests may depend on node attributes
+        forget_node_params(scheduler->resources, node);
+        if (node->details->digest_cache != NULL) {
+            g_hash_table_remove_all(node->details->digest_cache);
+        }
+    }
+    possible = true;
+
+done:
+    if (possible && apply) {
+        // Keep the scheduler input consistent with what was unpacked
+        xmlNode *old_attrs = pcmk__xe_first_child(old_state,
+                                                  PCMK__XE_TRANSIENT_ATTRIBUTES,
+                                                  NULL, NULL);
+        xmlNode *new_attrs = pcmk__xe_first_child(new_state,
+                                                  PCMK__XE_TRANSIENT_ATTRIBUTES,
+                                                  NULL, NULL);
+
+        free_xml(old_attrs);
+        if (new_attrs != NULL) {
+            pcmk__xml_copy(old_state, new_attrs);
+        }
+    }
+    if (old_values != NULL) {
+        g_hash_table_destroy(old_values);
+    }
+    if (new_values != NULL) {
+        g_hash_table_destroy(new_values);
+    }
+    return possible;
+}
+
+/*!
+ * \internal
+ * \brief Check whether any resource's shutdown lock has expired
+ *
+ * \param[in] resources  Resources to check (including their children)
+ * \param[in] now        Current time
+ *
+ * \return true if a shutdown lock unpacked for any of \p resources has expired
+ *         by \p now, otherwise false
+ * \note Unpacking doesn't record lock expiration as a recheck time (the
+ *       scheduler does that later), so it's checked separately here.
+ */
+static bool
+shutdown_lock_expired(const GList *resources, time_t now)
+{
+    for (const GList *iter = resources; iter != NULL; iter = iter->next) {
+        const pcmk_resource_t *rsc = iter->data;
+
+        if ((rsc->lock_node != NULL) && (rsc->cluster->shutdown_lock > 0)
+            && (now > (rsc->lock_time + rsc->cluster->shutdown_lock))) {
+            return true;
+        }
+        if (shutdown_lock_expired(rsc->children, now)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+ * \internal
+ * \brief Bring a status cache's unpacked status up to date without unpacking
+ *
+ * \param[in,out] cache  Status cache whose CIB is current
+ *
+ * \return true if the unpacked status is now current, or false if the CIB must
+ *         be unpacked again
+ */
+static bool
+update_status_in_place(pcmk__status_cache_t *cache)
+{
+    pcmk_scheduler_t *scheduler = cache->scheduler;
+    time_t now = 0;
+
+    if ((scheduler == NULL) || cache->status_changed) {
+        return false;
+    }
+
+    /* Anything evaluated against the current time (failure timeouts, time-based
+     * rules, and so forth) is current until the scheduler's recheck time
+     */
+    now = time(NULL);
+    if (((scheduler->recheck_by > 0) && (now >= scheduler->recheck_by))
+        || shutdown_lock_expired(scheduler->resources, now)) {
+        crm_trace("Unpacking CIB again because recheck time has passed");
+        return false;
+    }
+
+    if (cache->attrs_changed != NULL) {
+        GHashTableIter iter;
+        const char *node_id = NULL;
+
+        // Location constraint rules may have been evaluated with the old values
+        if (cache->have_constraints) {
+            return false;
+        }
+
+        g_hash_table_iter_init(&iter, cache->attrs_changed);
+        while (g_hash_table_iter_next(&iter, (gpointer *) &node_id, NULL)) {
+            if (!update_node_attrs(scheduler, node_id, cache->cib, false)) {
+                crm_trace("Unpacking CIB again because attribute change for "
+                          "node %s affects status", node_id);
+                return false;
+            }
+        }
+
+        g_hash_table_iter_init(&iter, cache->attrs_changed);
+        while (g_hash_table_iter_next(&iter, (gpointer *) &node_id, NULL)) {
+            update_node_attrs(scheduler, node_id, cache->cib, true);
+        }
+        g_clear_pointer(&(cache->attrs_changed), g_hash_table_destroy);
+    }
+
+    // Show the latest change (and version) as the last one
+    pcmk__xe_copy_attrs(scheduler->input, cache->cib, pcmk__xaf_none);
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Ensure a status cache reflects the current CIB and time
+ *
+ * \param[in,out] out          Output object
+ * \param[in,out] cib          CIB connection
+ * \param[in]     current_cib  Current CIB XML
+ * \param[in,out] cache        Status cache to update
+ *
+ * \return Standard Pacemaker return code
+ */
+static int
+update_cached_cib(pcmk__output_t *out, cib_t *cib, xmlNode *current_cib,
+                  pcmk__status_cache_t *cache)
+{
+    int admin_epoch = 0;
+    int epoch = 0;
+    int num_updates = 0;
+
+    cib_version_details(current_cib, &admin_epoch, &epoch, &num_updates);
+
+    if ((cache->cib == NULL) || (cache->admin_epoch != admin_epoch)
+        || (cache->epoch != epoch) || (cache->num_updates != num_updates)) {
+
+        xmlNode *cib_copy = pcmk__xml_copy(NULL, current_cib);
+        int rc = pcmk_update_configured_schema(&cib_copy, false);
+
+        if (rc != pcmk_rc_ok) {
+            cib__clean_up_connection(&cib);
+            free_xml(cib_copy);
+            out->err(out, "Upgrade failed: %s", pcmk_rc_str(rc));
+            return rc;
+        }
+
+        free_xml(cache->cib);
+        cache->cib = cib_copy;
+        cache->admin_epoch = admin_epoch;
+        cache->epoch = epoch;
+        cache->num_updates = num_updates;
+        cache->status_changed = true;
+
+    } else if (update_status_in_place(cache)) {
+        crm_trace("Reusing status for CIB %d.%d.%d",
+                  admin_epoch, epoch, num_updates);
+        return pcmk_rc_ok;
+    }
+
+    pe_free_working_set(cache->scheduler);
+    cache->have_constraints = false;
+    cache->status_changed = false;
+    g_clear_pointer(&(cache->attrs_changed), g_hash_table_destroy);
+
+    cache->scheduler = pe_new_working_set();
+    pcmk__mem_assert(cache->scheduler);
+    pcmk__set_scheduler_flags(cache->scheduler, pcmk_sched_no_compat);
+
+    cache->scheduler->input = pcmk__xml_copy(NULL, cache->cib);
+    cluster_status(cache->scheduler);
+    return pcmk_rc_ok;
+}
+
 /*!
  * \internal
  * \brief Output the cluster status given a fencer and CIB connection
@@ -65,6 +678,9 @@ fencing_connect(void)
  * \param[in]     simple_output        Whether to use a simple output format.
  *                                     Note: This is for use by \p crm_mon only
  *                                     and is planned to be deprecated.
+ * \param[in,out] cache                If not \p NULL, status kept from earlier
+ *                                     calls, to be reused where still current
+ *                                     and updated otherwise
  *
  * \return Standard Pacemaker return code
  */
@@ -75,10 +691,10 @@ pcmk__output_cluster_status(pcmk__output_t *out, stonith_t *stonith, cib_t *cib,
                             enum pcmk__fence_history fence_history,
                             uint32_t show, uint32_t show_opts,
                             const char *only_node, const char *only_rsc,
-                            const char *neg_location_prefix, bool simple_output)
+                            const char *neg_location_prefix, bool simple_output,
+                            pcmk__status_cache_t *cache)
 {
-    xmlNode *cib_copy = pcmk__xml_copy(NULL, current_cib);
-    stonith_history_t *stonith_history = NULL;
+    pcmk__status_cache_t one_time_cache = { NULL, };
     int history_rc = 0;
     pcmk_scheduler_t *scheduler = NULL;
     GList *unames = NULL;
@@ -86,27 +702,33 @@ pcmk__output_cluster_status(pcmk__output_t *out, stonith_t *stonith, cib_t *cib,
 
     int rc = pcmk_rc_ok;
 
-    rc = pcmk_update_configured_schema(&cib_copy, false);
+    if (cache == NULL) {
+        cache = &one_time_cache;
+    }
+
+    rc = update_cached_cib(out, cib, current_cib, cache);
     if (rc != pcmk_rc_ok) {
-        cib__clean_up_connection(&cib);
-        free_xml(cib_copy);
-        out->err(out, "Upgrade failed: %s", pcmk_rc_str(rc));
+        pcmk__status_cache_clear(&one_time_cache);
         return rc;
     }
+    scheduler = cache->scheduler;
+    scheduler->priv = out;
 
-    /* get the stonith-history if there is evidence we need it */
-    if (fence_history != pcmk__fence_history_none) {
-        history_rc = pcmk__get_fencing_history(stonith, &stonith_history,
-                                               fence_history);
-    }
+    /* get the stonith-history if there is evidence we need it (and we don't
+     * already have it)
+     */
+    if ((fence_history != pcmk__fence_history_none)
+        && (!cache->have_fence_history
+            || (cache->fence_level != fence_history))) {
 
-    scheduler = pe_new_working_set();
-    pcmk__mem_assert(scheduler);
-    pcmk__set_scheduler_flags(scheduler, pcmk_sched_no_compat);
+        pcmk__status_cache_fencing_changed(cache);
+        history_rc = pcmk__get_fencing_history(stonith, &cache->fence_history,
+                                               fence_history);
 
-    scheduler->input = cib_copy;
-    scheduler->priv = out;
-    cluster_status(scheduler);
+        // Keep only successful results, so failures are retried
+        cache->have_fence_history = (history_rc == pcmk_rc_ok);
+        cache->fence_level = fence_history;
+    }
 
     if ((cib->variant == cib_native) && pcmk_is_set(show, pcmk_section_times)) {
         if (pcmk__our_nodename == NULL) {
@@ -119,9 +741,11 @@ pcmk__output_cluster_status(pcmk__output_t *out, stonith_t *stonith, cib_t *cib,
     /* Unpack constraints if any section will need them
      * (tickets may be referenced in constraints but not granted yet,
      * and bans need negative location constraints) */
-    if (pcmk_is_set(show, pcmk_section_bans)
-        || pcmk_is_set(show, pcmk_section_tickets)) {
+    if (!cache->have_constraints
+        && (pcmk_is_set(show, pcmk_section_bans)
+            || pcmk_is_set(show, pcmk_section_tickets))) {
         pcmk__unpack_constraints(scheduler);
+        cache->have_constraints = true;
     }
 
     unames = pe__build_node_name_list(scheduler, only_node);
@@ -135,6 +759,11 @@ pcmk__output_cluster_status(pcmk__output_t *out, stonith_t *stonith, cib_t *cib,
     if (simple_output) {
         rc = pcmk__output_simple_status(out, scheduler);
     } else {
+        stonith_history_t *stonith_history = NULL;
+
+        if (fence_history != pcmk__fence_history_none) {
+            stonith_history = cache->fence_history;
+        }
         out->message(out, "cluster-status",
                      scheduler, pcmkd_state, pcmk_rc2exitc(history_rc),
                      stonith_history, fence_history, show, show_opts,
@@ -144,9 +773,7 @@ pcmk__output_cluster_status(pcmk__output_t *out, stonith_t *stonith, cib_t *cib,
     g_list_free_full(unames, free);
     g_list_free_full(resources, free);
 
-    stonith_history_free(stonith_history);
-    stonith_history = NULL;
-    pe_free_working_set(scheduler);
+    pcmk__status_cache_clear(&one_time_cache);
     return rc;
 }
 
@@ -279,7 +906,7 @@ pcmk__status(pcmk__output_t *out, cib_t *cib,
     rc = pcmk__output_cluster_status(out, stonith, cib, current_cib,
                                      pcmkd_state, fence_history, show,
                                      show_opts, only_node, only_rsc,
-                                     neg_location_prefix, simple_output);
+                                     neg_location_prefix, simple_output, NULL);
     if (rc != pcmk_rc_ok) {
         out->err(out, "Error outputting status info from the fencer or CIB");
     }
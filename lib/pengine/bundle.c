@@ -72,6 +72,7 @@ typedef struct pe__bundle_variant_data_s {
         pcmk_resource_t *child;
 
         GList *replicas;    // pcmk__bundle_replica_t *
+        GHashTable *replicas_by_node;   // Guest node ID -> replica child
         GList *ports;       // pe__bundle_port_t *
         GList *mounts;      // pe__bundle_mount_t *
 
@@ -1327,6 +1328,18 @@ pe__unpack_bundle(pcmk_resource_t *rsc, pcmk_scheduler_t *scheduler)
             replica->container->utilization = replica->child->utilization;
             replica->child->utilization = empty;
         }
+
+        /* Index replicas by guest node, because pe__find_bundle_replica() is
+         * called for every history entry on every bundle's guest nodes
+         */
+        if (replica->node != NULL) {
+            if (bundle_data->replicas_by_node == NULL) {
+                bundle_data->replicas_by_node = pcmk__strkey_table(NULL, NULL);
+            }
+            g_hash_table_insert(bundle_data->replicas_by_node,
+                                (gpointer) replica->node->details->id,
+                                replica->child);
+        }
     }
 
     if (bundle_data->child) {
@@ -1405,16 +1418,11 @@ pe__find_bundle_replica(const pcmk_resource_t *bundle, const pcmk_node_t *node)
     CRM_ASSERT(bundle && node);
 
     get_bundle_variant_data(bundle_data, bundle);
-    for (GList *gIter = bundle_data->replicas; gIter != NULL;
-         gIter = gIter->next) {
-        pcmk__bundle_replica_t *replica = gIter->data;
-
-        CRM_ASSERT(replica && replica->node);
-        if (pcmk__same_node(replica->node, node)) {
-            return replica->child;
-        }
+    if (bundle_data->replicas_by_node == NULL) {
+        return NULL;
     }
-    return NULL;
+    return g_hash_table_lookup(bundle_data->replicas_by_node,
+                               node->details->id);
 }
 
 PCMK__OUTPUT_ARGS("bundle", "uint32_t", "pcmk_resource_t *", "GList *",
@@ -1883,6 +1891,9 @@ pe__free_bundle(pcmk_resource_t *rsc)
     free(bundle_data->container_command);
     g_free(bundle_data->container_host_options);
 
+    if (bundle_data->replicas_by_node != NULL) {
+        g_hash_table_destroy(bundle_data->replicas_by_node);
+    }
     g_list_free_full(bundle_data->replicas,
                      (GDestroyNotify) free_bundle_replica);
     g_list_free_full(bundle_data->mounts, (GDestroyNotify)mount_free);
@@ -465,7 +465,68 @@ detect_promotable(pcmk_resource_t *rsc)
 static void
 free_params_table(gpointer data)
 {
-    g_hash_table_destroy((GHashTable *) data);
+    // Tables may be shared by several nodes' entries
+    g_hash_table_unref((GHashTable *) data);
+}
+
+/*!
+ * \internal
+ * \brief Check whether any of an XML element's name/value blocks have rules
+ *
+ * \param[in] xml       XML element containing name/value blocks
+ * \param[in] set_name  Element name of blocks to check
+ *
+ * \return \c true if any block of type \p set_name (or the block it refers to)
+ *         contains a rule, otherwise \c false
+ */
+bool
+pe__nvpair_blocks_have_rules(const xmlNode *xml, const char *set_name)
+{
+    if (xml == NULL) {
+        return false;
+    }
+    for (xmlNode *block = pcmk__xe_first_child(xml, set_name, NULL, NULL);
+         block != NULL; block = pcmk__xe_next_same(block)) {
+
+        xmlNode *expanded = expand_idref(block, NULL);
+
+        if ((expanded != NULL)
+            && (pcmk__xe_first_child(expanded, PCMK_XE_RULE, NULL,
+                                     NULL) != NULL)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+ * \internal
+ * \brief Check whether a resource's parameters are the same on every node
+ *
+ * \param[in] rsc        Resource to check
+ * \param[in] defaults   Resource parameters evaluated without a node
+ * \param[in] scheduler  Scheduler data
+ *
+ * \return \c true if no instance attributes that apply to \p rsc have rules,
+ *         and \p rsc is not a remote connection whose address may be
+ *         substituted per node, otherwise \c false
+ */
+static bool
+rsc_params_are_node_independent(const pcmk_resource_t *rsc,
+                                GHashTable *defaults,
+                                const pcmk_scheduler_t *scheduler)
+{
+    if (g_hash_table_contains(defaults, PCMK_REMOTE_RA_ADDR)) {
+        return false;
+    }
+    for (const pcmk_resource_t *r = rsc; r != NULL; r = r->parent) {
+        if (pe__nvpair_blocks_have_rules(r->xml,
+                                         PCMK_XE_INSTANCE_ATTRIBUTES)) {
+            return false;
+        }
+    }
+    return !pe__nvpair_blocks_have_rules(scheduler->rsc_defaults,
+                                         PCMK_XE_INSTANCE_ATTRIBUTES);
 }
 
 /*!
@@ -509,8 +570,22 @@ pe_rsc_params(pcmk_resource_t *rsc, const pcmk_node_t *node,
 
     // If none exists yet, create one with parameters evaluated for node
     if (params_on_node == NULL) {
-        params_on_node = pcmk__strkey_table(free, free);
-        get_rsc_attributes(params_on_node, rsc, node, scheduler);
+        GHashTable *defaults = NULL;
+
+        if (node_name[0] != '\0') {
+            defaults = pe_rsc_params(rsc, NULL, scheduler);
+        }
+
+        if ((defaults != NULL)
+            && rsc_params_are_node_independent(rsc, defaults, scheduler)) {
+            /* Without rules, evaluating for a node gives the same result, so
+             * share the default table rather than building one per node
+             */
+            params_on_node = g_hash_table_ref(defaults);
+        } else {
+            params_on_node = pcmk__strkey_table(free, free);
+            get_rsc_attributes(params_on_node, rsc, node, scheduler);
+        }
         g_hash_table_insert(rsc->parameter_cache, strdup(node_name),
                             params_on_node);
     }
@@ -618,6 +693,295 @@ warn_about_deprecated_classes(pcmk_resource_t *rsc)
     }
 }
 
+/*!
+ * \internal
+ * \brief Add a resource to or remove it from the scheduler's resource index
+ *
+ * \param[in,out] index  Resource index
+ * \param[in]     name   Name to index \p rsc under
+ * \param[in,out] rsc    Resource to add or remove
+ * \param[in]     add    Whether to add (rather than remove) \p rsc
+ */
+static void
+update_rsc_index(GHashTable *index, const char *name, pcmk_resource_t *rsc,
+                 bool add)
+{
+    GPtrArray *rscs = g_hash_table_lookup(index, name);
+
+    if (add) {
+        if (rscs == NULL) {
+            rscs = g_ptr_array_new();
+            g_hash_table_insert(index, pcmk__str_copy(name), rscs);
+        }
+        g_ptr_array_add(rscs, rsc);
+
+    } else if (rscs != NULL) {
+        g_ptr_array_remove_fast(rscs, rsc);
+        if (rscs->len == 0) {
+            g_hash_table_remove(index, name);
+        }
+    }
+}
+
+/*!
+ * \internal
+ * \brief Add a resource to or remove it from the index under all its names
+ *
+ * A resource is indexed under every name that \c native_find_rsc() can match
+ * it by: its ID, its ID without any clone instance suffix, and its name in
+ * resource history. (Its XML ID is always one of the first two, because a
+ * resource ID is the XML ID plus any clone instance suffix.)
+ *
+ * \param[in,out] rsc  Resource to add or remove
+ * \param[in]     add  Whether to add (rather than remove) \p rsc
+ */
+static void
+update_rsc_index_names(pcmk_resource_t *rsc, bool add)
+{
+    GHashTable *index = NULL;
+    char *base = NULL;
+
+    if ((rsc == NULL) || (rsc->id == NULL) || (rsc->cluster == NULL)
+        || (rsc->cluster->internal == NULL)) {
+        return;
+    }
+    index = rsc->cluster->internal->rsc_names;
+    base = clone_strip(rsc->id);
+
+    update_rsc_index(index, rsc->id, rsc, add);
+    if (strcmp(base, rsc->id) != 0) {
+        update_rsc_index(index, base, rsc, add);
+    }
+    if ((rsc->clone_name != NULL) && (strcmp(rsc->clone_name, rsc->id) != 0)
+        && (strcmp(rsc->clone_name, base) != 0)) {
+        update_rsc_index(index, rsc->clone_name, rsc, add);
+    }
+    free(base);
+}
+
+/*!
+ * \internal
+ * \brief Add a resource to its scheduler data's resource index
+ *
+ * \param[in,out] rsc  Resource to add
+ *
+ * \note This must be called again, after \c pe__unindex_resource(), whenever
+ *       a name that the resource is indexed under changes.
+ */
+void
+pe__index_resource(pcmk_resource_t *rsc)
+{
+    update_rsc_index_names(rsc, true);
+}
+
+/*!
+ * \internal
+ * \brief Remove a resource from its scheduler data's resource index
+ *
+ * \param[in,out] rsc  Resource to remove
+ */
+void
+pe__unindex_resource(pcmk_resource_t *rsc)
+{
+    update_rsc_index_names(rsc, false);
+}
+
+/*!
+ * \internal
+ * \brief Get a resource's depth in the resource tree
+ *
+ * \param[in] rsc  Resource to check
+ *
+ * \return Number of ancestors of \p rsc
+ */
+static int
+rsc_depth(const pcmk_resource_t *rsc)
+{
+    int depth = 0;
+
+    for (rsc = rsc->parent; rsc != NULL; rsc = rsc->parent) {
+        depth++;
+    }
+    return depth;
+}
+
+/*!
+ * \internal
+ * \brief Compare two resources by their order in a depth-first tree search
+ *
+ * \param[in] a          First resource to compare
+ * \param[in] b          Second resource to compare
+ * \param[in] scheduler  Scheduler data that resources belong to
+ *
+ * \return A negative number if \p a would be found first when searching
+ *         \p scheduler->resources as \c native_find_rsc() does, otherwise a
+ *         positive number (or 0 if \p a and \p b are the same resource)
+ */
+static int
+cmp_rsc_search_order(const pcmk_resource_t *a, const pcmk_resource_t *b,
+                     const pcmk_scheduler_t *scheduler)
+{
+    const pcmk_resource_t *ancestor_a = a;
+    const pcmk_resource_t *ancestor_b = b;
+    int depth_a = rsc_depth(a);
+    int depth_b = rsc_depth(b);
+    const GList *siblings = NULL;
+
+    if (a == b) {
+        return 0;
+    }
+
+    for (; depth_a > depth_b; depth_a--) {
+        ancestor_a = ancestor_a->parent;
+    }
+    for (; depth_b > depth_a; depth_b--) {
+        ancestor_b = ancestor_b->parent;
+    }
+
+    // A parent is checked before its children
+    if (ancestor_a == b) {
+        return 1;
+    }
+    if (ancestor_b == a) {
+        return -1;
+    }
+
+    while (ancestor_a->parent != ancestor_b->parent) {
+        ancestor_a = ancestor_a->parent;
+        ancestor_b = ancestor_b->parent;
+    }
+
+    siblings = (ancestor_a->parent == NULL)? scheduler->resources
+                                           : ancestor_a->parent->children;
+    for (const GList *iter = siblings; iter != NULL; iter = iter->next) {
+        if (iter->data == ancestor_a) {
+            return -1;
+        }
+        if (iter->data == ancestor_b) {
+            return 1;
+        }
+    }
+    return 0; // Not reachable for resources in the tree
+}
+
+/*!
+ * \internal
+ * \brief Find a resource in the scheduler's resource index
+ *
+ * \param[in,out] scheduler  Scheduler data
+ * \param[in]     id         ID to search for
+ * \param[in]     flags      Group of enum pe_find flags
+ *
+ * \return Resource that a depth-first search of \p scheduler->resources using
+ *         \c native_find_rsc() would return, or \c NULL if none
+ * \note The result is the same as a list search, but the cost depends only on
+ *       how many resources share the name, not on how many resources there
+ *       are.
+ */
+pcmk_resource_t *
+pe__find_indexed_resource(pcmk_scheduler_t *scheduler, const char *id,
+                          int flags)
+{
+    GPtrArray *candidates = NULL;
+    pcmk_resource_t *match = NULL;
+
+    CRM_CHECK((scheduler != NULL) && (scheduler->internal != NULL)
+              && (id != NULL), return NULL);
+
+    candidates = g_hash_table_lookup(scheduler->internal->rsc_names, id);
+    if (candidates == NULL) {
+        return NULL;
+    }
+
+    for (guint i = 0; i < candidates->len; i++) {
+        pcmk_resource_t *rsc = g_ptr_array_index(candidates, i);
+
+        if (pe__rsc_matches_id(rsc, id, NULL, flags)
+            && ((match == NULL)
+                || (cmp_rsc_search_order(rsc, match, scheduler) < 0))) {
+            match = rsc;
+        }
+    }
+    return match;
+}
+
+/*!
+ * \internal
+ * \brief Add resource (and any matching children) to list if it matches ID
+ *
+ * \param[in] result  List to add resource to
+ * \param[in] rsc     Resource to check
+ * \param[in] id      ID to match
+ *
+ * \return (Possibly new) head of list
+ */
+static GList *
+add_rsc_with_id(GList *result, pcmk_resource_t *rsc, const char *id)
+{
+    if ((strcmp(rsc->id, id) == 0)
+        || ((rsc->clone_name != NULL) && (strcmp(rsc->clone_name, id) == 0))) {
+        result = g_list_prepend(result, rsc);
+    }
+    for (GList *iter = rsc->children; iter != NULL; iter = iter->next) {
+        pcmk_resource_t *child = (pcmk_resource_t *) iter->data;
+
+        result = add_rsc_with_id(result, child, id);
+    }
+    return result;
+}
+
+// GCompareDataFunc wrapper for cmp_rsc_search_order(), in reverse
+static gint
+cmp_rsc_search_order_reverse(gconstpointer a, gconstpointer b,
+                             gpointer user_data)
+{
+    return cmp_rsc_search_order((const pcmk_resource_t *) b,
+                                (const pcmk_resource_t *) a,
+                                (const pcmk_scheduler_t *) user_data);
+}
+
+/*!
+ * \internal
+ * \brief Find all resources whose ID or resource history name is a given ID
+ *
+ * \param[in] scheduler  Scheduler data
+ * \param[in] id         ID to search for
+ *
+ * \return List of matching resources, in reverse of the order a depth-first
+ *         search of \p scheduler->resources would find them
+ * \note The caller is responsible for freeing the result with g_list_free().
+ */
+GList *
+pe__rscs_with_id(const pcmk_scheduler_t *scheduler, const char *id)
+{
+    GList *result = NULL;
+    GPtrArray *candidates = NULL;
+
+    CRM_CHECK((scheduler != NULL) && (id != NULL), return NULL);
+
+    if (scheduler->internal == NULL) {
+        // Without an index, search all resources
+        for (GList *iter = scheduler->resources; iter != NULL;
+             iter = iter->next) {
+            result = add_rsc_with_id(result, (pcmk_resource_t *) iter->data,
+                                     id);
+        }
+        return result;
+    }
+
+    candidates = g_hash_table_lookup(scheduler->internal->rsc_names, id);
+    for (guint i = 0; (candidates != NULL) && (i < candidates->len); i++) {
+        pcmk_resource_t *rsc = g_ptr_array_index(candidates, i);
+
+        if ((strcmp(rsc->id, id) == 0)
+            || pcmk__str_eq(rsc->clone_name, id, pcmk__str_none)) {
+            result = g_list_prepend(result, rsc);
+        }
+    }
+    return g_list_sort_with_data(result, cmp_rsc_search_order_reverse,
+                                 (gpointer) scheduler);
+}
+
 /*!
  * \internal
  * \brief Unpack configuration XML for a given resource
@@ -983,6 +1347,8 @@ pe__unpack_resource(xmlNode *xml_obj, pcmk_resource_t **rsc,
             return pcmk_rc_unpack_error;
         }
     }
+
+    pe__index_resource(*rsc);
     return pcmk_rc_ok;
 }
 
@@ -1053,6 +1419,7 @@ common_free(pcmk_resource_t * rsc)
     }
 
     pcmk__rsc_trace(rsc, "Freeing %s %d", rsc->id, rsc->variant);
+    pe__unindex_resource(rsc);
 
     g_list_free(rsc->rsc_cons);
     g_list_free(rsc->rsc_cons_lhs);
@@ -267,14 +267,22 @@ rsc_is_on_node(pcmk_resource_t *rsc, const pcmk_node_t *node, int flags)
     return false;
 }
 
-pcmk_resource_t *
-native_find_rsc(pcmk_resource_t *rsc, const char *id,
-                const pcmk_node_t *on_node, int flags)
+/*!
+ * \internal
+ * \brief Check whether a resource itself (not its children) matches an ID
+ *
+ * \param[in] rsc      Resource to check
+ * \param[in] id       ID to match
+ * \param[in] on_node  If not NULL, resource must also be on this node
+ * \param[in] flags    Group of enum pe_find flags
+ *
+ * \return true if \p rsc matches, otherwise false
+ */
+bool
+pe__rsc_matches_id(pcmk_resource_t *rsc, const char *id,
+                   const pcmk_node_t *on_node, int flags)
 {
     bool match = false;
-    pcmk_resource_t *result = NULL;
-
-    CRM_CHECK(id && rsc && rsc->id, return NULL);
 
     if (pcmk_is_set(flags, pcmk_rsc_match_clone_only)) {
         const char *rid = pcmk__xe_id(rsc->xml);
@@ -304,8 +312,18 @@ native_find_rsc(pcmk_resource_t *rsc, const char *id,
             match = false;
         }
     }
+    return match;
+}
+
+pcmk_resource_t *
+native_find_rsc(pcmk_resource_t *rsc, const char *id,
+                const pcmk_node_t *on_node, int flags)
+{
+    pcmk_resource_t *result = NULL;
+
+    CRM_CHECK(id && rsc && rsc->id, return NULL);
 
-    if (match) {
+    if (pe__rsc_matches_id(rsc, id, on_node, flags)) {
         return rsc;
     }
 
@@ -150,6 +150,31 @@ pcmk__find_action_config(const pcmk_resource_t *rsc, const char *action_name,
     return action_config;
 }
 
+/*!
+ * \internal
+ * \brief Copy a node for use as an action's node
+ *
+ * \param[in,out] action  Action that copy will be used for
+ * \param[in]     node    Node to copy
+ *
+ * \return Newly allocated copy of \p node, owned by \p action
+ * \note Use this rather than \c pe__copy_node() for \c action->node, because
+ *       \c pe_free_action() releases it with \c pcmk__sched_free().
+ */
+pcmk_node_t *
+pe__copy_action_node(pcmk_action_t *action, const pcmk_node_t *node)
+{
+    pcmk_node_t *copy = pcmk__sched_alloc(action->scheduler,
+                                          sizeof(pcmk_node_t));
+
+    copy->rsc_discover_mode = node->rsc_discover_mode;
+    copy->weight = node->weight;
+    copy->fixed = node->fixed; // @COMPAT deprecated and unused
+    copy->count = node->count;
+    copy->details = node->details;
+    return copy;
+}
+
 /*!
  * \internal
  * \brief Create a new action object
@@ -169,14 +194,22 @@ static pcmk_action_t *
 new_action(char *key, const char *task, pcmk_resource_t *rsc,
            const pcmk_node_t *node, bool optional, pcmk_scheduler_t *scheduler)
 {
-    pcmk_action_t *action = pcmk__assert_alloc(1, sizeof(pcmk_action_t));
+    pcmk_action_t *action = pcmk__sched_alloc(scheduler,
+                                              sizeof(pcmk_action_t));
 
+    action->scheduler = scheduler;
     action->rsc = rsc;
-    action->task = pcmk__str_copy(task);
-    action->uuid = key;
+    if (pcmk__sched_interning(scheduler)) {
+        action->task = (char *) pcmk__sched_intern(scheduler, task);
+        action->uuid = (char *) pcmk__sched_intern(scheduler, key);
+        free(key);
+    } else {
+        action->task = pcmk__str_copy(task);
+        action->uuid = key;
+    }
 
     if (node) {
-        action->node = pe__copy_node(node);
+        action->node = pe__copy_action_node(action, node);
     }
 
     if (pcmk__str_eq(task, PCMK_ACTION_LRM_DELETE, pcmk__str_casei)) {
@@ -1390,26 +1423,49 @@ pe_fence_op(pcmk_node_t *node, const char *op, bool optional,
     return stonith_op;
 }
 
+/*!
+ * \internal
+ * \brief Free a list of action relations
+ *
+ * \param[in,out] scheduler  Scheduler data that relations were allocated for
+ * \param[in,out] relations  List of relations to free
+ */
+static void
+free_related_actions(pcmk_scheduler_t *scheduler, GList *relations)
+{
+    for (GList *iter = relations; iter != NULL; iter = iter->next) {
+        pcmk__sched_free(scheduler, iter->data);
+    }
+    g_list_free(relations);
+}
+
 void
 pe_free_action(pcmk_action_t *action)
 {
+    pcmk_scheduler_t *scheduler = NULL;
+
     if (action == NULL) {
         return;
     }
-    g_list_free_full(action->actions_before, free);
-    g_list_free_full(action->actions_after, free);
+    scheduler = action->scheduler;
+
+    free_related_actions(scheduler, action->actions_before);
+    free_related_actions(scheduler, action->actions_after);
     if (action->extra) {
         g_hash_table_destroy(action->extra);
     }
     if (action->meta) {
         g_hash_table_destroy(action->meta);
     }
+    g_slist_free(action->action_details); // Clone notification data (if any)
     free(action->cancel_task);
     free(action->reason);
-    free(action->task);
-    free(action->uuid);
-    free(action->node);
-    free(action);
+    if (!pcmk__sched_interning(scheduler)) {
+        free(action->task);
+        free(action->uuid);
+    }
+    pcmk__sched_free(scheduler, action->node);
+    pcmk__sched_free(scheduler, action);
 }
 
 enum action_tasks
@@ -1434,6 +1490,55 @@ get_complex_task(const pcmk_resource_t *rsc, const char *name)
     return task;
 }
 
+/*!
+ * \internal
+ * \brief Get the case-folded handle to use when searching a list of actions
+ *
+ * \param[in]  input  List of actions to search
+ * \param[in]  str    Action key or name to search for
+ * \param[out] fold   Where to store interned handle for \p str (or \c NULL
+ *                    if actions' strings are not interned)
+ *
+ * \return false if no action in \p input can match \p str, otherwise true
+ */
+static bool
+get_search_fold(const GList *input, const char *str, const char **fold)
+{
+    const pcmk_scheduler_t *scheduler = NULL;
+
+    *fold = NULL;
+    if ((input == NULL) || (str == NULL)) {
+        return true;
+    }
+
+    // All actions in a list belong to the same scheduler data
+    scheduler = ((const pcmk_action_t *) input->data)->scheduler;
+    if (!pcmk__sched_interning(scheduler)) {
+        return true;
+    }
+    *fold = pcmk__sched_fold(scheduler, str);
+    return *fold != NULL;
+}
+
+/*!
+ * \internal
+ * \brief Check whether an action string matches a search string
+ *
+ * \param[in] action_str  Action's key or name
+ * \param[in] str         String to compare against
+ * \param[in] fold        Interned handle from \c get_search_fold()
+ *
+ * \return true if \p action_str equals \p str ignoring case, otherwise false
+ */
+static inline bool
+action_str_matches(const char *action_str, const char *str, const char *fold)
+{
+    if (fold != NULL) {
+        return pcmk__interned_fold(action_str) == fold;
+    }
+    return pcmk__str_eq(str, action_str, pcmk__str_casei);
+}
+
 /*!
  * \internal
  * \brief Find first matching action in a list
@@ -1449,15 +1554,25 @@ pcmk_action_t *
 find_first_action(const GList *input, const char *uuid, const char *task,
                   const pcmk_node_t *on_node)
 {
+    const char *uuid_fold = NULL;
+    const char *task_fold = NULL;
+
     CRM_CHECK(uuid || task, return NULL);
 
+    if (!get_search_fold(input, uuid, &uuid_fold)
+        || !get_search_fold(input, task, &task_fold)) {
+        return NULL;
+    }
+
     for (const GList *gIter = input; gIter != NULL; gIter = gIter->next) {
         pcmk_action_t *action = (pcmk_action_t *) gIter->data;
 
-        if (uuid != NULL && !pcmk__str_eq(uuid, action->uuid, pcmk__str_casei)) {
+        if ((uuid != NULL)
+            && !action_str_matches(action->uuid, uuid, uuid_fold)) {
             continue;
 
-        } else if (task != NULL && !pcmk__str_eq(task, action->task, pcmk__str_casei)) {
+        } else if ((task != NULL)
+                   && !action_str_matches(action->task, task, task_fold)) {
             continue;
 
         } else if (on_node == NULL) {
@@ -1479,13 +1594,18 @@ find_actions(GList *input, const char *key, const pcmk_node_t *on_node)
 {
     GList *gIter = input;
     GList *result = NULL;
+    const char *fold = NULL;
 
     CRM_CHECK(key != NULL, return NULL);
 
+    if (!get_search_fold(input, key, &fold)) {
+        return NULL;
+    }
+
     for (; gIter != NULL; gIter = gIter->next) {
         pcmk_action_t *action = (pcmk_action_t *) gIter->data;
 
-        if (!pcmk__str_eq(key, action->uuid, pcmk__str_casei)) {
+        if (!action_str_matches(action->uuid, key, fold)) {
             continue;
 
         } else if (on_node == NULL) {
@@ -1496,7 +1616,7 @@ find_actions(GList *input, const char *key, const pcmk_node_t *on_node)
             crm_trace("Action %s matches (unallocated, assigning to %s)",
                       key, pcmk__node_name(on_node));
 
-            action->node = pe__copy_node(on_node);
+            action->node = pe__copy_action_node(action, on_node);
             result = g_list_prepend(result, action);
 
         } else if (pcmk__same_node(on_node, action->node)) {
@@ -1512,10 +1632,11 @@ GList *
 find_actions_exact(GList *input, const char *key, const pcmk_node_t *on_node)
 {
     GList *result = NULL;
+    const char *fold = NULL;
 
     CRM_CHECK(key != NULL, return NULL);
 
-    if (on_node == NULL) {
+    if ((on_node == NULL) || !get_search_fold(input, key, &fold)) {
         return NULL;
     }
 
@@ -1523,9 +1644,10 @@ find_actions_exact(GList *input, const char *key, const pcmk_node_t *on_node)
         pcmk_action_t *action = (pcmk_action_t *) gIter->data;
 
         if ((action->node != NULL)
-            && pcmk__str_eq(key, action->uuid, pcmk__str_casei)
-            && pcmk__str_eq(on_node->details->id, action->node->details->id,
-                            pcmk__str_casei)) {
+            && action_str_matches(action->uuid, key, fold)
+            && (pcmk__same_node(on_node, action->node)
+                || pcmk__str_eq(on_node->details->id,
+                                action->node->details->id, pcmk__str_casei))) {
 
             crm_trace("Action %s on %s matches", key, pcmk__node_name(on_node));
             result = g_list_prepend(result, action);
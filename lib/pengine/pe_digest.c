@@ -79,6 +79,60 @@ attr_in_string(xmlAttrPtr a, void *user_data)
     return filter;
 }
 
+/*!
+ * \internal
+ * \brief Get the table of an action's main digests shared by all nodes
+ *
+ * An action's main digest does not depend on the node when the resource's
+ * parameters are the same on every node (in which case \c pe_rsc_params()
+ * gives every node a reference to the resource's default parameter table),
+ * no parameters are overridden, and no operation attributes,
+ * meta-attributes, or operation defaults have rules (which may use node
+ * attributes).
+ *
+ * \param[in,out] rsc            Resource that action was for
+ * \param[in]     params         Resource parameters evaluated for node
+ * \param[in]     action_config  Action configuration XML (if any)
+ * \param[in,out] scheduler      Scheduler data
+ *
+ * \return Table of shared main digests for \p params (or \c NULL if the
+ *         digest depends on the node)
+ */
+static GHashTable *
+shared_main_digests(pcmk_resource_t *rsc, GHashTable *params,
+                    const xmlNode *action_config, pcmk_scheduler_t *scheduler)
+{
+    pcmk__scheduler_private_t *priv = scheduler->internal;
+    GHashTable *shared = NULL;
+
+    if ((priv == NULL) || (params != pe_rsc_params(rsc, NULL, scheduler))
+        || pe__nvpair_blocks_have_rules(action_config,
+                                        PCMK_XE_INSTANCE_ATTRIBUTES)
+        || pe__nvpair_blocks_have_rules(action_config,
+                                        PCMK_XE_META_ATTRIBUTES)
+        || pe__nvpair_blocks_have_rules(scheduler->op_defaults,
+                                        PCMK_XE_META_ATTRIBUTES)) {
+        return NULL;
+    }
+
+    if (priv->main_digests == NULL) {
+        priv->main_digests = g_hash_table_new_full(NULL, NULL,
+                                                   (GDestroyNotify)
+                                                   g_hash_table_unref,
+                                                   (GDestroyNotify)
+                                                   g_hash_table_destroy);
+    }
+
+    shared = g_hash_table_lookup(priv->main_digests, params);
+    if (shared == NULL) {
+        // Hold a reference so the key can't be reused by another table
+        shared = pcmk__strkey_table(free, pe__free_digests);
+        g_hash_table_insert(priv->main_digests, g_hash_table_ref(params),
+                            shared);
+    }
+    return shared;
+}
+
 /*!
  * \internal
  * \brief Add digest of all parameters to a digest cache entry
@@ -102,6 +156,30 @@ calculate_main_digest(pcmk__op_digest_t *data, pcmk_resource_t *rsc,
                       GHashTable *overrides, pcmk_scheduler_t *scheduler)
 {
     xmlNode *action_config = NULL;
+    GHashTable *shared = NULL;
+    char *shared_key = NULL;
+
+    if (overrides == NULL) {
+        action_config = pcmk__find_action_config(rsc, task, *interval_ms,
+                                                 true);
+        shared = shared_main_digests(rsc, params, action_config, scheduler);
+    }
+
+    if (shared != NULL) {
+        const pcmk__op_digest_t *entry = NULL;
+
+        shared_key = crm_strdup_printf("%s_%u %s",
+                                       task, *interval_ms, op_version);
+        entry = g_hash_table_lookup(shared, shared_key);
+        if (entry != NULL) {
+            // Already calculated for another node
+            data->rc = entry->rc;
+            data->params_all = pcmk__xml_copy(NULL, entry->params_all);
+            data->digest_all_calc = pcmk__str_copy(entry->digest_all_calc);
+            free(shared_key);
+            return;
+        }
+    }
 
     data->params_all = pcmk__xe_create(NULL, PCMK_XE_PARAMETERS);
 
@@ -132,8 +210,11 @@ calculate_main_digest(pcmk__op_digest_t *data, pcmk_resource_t *rsc,
     // Add provided instance parameters
     g_hash_table_foreach(params, hash2field, data->params_all);
 
-    // Find action configuration XML in CIB
-    action_config = pcmk__find_action_config(rsc, task, *interval_ms, true);
+    // Find action configuration XML in CIB (with any overridden interval)
+    if (overrides != NULL) {
+        action_config = pcmk__find_action_config(rsc, task, *interval_ms,
+                                                 true);
+    }
 
     /* Add action-specific resource instance attributes to the digest list.
      *
@@ -163,6 +244,16 @@ calculate_main_digest(pcmk__op_digest_t *data, pcmk_resource_t *rsc,
 
     data->digest_all_calc = calculate_operation_digest(data->params_all,
                                                        op_version);
+
+    if (shared != NULL) {
+        pcmk__op_digest_t *entry = NULL;
+
+        entry = pcmk__assert_alloc(1, sizeof(pcmk__op_digest_t));
+        entry->rc = data->rc;
+        entry->params_all = pcmk__xml_copy(NULL, data->params_all);
+        entry->digest_all_calc = pcmk__str_copy(data->digest_all_calc);
+        g_hash_table_insert(shared, shared_key, entry);
+    }
 }
 
 // Return true if XML attribute name is a Pacemaker-defined fencing parameter
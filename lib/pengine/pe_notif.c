@@ -255,15 +255,97 @@ copy_meta_to_notify(gpointer key, gpointer value, gpointer user_data)
     pcmk__insert_dup(notify->meta, (const char *) key, (const char *) value);
 }
 
+/*!
+ * \internal
+ * \brief Make an action refer to a notification round's name/value pairs
+ *
+ * Every instance action in a notification round gets the same (potentially
+ * large, for clones with many instances) set of notification meta-attributes.
+ * Rather than copy them into each action's meta-attributes, keep a reference
+ * to the round's list, to be expanded when the action is added to the
+ * transition graph.
+ *
+ * \param[in,out] n_data  Notification data for round
+ * \param[in,out] action  Action to add notification data to
+ */
 static void
-add_notify_data_to_action_meta(const notify_data_t *n_data,
-                               pcmk_action_t *action)
+add_notify_data_to_action_meta(notify_data_t *n_data, pcmk_action_t *action)
 {
-    for (const GSList *item = n_data->keys; item; item = item->next) {
-        const pcmk_nvpair_t *nvpair = (const pcmk_nvpair_t *) item->data;
+    if (n_data->keys == NULL) {
+        return;
+    }
+    action->action_details = g_slist_append(action->action_details,
+                                            n_data->keys);
+    n_data->referrers = g_list_prepend(n_data->referrers, action);
+}
+
+/*!
+ * \internal
+ * \brief Call a function for each notification meta-attribute of an action
+ *
+ * \param[in]     action     Action to check
+ * \param[in]     fn         Function to call for each name/value pair
+ * \param[in,out] user_data  Caller data to pass to \p fn
+ *
+ * \note When a name is set by more than one notification round, \p fn will
+ *       be called for each, with the most recent value last.
+ */
+void
+pe__foreach_notify_meta(const pcmk_action_t *action, GHFunc fn,
+                        gpointer user_data)
+{
+    for (const GSList *round = action->action_details; round != NULL;
+         round = round->next) {
+
+        for (const GSList *item = round->data; item; item = item->next) {
+            pcmk_nvpair_t *nvpair = (pcmk_nvpair_t *) item->data;
+
+            fn(nvpair->name, nvpair->value, user_data);
+        }
+    }
+}
 
-        pcmk__insert_meta(action, nvpair->name, nvpair->value);
+/*!
+ * \internal
+ * \brief Copy a notification name/value pair into an action's meta-attributes
+ *
+ * \param[in]     key        Name of meta-attribute to copy
+ * \param[in]     value      Value of meta-attribute to copy
+ * \param[in,out] user_data  Action to copy into
+ */
+static void
+insert_notify_meta(gpointer key, gpointer value, gpointer user_data)
+{
+    pcmk_action_t *action = (pcmk_action_t *) user_data;
+
+    pcmk__insert_meta(action, (const char *) key, (const char *) value);
+}
+
+/*!
+ * \internal
+ * \brief Drop an action's reference to a notification round being freed
+ *
+ * \param[in,out] data       Action referring to notification round
+ * \param[in]     user_data  Notification data for round
+ */
+static void
+release_notify_data(gpointer data, gpointer user_data)
+{
+    pcmk_action_t *action = (pcmk_action_t *) data;
+    const notify_data_t *n_data = (const notify_data_t *) user_data;
+
+    if (!pcmk_is_set(action->flags, pcmk_action_added_to_graph)) {
+        /* The action is not in the transition graph yet (for example,
+         * notifications ordered after fencing are created while scheduling),
+         * so it needs its own copy of everything it refers to.
+         */
+        pe__foreach_notify_meta(action, insert_notify_meta, action);
+        g_slist_free(action->action_details);
+        action->action_details = NULL;
+        return;
     }
+    action->action_details = g_slist_remove(action->action_details,
+                                            n_data->keys);
 }
 
 /*!
@@ -302,14 +384,14 @@ new_notify_pseudo_action(pcmk_resource_t *rsc, const pcmk_action_t *action,
  * \param[in]     node         Node that notification is for
  * \param[in,out] op           Action that notification is for
  * \param[in,out] notify_done  Parent pseudo-action for notifications complete
- * \param[in]     n_data       Notification values to add to action meta-data
+ * \param[in,out] n_data       Notification values to add to action meta-data
  *
  * \return Newly created notify action
  */
 static pcmk_action_t *
 new_notify_action(pcmk_resource_t *rsc, const pcmk_node_t *node,
                   pcmk_action_t *op, pcmk_action_t *notify_done,
-                  const notify_data_t *n_data)
+                  notify_data_t *n_data)
 {
     char *key = NULL;
     pcmk_action_t *notify_action = NULL;
@@ -966,6 +1048,8 @@ pe__free_action_notification_data(notify_data_t *n_data)
     g_list_free_full(n_data->unpromoted, free);
     g_list_free_full(n_data->active, free);
     g_list_free_full(n_data->inactive, free);
+    g_list_foreach(n_data->referrers, release_notify_data, n_data);
+    g_list_free(n_data->referrers);
     pcmk_free_nvpairs(n_data->keys);
     free(n_data);
 }
@@ -43,6 +43,11 @@ typedef struct notify_data_s {
     GList *promoted;          /* notify_entry_t*  */
     GList *unpromoted;        /* notify_entry_t*  */
     GHashTable *allowed_nodes;
+
+    /* Actions whose details refer to keys, which are expanded only when the
+     * actions are added to the transition graph (as pcmk_action_t *)
+     */
+    GList *referrers;
 } notify_data_t;
 
 G_GNUC_INTERNAL
@@ -74,6 +79,16 @@ gboolean pe__unpack_resource(xmlNode *xml_obj, pcmk_resource_t **rsc,
                              pcmk_resource_t *parent,
                              pcmk_scheduler_t *scheduler);
 
+G_GNUC_INTERNAL
+void pe__index_resource(pcmk_resource_t *rsc);
+
+G_GNUC_INTERNAL
+void pe__unindex_resource(pcmk_resource_t *rsc);
+
+G_GNUC_INTERNAL
+pcmk_resource_t *pe__find_indexed_resource(pcmk_scheduler_t *scheduler,
+                                           const char *id, int flags);
+
 G_GNUC_INTERNAL
 gboolean unpack_remote_nodes(xmlNode *xml_resources,
                              pcmk_scheduler_t *scheduler);
@@ -103,8 +118,15 @@ pcmk__op_digest_t *pe__compare_fencing_digest(pcmk_resource_t *rsc,
 G_GNUC_INTERNAL
 void pe__unpack_node_health_scores(pcmk_scheduler_t *scheduler);
 
+G_GNUC_INTERNAL
+bool pe__nvpair_blocks_have_rules(const xmlNode *xml, const char *set_name);
+
 // Primitive resource methods
 
+G_GNUC_INTERNAL
+bool pe__rsc_matches_id(pcmk_resource_t *rsc, const char *id,
+                        const pcmk_node_t *on_node, int flags);
+
 G_GNUC_INTERNAL
 unsigned int pe__primitive_max_per_node(const pcmk_resource_t *rsc);
 
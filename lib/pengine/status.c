@@ -37,6 +37,7 @@ pe_new_working_set(void)
 
     if (scheduler != NULL) {
         set_working_set_defaults(scheduler);
+        scheduler->internal = pcmk__new_scheduler_private();
     }
     return scheduler;
 }
@@ -52,6 +53,7 @@ pe_free_working_set(pcmk_scheduler_t *scheduler)
     if (scheduler != NULL) {
         pe_reset_working_set(scheduler);
         scheduler->priv = NULL;
+        pcmk__free_scheduler_private(scheduler->internal);
         free(scheduler);
     }
 }
@@ -356,6 +358,9 @@ cleanup_calculations(pcmk_scheduler_t *scheduler)
     free_xml(scheduler->input);
     free_xml(scheduler->failed);
 
+    // This must come after everything that could use the scheduler's arena
+    pcmk__reset_scheduler_private(scheduler);
+
     set_working_set_defaults(scheduler);
 
     CRM_CHECK(scheduler->ordering_constraints == NULL,;
@@ -403,10 +408,12 @@ void
 set_working_set_defaults(pcmk_scheduler_t *scheduler)
 {
     void *priv = scheduler->priv;
+    pcmk__scheduler_private_t *internal = scheduler->internal;
 
     memset(scheduler, 0, sizeof(pcmk_scheduler_t));
 
     scheduler->priv = priv;
+    scheduler->internal = internal;
     scheduler->order_id = 1;
     scheduler->action_id = 1;
     scheduler->no_quorum_policy = pcmk_no_quorum_stop;
@@ -433,6 +440,23 @@ pe_find_resource_with_flags(GList *rsc_list, const char *id, enum pe_find flags)
 {
     GList *rIter = NULL;
 
+    if ((id != NULL) && (rsc_list != NULL)) {
+        pcmk_resource_t *first = (pcmk_resource_t *) rsc_list->data;
+        pcmk_scheduler_t *scheduler = first->cluster;
+
+        // Use the resource index when searching all resources
+        if ((scheduler != NULL) && (scheduler->internal != NULL)
+            && (rsc_list == scheduler->resources)) {
+            pcmk_resource_t *match = pe__find_indexed_resource(scheduler, id,
+                                                               flags);
+
+            if (match == NULL) {
+                crm_trace("No match for %s", id);
+            }
+            return match;
+        }
+    }
+
     for (rIter = rsc_list; id && rIter; rIter = rIter->next) {
         pcmk_resource_t *parent = rIter->data;
 
@@ -482,6 +506,25 @@ pe_find_node_any(const GList *nodes, const char *id, const char *uname)
 pcmk_node_t *
 pe_find_node_id(const GList *nodes, const char *id)
 {
+    const char *fold = NULL;
+
+    if ((nodes != NULL) && (id != NULL)) {
+        const pcmk_node_t *first = (const pcmk_node_t *) nodes->data;
+        const pcmk_scheduler_t *scheduler = first->details->data_set;
+
+        if (pcmk__sched_interning(scheduler)) {
+            if (nodes == scheduler->nodes) {
+                return g_hash_table_lookup(scheduler->internal->node_ids, id);
+            }
+
+            // Node IDs are interned if the nodes' scheduler data supports it
+            fold = pcmk__sched_fold(scheduler, id);
+            if (fold == NULL) {
+                return NULL;
+            }
+        }
+    }
+
     for (const GList *iter = nodes; iter != NULL; iter = iter->next) {
         pcmk_node_t *node = (pcmk_node_t *) iter->data;
 
@@ -489,7 +532,12 @@ pe_find_node_id(const GList *nodes, const char *id)
          * probably depend on the node type, so functionizing the comparison
          * would be worthwhile
          */
-        if (pcmk__str_eq(node->details->id, id, pcmk__str_casei)) {
+        if (fold != NULL) {
+            if ((node->details->id != NULL)
+                && (pcmk__interned_fold(node->details->id) == fold)) {
+                return node;
+            }
+        } else if (pcmk__str_eq(node->details->id, id, pcmk__str_casei)) {
             return node;
         }
     }
@@ -46,6 +46,29 @@ non_null_list(void **state) {
     g_list_free(nodes);
 }
 
+static void
+scheduler_nodes(void **state) {
+    pcmk_scheduler_t *scheduler = pe_new_working_set();
+    pcmk_node_t *a = pe_create_node("id1", "node1", PCMK_VALUE_MEMBER, NULL,
+                                    scheduler);
+    pcmk_node_t *b = pe_create_node("id2", "node2", PCMK_VALUE_MEMBER, NULL,
+                                    scheduler);
+
+    // Searching all of the scheduler's nodes uses its node index
+    assert_ptr_equal(a, pe_find_node_id(scheduler->nodes, "id1"));
+    assert_ptr_equal(b, pe_find_node_id(scheduler->nodes, "ID2"));
+    assert_null(pe_find_node_id(scheduler->nodes, "id10"));
+    assert_null(pe_find_node_id(scheduler->nodes, "node1"));
+    assert_null(pe_find_node_id(scheduler->nodes, NULL));
+
+    // Searching part of them uses interned node IDs
+    assert_ptr_equal(b, pe_find_node_id(scheduler->nodes->next, "id2"));
+    assert_null(pe_find_node_id(scheduler->nodes->next, "id1"));
+
+    pe_free_working_set(scheduler);
+}
+
 PCMK__UNIT_TEST(NULL, NULL,
                 cmocka_unit_test(empty_list),
-                cmocka_unit_test(non_null_list))
+                cmocka_unit_test(non_null_list),
+                cmocka_unit_test(scheduler_nodes))
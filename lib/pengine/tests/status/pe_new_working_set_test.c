@@ -34,10 +34,12 @@ calloc_succeeds(void **state) {
      * get its own unit test.
      */
     assert_non_null(scheduler);
+    assert_non_null(scheduler->internal);
 
     /* Avoid calling pe_free_working_set here so we don't artificially
      * inflate the coverage numbers.
      */
+    pcmk__free_scheduler_private(scheduler->internal);
     free(scheduler);
 }
 
@@ -35,6 +35,7 @@ check_defaults(void **state) {
 
 
     assert_null(scheduler->priv);
+    assert_null(scheduler->internal);
     assert_int_equal(scheduler->order_id, 1);
     assert_int_equal(scheduler->action_id, 1);
     assert_int_equal(scheduler->no_quorum_policy, pcmk_no_quorum_stop);
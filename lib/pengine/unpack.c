@@ -42,6 +42,13 @@ struct action_history {
     int expected_exit_status; // Expected exit status of action
     int exit_status;          // Actual exit status of action
     int execution_status;     // Execution status of action
+    time_t last_change;       // When result last changed (if known)
+    bool have_last_change;    // Whether last_change was recorded in XML
+
+    /* Readable version of last_change for log messages (formatted only when
+     * needed, because most entries never log one)
+     */
+    char last_change_s[32];
 };
 
 /* This uses pcmk__set_flags_as()/pcmk__clear_flags_as() directly rather than
@@ -451,6 +458,34 @@ unpack_config(xmlNode *config, pcmk_scheduler_t *scheduler)
     return TRUE;
 }
 
+/*!
+ * \internal
+ * \brief Add a node to a scheduler node index
+ *
+ * \param[in,out] index  Node index to add to
+ * \param[in]     key    Index key for \p node
+ * \param[in]     node   Node to add
+ *
+ * \note If the key is already indexed, the index keeps whichever node will
+ *       be found first in the (sorted) scheduler node list, which is what a
+ *       list search would find.
+ */
+static void
+index_node(GHashTable *index, const char *key, pcmk_node_t *node)
+{
+    pcmk_node_t *existing = NULL;
+
+    if (key == NULL) {
+        return;
+    }
+    existing = g_hash_table_lookup(index, key);
+
+    // g_list_insert_sorted() puts new nodes before equal ones
+    if ((existing == NULL) || (pe__cmp_node_name(node, existing) <= 0)) {
+        g_hash_table_insert(index, (gpointer) key, node);
+    }
+}
+
 pcmk_node_t *
 pe_create_node(const char *id, const char *uname, const char *type,
                const char *score, pcmk_scheduler_t *scheduler)
@@ -477,8 +512,8 @@ pe_create_node(const char *id, const char *uname, const char *type,
     }
 
     crm_trace("Creating node for entry %s/%s", uname, id);
-    new_node->details->id = id;
-    new_node->details->uname = uname;
+    new_node->details->id = pcmk__sched_intern(scheduler, id);
+    new_node->details->uname = pcmk__sched_intern(scheduler, uname);
     new_node->details->online = FALSE;
     new_node->details->shutdown = FALSE;
     new_node->details->rsc_discovery_enabled = TRUE;
@@ -524,6 +559,12 @@ pe_create_node(const char *id, const char *uname, const char *type,
 
     scheduler->nodes = g_list_insert_sorted(scheduler->nodes, new_node,
                                             pe__cmp_node_name);
+    if (scheduler->internal != NULL) {
+        index_node(scheduler->internal->node_ids, new_node->details->id,
+                   new_node);
+        index_node(scheduler->internal->node_names, new_node->details->uname,
+                   new_node);
+    }
     return new_node;
 }
 
@@ -2215,7 +2256,9 @@ unpack_find_resource(pcmk_scheduler_t *scheduler, const pcmk_node_t *node,
     if (rsc && !pcmk__str_eq(rsc_id, rsc->id, pcmk__str_none)
         && !pcmk__str_eq(rsc_id, rsc->clone_name, pcmk__str_none)) {
 
+        pe__unindex_resource(rsc);
         pcmk__str_update(&rsc->clone_name, rsc_id);
+        pe__index_resource(rsc);
         pcmk__rsc_debug(rsc, "Internally renamed %s on %s to %s%s",
                         rsc_id, pcmk__node_name(node), rsc->id,
                         pcmk_is_set(rsc->flags, pcmk_rsc_removed)? " (ORPHAN)" : "");
@@ -2492,8 +2535,10 @@ process_rsc_state(pcmk_resource_t *rsc, pcmk_node_t *node,
          */
         pcmk__rsc_trace(rsc, "Resetting clone_name %s for %s (stopped)",
                         rsc->clone_name, rsc->id);
+        pe__unindex_resource(rsc);
         free(rsc->clone_name);
         rsc->clone_name = NULL;
+        pe__index_resource(rsc);
 
     } else {
         GList *possible_matches = pe__resource_actions(rsc, node,
@@ -3508,29 +3553,37 @@ record_failed_op(struct action_history *history)
     pcmk__xml_copy(history->rsc->cluster->failed, history->xml);
 }
 
-static char *
-last_change_str(const xmlNode *xml_op)
+/*!
+ * \internal
+ * \brief Get a readable version of when an action's result last changed
+ *
+ * \param[in,out] history  Parsed action history entry
+ *
+ * \return Readable time (or "unknown_time"), valid as long as \p history
+ */
+static const char *
+last_change_str(struct action_history *history)
 {
-    time_t when;
-    char *result = NULL;
+    if (history->last_change_s[0] == '\0') {
+        char *when_s = NULL;
+        const char *p = NULL;
 
-    if (crm_element_value_epoch(xml_op, PCMK_XA_LAST_RC_CHANGE,
-                                &when) == pcmk_ok) {
-        char *when_s = pcmk__epoch2str(&when, 0);
-        const char *p = strchr(when_s, ' ');
+        if (history->have_last_change) {
+            when_s = pcmk__epoch2str(&(history->last_change), 0);
+            p = strchr(when_s, ' ');
+        }
 
         // Skip day of week to make message shorter
         if ((p != NULL) && (*(++p) != '\0')) {
-            result = pcmk__str_copy(p);
+            g_strlcpy(history->last_change_s, p,
+                      sizeof(history->last_change_s));
+        } else {
+            g_strlcpy(history->last_change_s, "unknown_time",
+                      sizeof(history->last_change_s));
         }
         free(when_s);
     }
-
-    if (result == NULL) {
-        result = pcmk__str_copy("unknown_time");
-    }
-
-    return result;
+    return history->last_change_s;
 }
 
 /*!
@@ -3702,12 +3755,12 @@ unpack_rsc_op_failure(struct action_history *history,
                       enum action_fail_response *on_fail)
 {
     bool is_probe = false;
-    char *last_change_s = NULL;
+    const char *last_change_s = NULL;
 
     *last_failure = history->xml;
 
     is_probe = pcmk_xe_is_probe(history->xml);
-    last_change_s = last_change_str(history->xml);
+    last_change_s = last_change_str(history);
 
     if (!pcmk_is_set(history->rsc->cluster->flags, pcmk_sched_symmetric_cluster)
         && (history->exit_status == PCMK_OCF_NOT_INSTALLED)) {
@@ -3745,8 +3798,6 @@ unpack_rsc_op_failure(struct action_history *history,
         record_failed_op(history);
     }
 
-    free(last_change_s);
-
     if (cmp_on_fail(*on_fail, config_on_fail) < 0) {
         pcmk__rsc_trace(history->rsc, "on-fail %s -> %s for %s",
                         pcmk_on_fail_text(*on_fail),
@@ -3825,7 +3876,7 @@ unpack_rsc_op_failure(struct action_history *history,
 static void
 block_if_unrecoverable(struct action_history *history)
 {
-    char *last_change_s = NULL;
+    const char *last_change_s = NULL;
 
     if (strcmp(history->task, PCMK_ACTION_STOP) != 0) {
         return; // All actions besides stop are always recoverable
@@ -3834,7 +3885,7 @@ block_if_unrecoverable(struct action_history *history)
         return; // Failed stops are recoverable via fencing
     }
 
-    last_change_s = last_change_str(history->xml);
+    last_change_s = last_change_str(history);
     pcmk__sched_err("No further recovery can be attempted for %s "
                     "because %s on %s failed (%s%s%s) at %s "
                     CRM_XS " rc=%d id=%s",
@@ -3845,8 +3896,6 @@ block_if_unrecoverable(struct action_history *history)
                     pcmk__s(history->exit_reason, ""),
                     last_change_s, history->exit_status, history->id);
 
-    free(last_change_s);
-
     pcmk__clear_rsc_flags(history->rsc, pcmk_rsc_managed);
     pcmk__set_rsc_flags(history->rsc, pcmk_rsc_blocked);
 }
@@ -3982,14 +4031,13 @@ remap_operation(struct action_history *history,
         case PCMK_OCF_OK:
             if (is_probe
                 && (history->expected_exit_status == PCMK_OCF_NOT_RUNNING)) {
-                char *last_change_s = last_change_str(history->xml);
+                const char *last_change_s = last_change_str(history);
 
                 remap_because(history, &why, PCMK_EXEC_DONE, "probe");
                 pcmk__rsc_info(history->rsc,
                                "Probe found %s active on %s at %s",
                                history->rsc->id, pcmk__node_name(history->node),
                                last_change_s);
-                free(last_change_s);
             }
             break;
 
@@ -4013,14 +4061,13 @@ remap_operation(struct action_history *history,
         case PCMK_OCF_RUNNING_PROMOTED:
             if (is_probe
                 && (history->exit_status != history->expected_exit_status)) {
-                char *last_change_s = last_change_str(history->xml);
+                const char *last_change_s = last_change_str(history);
 
                 remap_because(history, &why, PCMK_EXEC_DONE, "probe");
                 pcmk__rsc_info(history->rsc,
                                "Probe found %s active and promoted on %s at %s",
                                 history->rsc->id,
                                 pcmk__node_name(history->node), last_change_s);
-                free(last_change_s);
             }
             if (!expired
                 || (history->exit_status == history->expected_exit_status)) {
@@ -4069,7 +4116,7 @@ remap_operation(struct action_history *history,
 
         default:
             if (history->execution_status == PCMK_EXEC_DONE) {
-                char *last_change_s = last_change_str(history->xml);
+                const char *last_change_s = last_change_str(history);
 
                 crm_info("Treating unknown exit status %d from %s of %s "
                          "on %s at %s as failure",
@@ -4077,7 +4124,6 @@ remap_operation(struct action_history *history,
                          pcmk__node_name(history->node), last_change_s);
                 remap_because(history, &why, PCMK_EXEC_ERROR,
                               "unknown exit status");
-                free(last_change_s);
             }
             break;
     }
@@ -4210,7 +4256,7 @@ check_operation_expiry(struct action_history *history)
 {
     bool expired = false;
     bool is_last_failure = pcmk__ends_with(history->id, "_last_failure_0");
-    time_t last_run = 0;
+    time_t last_run = history->last_change;
     int unexpired_fail_count = 0;
     const char *clear_reason = NULL;
 
@@ -4222,9 +4268,7 @@ check_operation_expiry(struct action_history *history)
         return false; // "Not installed" must always be cleared manually
     }
 
-    if ((history->rsc->failure_timeout > 0)
-        && (crm_element_value_epoch(history->xml, PCMK_XA_LAST_RC_CHANGE,
-                                    &last_run) == 0)) {
+    if ((history->rsc->failure_timeout > 0) && history->have_last_change) {
 
         /* Resource has a PCMK_META_FAILURE_TIMEOUT and history entry has a
          * timestamp
@@ -4813,6 +4857,9 @@ unpack_rsc_op(pcmk_resource_t *rsc, pcmk_node_t *node, xmlNode *xml_op,
     history.expected_exit_status = pe__target_rc_from_xml(xml_op);
     history.key = pcmk__xe_history_key(xml_op);
     crm_element_value_int(xml_op, PCMK__XA_CALL_ID, &(history.call_id));
+    history.have_last_change =
+        (crm_element_value_epoch(xml_op, PCMK_XA_LAST_RC_CHANGE,
+                                 &(history.last_change)) == pcmk_ok);
 
     pcmk__rsc_trace(rsc, "Unpacking %s (%s call %d on %s): %s (%s)",
                     history.id, history.task, history.call_id,
@@ -4907,7 +4954,7 @@ unpack_rsc_op(pcmk_resource_t *rsc, pcmk_node_t *node, xmlNode *xml_op,
         || ((failure_strategy == pcmk_on_fail_restart_container)
             && (strcmp(history.task, PCMK_ACTION_STOP) == 0))) {
 
-        char *last_change_s = last_change_str(xml_op);
+        const char *last_change_s = last_change_str(&history);
 
         crm_warn("Pretending failed %s (%s%s%s) of %s on %s at %s succeeded "
                  CRM_XS " %s",
@@ -4915,7 +4962,6 @@ unpack_rsc_op(pcmk_resource_t *rsc, pcmk_node_t *node, xmlNode *xml_op,
                  (pcmk__str_empty(history.exit_reason)? "" : ": "),
                  pcmk__s(history.exit_reason, ""), rsc->id,
                  pcmk__node_name(node), last_change_s, history.id);
-        free(last_change_s);
 
         update_resource_state(&history, history.expected_exit_status,
                               *last_failure, on_fail);
@@ -387,6 +387,7 @@ resource_location(pcmk_resource_t *rsc, const pcmk_node_t *node, int score,
                      rsc->id, pcmk__node_name(rsc->allocated_to));
             free(rsc->allocated_to);
             rsc->allocated_to = NULL;
+            pcmk__sched_assignment_changed(rsc->cluster);
         }
     }
 }
@@ -485,14 +486,16 @@ order_actions(pcmk_action_t *lh_action, pcmk_action_t *rh_action,
         }
     }
 
-    wrapper = pcmk__assert_alloc(1, sizeof(pcmk__related_action_t));
+    wrapper = pcmk__sched_alloc(lh_action->scheduler,
+                                sizeof(pcmk__related_action_t));
     wrapper->action = rh_action;
     wrapper->type = flags;
     list = lh_action->actions_after;
     list = g_list_prepend(list, wrapper);
     lh_action->actions_after = list;
 
-    wrapper = pcmk__assert_alloc(1, sizeof(pcmk__related_action_t));
+    wrapper = pcmk__sched_alloc(rh_action->scheduler,
+                                sizeof(pcmk__related_action_t));
     wrapper->action = lh_action;
     wrapper->type = flags;
     list = rh_action->actions_before;
@@ -1014,6 +1014,76 @@ execute_metadata_action(svc_action_t *op)
     return execute_action(op);
 }
 
+/*!
+ * \internal
+ * \brief Check whether an action's meta-data may be kept in the disk cache
+ *
+ * \param[in] action  Action to check
+ *
+ * \return true if \p action is a cacheable meta-data action, otherwise false
+ */
+static bool
+metadata_cacheable(const svc_action_t *action)
+{
+    /* Other standards' meta-data is synthesized without executing anything.
+     * Agents given parameters might describe themselves differently.
+     */
+    return pcmk__str_eq(action->action, PCMK_ACTION_META_DATA,
+                        pcmk__str_casei)
+           && pcmk__str_eq(action->standard, PCMK_RESOURCE_CLASS_OCF,
+                           pcmk__str_casei)
+           && ((action->params == NULL)
+               || (g_hash_table_size(action->params) == 0))
+           && (action->opaque != NULL) && (action->opaque->exec != NULL);
+}
+
+/*!
+ * \internal
+ * \brief Complete a meta-data action from the disk cache if possible
+ *
+ * \param[in,out] action  Meta-data action
+ *
+ * \return true if \p action's result and output were set from the cache,
+ *         otherwise false (in which case the agent must be executed)
+ */
+bool
+services__metadata_from_cache(svc_action_t *action)
+{
+    char *output = NULL;
+
+    if ((action == NULL) || !metadata_cacheable(action)
+        || (pcmk__cached_agent_metadata(action->standard, action->provider,
+                                        action->agent, action->opaque->exec,
+                                        &output) != pcmk_rc_ok)) {
+        return false;
+    }
+
+    crm_trace("Using cached meta-data for %s", action->opaque->exec);
+    free(action->stdout_data);
+    action->stdout_data = output;
+    services__set_result(action, PCMK_OCF_OK, PCMK_EXEC_DONE, NULL);
+    return true;
+}
+
+/*!
+ * \internal
+ * \brief Save a successful meta-data action's output in the disk cache
+ *
+ * \param[in] action  Completed meta-data action
+ */
+void
+services__metadata_to_cache(const svc_action_t *action)
+{
+    if ((action != NULL) && metadata_cacheable(action)
+        && (action->rc == PCMK_OCF_OK)
+        && (action->status == PCMK_EXEC_DONE)) {
+
+        pcmk__cache_agent_metadata(action->standard, action->provider,
+                                   action->agent, action->opaque->exec,
+                                   action->stdout_data);
+    }
+}
+
 gboolean
 services_action_sync(svc_action_t * op)
 {
@@ -1034,7 +1104,14 @@ services_action_sync(svc_action_t * op)
          * services_action_async() doesn't treat meta-data actions specially, so
          * it will result in an error for classes that don't support the action.
          */
-        rc = (execute_metadata_action(op) == pcmk_rc_ok);
+        if (services__metadata_from_cache(op)) {
+            rc = TRUE;
+        } else {
+            rc = (execute_metadata_action(op) == pcmk_rc_ok);
+            if (rc) {
+                services__metadata_to_cache(op);
+            }
+        }
     } else {
         rc = (execute_action(op) == pcmk_rc_ok);
     }
@@ -82,8 +82,14 @@ static GOptionContext *context = NULL;
 static gchar **processed_args = NULL;
 
 static time_t last_refresh = 0;
+static time_t last_pcmkd_query = 0;
 volatile crm_trigger_t *refresh_trigger = NULL;
 
+/* Unpacked CIB and fencing history, reused across refreshes until the CIB
+ * version changes or the fencer notifies us of a change
+ */
+static pcmk__status_cache_t status_cache = { NULL, };
+
 static enum pcmk__fence_history fence_history = pcmk__fence_history_none;
 
 int interactive_fence_level = 0;
@@ -920,6 +926,9 @@ setup_fencer_connection(void)
 
     rc = st->cmds->connect(st, crm_system_name, NULL);
     if (rc == pcmk_ok) {
+        // We may have missed history changes while disconnected
+        pcmk__status_cache_fencing_changed(&status_cache);
+
         crm_trace("Setting up stonith callbacks");
         if (options.watch_fencing) {
             st->cmds->register_notification(st,
@@ -2073,6 +2082,7 @@ crm_diff_update(const char *event, xmlNode * msg)
                 break;
             case pcmk_ok:
                 cib_updated = TRUE;
+                pcmk__status_cache_patch(&status_cache, diff);
                 break;
             default:
                 crm_notice("[%s] ABORTED: %s (%d)", event, pcmk_strerror(rc), rc);
@@ -2129,10 +2139,18 @@ mon_refresh_display(gpointer user_data)
         fence_history = pcmk__fence_history_reduced;
     }
 
-    // Get an up-to-date pacemakerd status for the cluster summary
-    if (cib->variant == cib_native) {
+    /* Get an up-to-date pacemakerd status for the cluster summary. Once the
+     * daemons are up, a state change is unlikely, so re-query only once per
+     * reconnect interval rather than for every redraw.
+     */
+    if ((cib->variant == cib_native)
+        && (((pcmkd_state != pcmk_pacemakerd_state_running)
+             && (pcmkd_state != pcmk_pacemakerd_state_remote))
+            || ((last_refresh - last_pcmkd_query) * 1000
+                >= options.reconnect_ms))) {
         pcmk__pacemakerd_status(out, crm_system_name, options.reconnect_ms / 2,
                                 false, &pcmkd_state);
+        last_pcmkd_query = last_refresh;
     }
 
     if (out->dest != stdout) {
@@ -2143,7 +2161,8 @@ mon_refresh_display(gpointer user_data)
                                      fence_history, show, show_opts,
                                      options.only_node,options.only_rsc,
                                      options.neg_location_prefix,
-                                     output_format == mon_output_monitor);
+                                     output_format == mon_output_monitor,
+                                     &status_cache);
 
     if (output_format == mon_output_monitor && rc != pcmk_rc_ok) {
         clean_up(MON_STATUS_WARN);
@@ -2169,7 +2188,12 @@ mon_st_callback_event(stonith_t * st, stonith_event_t * e)
     if (st->state == stonith_disconnected) {
         /* disconnect cib as well and have everything reconnect */
         mon_cib_connection_destroy(NULL);
-    } else if (options.external_agent) {
+        return;
+    }
+
+    pcmk__status_cache_fencing_changed(&status_cache);
+
+    if (options.external_agent) {
         char *desc = stonith__event_description(e);
 
         send_custom_trap(e->target, NULL, e->operation, pcmk_ok, e->result, 0, desc);
@@ -2235,6 +2259,7 @@ mon_st_callback_display(stonith_t * st, stonith_event_t * e)
         /* disconnect cib as well and have everything reconnect */
         mon_cib_connection_destroy(NULL);
     } else {
+        pcmk__status_cache_fencing_changed(&status_cache);
         out->progress(out, false);
         refresh_after_event(TRUE, FALSE);
     }
@@ -2260,6 +2285,7 @@ clean_up(crm_exit_t exit_code)
 
     cib__clean_up_connection(&cib);
     stonith_api_delete(st);
+    pcmk__status_cache_clear(&status_cache);
     free(options.neg_location_prefix);
     free(options.only_node);
     free(options.only_rsc);
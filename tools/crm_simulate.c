@@ -38,13 +38,17 @@
 struct {
     char *dot_file;
     char *graph_file;
+    gchar *expected_dir;
     gchar *input_file;
     pcmk_injections_t *injections;
+    gint jobs;
     unsigned int flags;
     gchar *output_file;
     long long repeat;
+    gchar *replay_dir;
     gboolean store;
     gchar *test_dir;
+    gboolean update_expected;
     char *use_date;
     char *xml_file;
 } options = {
@@ -255,6 +259,21 @@ static GOptionEntry operation_entries[] = {
     { "repeat", 'N', 0, G_OPTION_ARG_INT, &options.repeat,
       "With --profile, repeat each test N times and print timings",
       "N" },
+    { "replay-dir", 0, 0, G_OPTION_ARG_FILENAME, &options.replay_dir,
+      "Replay all the XML files in the named directory and compare the\n"
+      INDENT "resulting transition graphs and scores against expected ones",
+      "DIR" },
+    { "expected-dir", 0, 0, G_OPTION_ARG_FILENAME, &options.expected_dir,
+      "With --replay-dir, look for expected results in this directory\n"
+      INDENT "(default: the replay directory)",
+      "DIR" },
+    { "jobs", 0, 0, G_OPTION_ARG_INT, &options.jobs,
+      "With --replay-dir, replay inputs in up to N parallel processes\n"
+      INDENT "(default: number of online processors)",
+      "N" },
+    { "update-expected", 0, 0, G_OPTION_ARG_NONE, &options.update_expected,
+      "With --replay-dir, save the results as the new expected results",
+      NULL },
     /* Deprecated */
     { "pending", 'j', G_OPTION_FLAG_NO_ARG|G_OPTION_FLAG_HIDDEN, G_OPTION_ARG_CALLBACK, pending_cb,
       "Display pending state if '" PCMK_META_RECORD_PENDING "' is enabled",
@@ -534,6 +553,21 @@ main(int argc, char **argv)
     }
     pcmk__set_scheduler_flags(scheduler, pcmk_sched_no_compat);
 
+    if (options.replay_dir != NULL) {
+        unsigned long long flags = pcmk_sched_no_compat;
+
+        if (pcmk_is_set(options.flags, pcmk_sim_sanitized)) {
+            flags |= pcmk_sched_sanitized;
+        }
+        if (pcmk_is_set(options.flags, pcmk_sim_show_utilization)) {
+            flags |= pcmk_sched_show_utilization;
+        }
+        rc = pcmk__replay_dir(out, options.replay_dir, options.expected_dir,
+                              options.update_expected, options.jobs, flags,
+                              options.use_date);
+        goto done;
+    }
+
     if (options.test_dir != NULL) {
         scheduler->priv = out;
         pcmk__profile_dir(options.test_dir, options.repeat, scheduler,
@@ -559,8 +593,10 @@ main(int argc, char **argv)
     /* There sure is a lot to free in options. */
     free(options.dot_file);
     free(options.graph_file);
+    g_free(options.expected_dir);
     g_free(options.input_file);
     g_free(options.output_file);
+    g_free(options.replay_dir);
     g_free(options.test_dir);
     free(options.use_date);
     free(options.xml_file);
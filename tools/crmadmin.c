@@ -28,7 +28,9 @@ static enum {
     cmd_health,
     cmd_whois_dc,
     cmd_list_nodes,
+    cmd_metrics,
     cmd_pacemakerd_health,
+    cmd_set_trace,
 } command = cmd_none;
 
 struct {
@@ -37,6 +39,10 @@ struct {
     char *optarg;
     char *ipc_name;
     gboolean bash_export;
+    gchar *trace_files;
+    gchar *trace_functions;
+    gchar *trace_formats;
+    gchar *trace_tags;
 } options = {
     .optarg = NULL,
     .ipc_name = NULL,
@@ -70,6 +76,19 @@ static GOptionEntry command_options[] = {
       "\n                             Types: all (default), cluster, guest, remote",
       "TYPE"
     },
+    { "metrics", 'M', G_OPTION_FLAG_NO_ARG, G_OPTION_ARG_CALLBACK, command_cb,
+      "Display the local controller's internal metrics (such as IPC"
+      "\n                             queue depths and CPG queue length) in"
+      "\n                             OpenMetrics text format",
+      NULL
+    },
+    { "set-trace", 'T', G_OPTION_FLAG_NO_ARG, G_OPTION_ARG_CALLBACK, command_cb,
+      "Change which log messages the local controller traces, as given by"
+      "\n                             the --trace-* options. Any of those not"
+      "\n                             given is cleared, so with none, tracing"
+      "\n                             is turned off.",
+      NULL
+    },
     { "health", 'H', G_OPTION_FLAG_HIDDEN, G_OPTION_ARG_NONE, &options.health,
       NULL,
       NULL
@@ -92,6 +111,26 @@ static GOptionEntry additional_options[] = {
       "Name to use for ipc instead of 'crmadmin' (with -P/--pacemakerd).",
       "NAME"
     },
+    { "trace-files", 0, 0, G_OPTION_ARG_STRING, &options.trace_files,
+      "Trace messages from these source files, as with PCMK_trace_files"
+      "\n                             (valid with -T/--set-trace)",
+      "FILES"
+    },
+    { "trace-functions", 0, 0, G_OPTION_ARG_STRING, &options.trace_functions,
+      "Trace messages from these functions, as with PCMK_trace_functions"
+      "\n                             (valid with -T/--set-trace)",
+      "FUNCTIONS"
+    },
+    { "trace-formats", 0, 0, G_OPTION_ARG_STRING, &options.trace_formats,
+      "Trace messages with these formats, as with PCMK_trace_formats"
+      "\n                             (valid with -T/--set-trace)",
+      "FORMATS"
+    },
+    { "trace-tags", 0, 0, G_OPTION_ARG_STRING, &options.trace_tags,
+      "Trace messages with these tags, as with PCMK_trace_tags"
+      "\n                             (valid with -T/--set-trace)",
+      "TAGS"
+    },
 
     { NULL }
 };
@@ -116,6 +155,14 @@ command_cb(const gchar *option_name, const gchar *optarg, gpointer data, GError
         command = cmd_list_nodes;
     }
 
+    if (!strcmp(option_name, "--metrics") || !strcmp(option_name, "-M")) {
+        command = cmd_metrics;
+    }
+
+    if (!strcmp(option_name, "--set-trace") || !strcmp(option_name, "-T")) {
+        command = cmd_set_trace;
+    }
+
     if (!strcmp(option_name, "--timeout") || !strcmp(option_name, "-t")) {
         return pcmk_parse_interval_spec(optarg, &options.timeout) == pcmk_rc_ok;
     }
@@ -242,6 +289,16 @@ main(int argc, char **argv)
             rc = pcmk__designated_controller(out,
                                              (unsigned int) options.timeout);
             break;
+        case cmd_metrics:
+            rc = pcmk__controller_metrics(out, (unsigned int) options.timeout);
+            break;
+        case cmd_set_trace:
+            rc = pcmk__controller_set_trace(out, options.trace_files,
+                                            options.trace_functions,
+                                            options.trace_formats,
+                                            options.trace_tags,
+                                            (unsigned int) options.timeout);
+            break;
         case cmd_none:
             rc = pcmk_rc_error;
             break;
@@ -254,6 +311,10 @@ main(int argc, char **argv)
 
 done:
     g_strfreev(processed_args);
+    g_free(options.trace_files);
+    g_free(options.trace_functions);
+    g_free(options.trace_formats);
+    g_free(options.trace_tags);
     pcmk__free_arg_context(context);
 
     pcmk__output_and_clear_error(&error, out);